@@ -13,8 +13,6 @@ layout (location = 4) in vec4[MAX_SPOT_LIGHTS] v_SpotLightSpacePositions;
 
 struct Material
 {
-    bool isNormalMap;
-
     sampler2D grassTexture;
     sampler2D grassNormalMap;
 };
@@ -62,6 +60,11 @@ layout (std140, binding = 3) uniform u_FragmentLights
     SpotLight[MAX_SPOT_LIGHTS] u_SpotLights;
 };
 
+layout (std140, binding = 4) uniform MaterialParameters
+{
+    bool isNormalMap;
+} u_MaterialParameters;
+
 layout (location = 2) uniform Material u_Material;
 layout (location = 5) uniform bool u_IsSkyLight;
 layout (location = 6) uniform float u_SkyLightIntensity;
@@ -199,7 +202,7 @@ void main()
     vec3 albedo = pow(textureColor.rgb, vec3(2.2));
 
 /*     vec3 N;
-    if (u_Material.isNormalMap)
+    if (u_MaterialParameters.isNormalMap)
         N = GetNormalFromNormalMap();
     else
         N = normalize(v_Normal);
@@ -13,14 +13,6 @@ layout (location = 4) in vec4[MAX_SPOT_LIGHTS] v_SpotLightSpacePositions;
 
 struct Material
 {
-    bool isAlbedoMap;
-    bool isNormalMap;
-    bool isMetallicMap;
-    bool isRoughnessMap;
-    bool isAOMap;
-    bool isOpacityMap;
-    bool isEmissiveMap;
-
     sampler2D albedoMap;
     sampler2D metallicMap;
     sampler2D normalMap;
@@ -28,15 +20,6 @@ struct Material
     sampler2D aoMap;
     sampler2D opacityMap;
     sampler2D emissiveMap;
-
-    vec3 albedo;
-    float metallic;
-    float roughness;
-    float ao;
-    float opacity;
-    vec3 emissive;
-
-    float emissiveStrength;
 };
 
 struct DirectionalLight
@@ -82,6 +65,26 @@ layout (std140, binding = 3) uniform u_FragmentLights
     SpotLight[MAX_SPOT_LIGHTS] u_SpotLights;
 };
 
+layout (std140, binding = 4) uniform MaterialParameters
+{
+    bool isAlbedoMap;
+    bool isNormalMap;
+    bool isMetallicMap;
+    bool isRoughnessMap;
+    bool isAOMap;
+    bool isOpacityMap;
+    bool isEmissiveMap;
+
+    vec3 albedo;
+    float metallic;
+    float roughness;
+    float ao;
+    float opacity;
+    vec3 emissive;
+
+    float emissiveStrength;
+} u_MaterialParameters;
+
 layout (location = 2) uniform Material u_Material;
 layout (location = 23) uniform bool u_IsSkyLight;
 layout (location = 24) uniform float u_SkyLightIntensity;
@@ -308,40 +311,40 @@ void main()
     float ao;
     float opacity;
     vec3 emissive;
-    if (u_Material.isAlbedoMap)
+    if (u_MaterialParameters.isAlbedoMap)
         albedo = pow(texture(u_Material.albedoMap, v_TexCoord).rgb, vec3(2.2));
     else
-        albedo = u_Material.albedo;
+        albedo = u_MaterialParameters.albedo;
     
-    if (u_Material.isNormalMap)
+    if (u_MaterialParameters.isNormalMap)
         N = GetNormalFromNormalMap();
     else
         N = normalize(v_Normal);
     
-    if (u_Material.isMetallicMap)
+    if (u_MaterialParameters.isMetallicMap)
         metallic = texture(u_Material.metallicMap, v_TexCoord).r;
     else
-        metallic = u_Material.metallic;
+        metallic = u_MaterialParameters.metallic;
 
-    if (u_Material.isRoughnessMap)
+    if (u_MaterialParameters.isRoughnessMap)
         roughness = texture(u_Material.roughnessMap, v_TexCoord).r;
     else
-        roughness = u_Material.roughness;
+        roughness = u_MaterialParameters.roughness;
 
-    if (u_Material.isAOMap)
+    if (u_MaterialParameters.isAOMap)
         ao = texture(u_Material.aoMap, v_TexCoord).r;
     else
-        ao = u_Material.ao;
+        ao = u_MaterialParameters.ao;
 
-    if (u_Material.isOpacityMap)
+    if (u_MaterialParameters.isOpacityMap)
         opacity = texture(u_Material.opacityMap, v_TexCoord).r;
     else
-        opacity = u_Material.opacity;
+        opacity = u_MaterialParameters.opacity;
 
-    if (u_Material.isEmissiveMap)
+    if (u_MaterialParameters.isEmissiveMap)
         emissive = texture(u_Material.emissiveMap, v_TexCoord).rgb;
     else
-        emissive = u_Material.emissive;
+        emissive = u_MaterialParameters.emissive;
 
     if (opacity < 0.1)
         discard;
@@ -397,7 +400,7 @@ void main()
     shadow = clamp(shadow, 0.0, 1.0);
 
     vec3 ambient = (kD * diffuse + specular) * ao;
-    vec3 color = ambient + Lo * (1.0 - shadow) + emissive * u_Material.emissiveStrength;
+    vec3 color = ambient + Lo * (1.0 - shadow) + emissive * u_MaterialParameters.emissiveStrength;
 
     f_Color = vec4(color, 1.0);
 }
\ No newline at end of file
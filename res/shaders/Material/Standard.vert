@@ -5,6 +5,8 @@
 layout (location = 0) in vec3 a_Position;
 layout (location = 1) in vec3 a_Normal;
 layout (location = 2) in vec2 a_TexCoord;
+// Index of the draw within the multi-draw, selects its data below
+layout (location = 8) in uint a_DrawIndex;
 
 layout (location = 0) out vec3 v_Position;
 layout (location = 1) out vec3 v_Normal;
@@ -30,13 +32,19 @@ layout (std140, binding = 1) uniform u_VertexLights
     mat4[MAX_SPOT_LIGHTS] u_SpotLightSpaceMatrices;
 };
 
-layout (location = 0) uniform mat4 u_Model;
+layout (std430, binding = 3) readonly buffer DrawData
+{
+    mat4 u_DrawModels[];
+};
+
 layout (location = 1) uniform Material u_MaterialVS;
 
 void main()
 {
-    v_Position = vec3(u_Model * vec4(a_Position, 1.0));
-    v_Normal = mat3(transpose(inverse(u_Model))) * a_Normal;
+    mat4 model = u_DrawModels[a_DrawIndex];
+
+    v_Position = vec3(model * vec4(a_Position, 1.0));
+    v_Normal = mat3(transpose(inverse(model))) * a_Normal;
 
     if (u_MaterialVS.flipVerticallyUV)
     {
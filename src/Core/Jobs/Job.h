@@ -0,0 +1,23 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+// Counts jobs which have not finished yet. Jobs spawned from inside a running job with the same
+// counter become its children, the counter only reaches zero once the whole tree is done.
+class JobCounter
+{
+private:
+	std::atomic<int> m_Value{ 0 };
+
+public:
+	inline void Add(int count = 1) { m_Value.fetch_add(count, std::memory_order_relaxed); }
+	inline void Done() { m_Value.fetch_sub(1, std::memory_order_acq_rel); }
+	inline bool IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; }
+};
+
+struct Job
+{
+	std::function<void()> Function;
+	JobCounter* Counter = nullptr;
+};
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+static thread_local uint32_t s_ThreadIndex = 0;
+
+Ref<JobSystem> JobSystem::s_Instance{};
+std::mutex JobSystem::s_Mutex;
+
+JobSystem::JobSystem()
+{
+}
+
+JobSystem::~JobSystem()
+{
+	Shutdown();
+}
+
+Ref<JobSystem> JobSystem::GetInstance()
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+	if (s_Instance == nullptr)
+		s_Instance = CreateRef<JobSystem>();
+
+	return s_Instance;
+}
+
+void JobSystem::Initialize(uint32_t workersCount)
+{
+	if (m_Running)
+		return;
+
+	if (workersCount == 0)
+		workersCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+	m_Queues.clear();
+	for (uint32_t i = 0; i < workersCount + 1; i++)
+		m_Queues.push_back(CreateRef<WorkStealingQueue>());
+
+	m_Running = true;
+	for (uint32_t i = 1; i < workersCount + 1; i++)
+		m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+}
+
+void JobSystem::Shutdown()
+{
+	if (!m_Running)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_WakeMutex);
+		m_Running = false;
+	}
+	m_WakeCondition.notify_all();
+
+	for (auto& worker : m_Workers)
+		worker.join();
+
+	m_Workers.clear();
+
+	// Jobs still queued (also those pushed by workers while stopping) run here, so their counters reach zero
+	while (TryRunJob(s_ThreadIndex))
+		;
+}
+
+void JobSystem::Run(std::function<void()> function, JobCounter* counter)
+{
+	if (counter)
+		counter->Add();
+
+	// Without workers there is nobody to hand the job to
+	if (!m_Running)
+	{
+		function();
+		if (counter)
+			counter->Done();
+
+		return;
+	}
+
+	m_Queues[s_ThreadIndex]->Push({ std::move(function), counter });
+
+	{
+		std::lock_guard<std::mutex> lock(m_WakeMutex);
+		m_PendingJobs++;
+	}
+	m_WakeCondition.notify_one();
+}
+
+void JobSystem::Wait(JobCounter* counter)
+{
+	while (!counter->IsDone())
+	{
+		if (!TryRunJob(s_ThreadIndex))
+			std::this_thread::yield();
+	}
+}
+
+void JobSystem::ParallelFor(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& function, uint32_t minChunkSize)
+{
+	if (count == 0)
+		return;
+
+	JobCounter counter;
+	ParallelRange(0, count, function, std::max(minChunkSize, 1u), &counter);
+
+	Wait(&counter);
+}
+
+void JobSystem::ParallelRange(uint32_t begin, uint32_t end, const std::function<void(uint32_t begin, uint32_t end)>& function, uint32_t minChunkSize, JobCounter* counter)
+{
+	while (begin < end)
+	{
+		// Hand the upper half to an idle worker, which keeps halving it the same way
+		if (end - begin >= minChunkSize * 2 && m_IdleWorkers.load(std::memory_order_relaxed) > m_PendingJobs.load(std::memory_order_relaxed))
+		{
+			uint32_t middle = begin + (end - begin) / 2;
+			Run([this, &function, middle, end, minChunkSize, counter]() { ParallelRange(middle, end, function, minChunkSize, counter); }, counter);
+
+			end = middle;
+			continue;
+		}
+
+		uint32_t chunkEnd = std::min(begin + minChunkSize, end);
+		function(begin, chunkEnd);
+		begin = chunkEnd;
+	}
+}
+
+void JobSystem::WorkerLoop(uint32_t index)
+{
+	s_ThreadIndex = index;
+
+	while (m_Running)
+	{
+		if (TryRunJob(index))
+			continue;
+
+		std::unique_lock<std::mutex> lock(m_WakeMutex);
+		m_IdleWorkers++;
+		m_WakeCondition.wait(lock, [this]() { return m_PendingJobs > 0 || !m_Running; });
+		m_IdleWorkers--;
+	}
+}
+
+bool JobSystem::TryRunJob(uint32_t index)
+{
+	if (m_Queues.empty())
+		return false;
+
+	Job job;
+	bool found = m_Queues[index]->Pop(job);
+
+	for (uint32_t i = 1; !found && i < m_Queues.size(); i++)
+		found = m_Queues[(index + i) % m_Queues.size()]->Steal(job);
+
+	if (!found)
+		return false;
+
+	m_PendingJobs--;
+
+	job.Function();
+	if (job.Counter)
+		job.Counter->Done();
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "typedefs.h"
+#include "Job.h"
+#include "WorkStealingQueue.h"
+
+class JobSystem
+{
+private:
+	static Ref<JobSystem> s_Instance;
+	static std::mutex s_Mutex;
+
+	// Queue 0 belongs to the main thread (and any other thread which is not a worker)
+	std::vector<Ref<WorkStealingQueue>> m_Queues;
+	std::vector<std::thread> m_Workers;
+
+	std::atomic<bool> m_Running{ false };
+	std::atomic<int> m_PendingJobs{ 0 };
+	std::atomic<int> m_IdleWorkers{ 0 };
+	std::mutex m_WakeMutex;
+	std::condition_variable m_WakeCondition;
+
+public:
+	JobSystem();
+	~JobSystem();
+
+	JobSystem(JobSystem& other) = delete;
+	void operator=(const JobSystem&) = delete;
+
+	static Ref<JobSystem> GetInstance();
+
+	// 0 workers picks one per hardware thread except the main one
+	void Initialize(uint32_t workersCount = 0);
+	// Runs the jobs left in the queues on the calling thread before returning
+	void Shutdown();
+
+	void Run(std::function<void()> function, JobCounter* counter = nullptr);
+	// Runs other jobs on the calling thread until the counter reaches zero
+	void Wait(JobCounter* counter);
+
+	// Halves [0, count) for other threads while some of them are idle and the range is at least twice minChunkSize,
+	// each thread runs its part in chunks of minChunkSize so it can still split off the rest when a worker frees up
+	void ParallelFor(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& function, uint32_t minChunkSize = 64);
+
+	inline uint32_t GetThreadsCount() const { return m_Workers.size() + 1; }
+	inline uint32_t GetWorkersCount() const { return m_Workers.size(); }
+
+private:
+	void WorkerLoop(uint32_t index);
+	bool TryRunJob(uint32_t index);
+	void ParallelRange(uint32_t begin, uint32_t end, const std::function<void(uint32_t begin, uint32_t end)>& function, uint32_t minChunkSize, JobCounter* counter);
+};
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "WorkStealingQueue.h"
+
+void WorkStealingQueue::Push(Job job)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Jobs.push_back(std::move(job));
+}
+
+bool WorkStealingQueue::Pop(Job& job)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	if (m_Jobs.empty())
+		return false;
+
+	job = std::move(m_Jobs.back());
+	m_Jobs.pop_back();
+
+	return true;
+}
+
+bool WorkStealingQueue::Steal(Job& job)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	if (m_Jobs.empty())
+		return false;
+
+	job = std::move(m_Jobs.front());
+	m_Jobs.pop_front();
+
+	return true;
+}
+
+bool WorkStealingQueue::IsEmpty() const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_Jobs.empty();
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+
+#include "Job.h"
+
+// Owner thread pushes and pops at the back (most recent, cache warm), other threads steal from the front
+class WorkStealingQueue
+{
+private:
+	std::deque<Job> m_Jobs;
+	mutable std::mutex m_Mutex;
+
+public:
+	void Push(Job job);
+	bool Pop(Job& job);
+	bool Steal(Job& job);
+
+	bool IsEmpty() const;
+};
\ No newline at end of file
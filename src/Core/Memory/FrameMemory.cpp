@@ -0,0 +1,102 @@
+#include "FrameMemory.h"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+std::atomic<uint64_t> FrameMemory::s_FrameIndex{ 0 };
+std::vector<FrameMemory*> FrameMemory::s_Instances;
+std::mutex FrameMemory::s_Mutex;
+
+FrameMemory::FrameMemory(size_t capacity)
+	: m_Buffers{ LinearAllocator(capacity), LinearAllocator(capacity) }, m_FrameIndex(s_FrameIndex.load())
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+	s_Instances.push_back(this);
+}
+
+FrameMemory::~FrameMemory()
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+	s_Instances.erase(std::remove(s_Instances.begin(), s_Instances.end(), this), s_Instances.end());
+}
+
+void FrameMemory::BeginFrame()
+{
+	s_FrameIndex++;
+}
+
+FrameMemory& FrameMemory::Get()
+{
+	static thread_local FrameMemory s_ThreadMemory;
+	return s_ThreadMemory;
+}
+
+size_t FrameMemory::GetLastFrameBytes()
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+
+	size_t bytes = 0;
+	for (auto instance : s_Instances)
+	{
+		bytes += instance->m_LastFrameBytes.load(std::memory_order_relaxed);
+	}
+
+	return bytes;
+}
+
+size_t FrameMemory::GetHighWaterMark()
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+
+	size_t bytes = 0;
+	for (auto instance : s_Instances)
+	{
+		bytes += instance->m_HighWaterMark.load(std::memory_order_relaxed);
+	}
+
+	return bytes;
+}
+
+void* FrameMemory::Allocate(size_t size, size_t alignment)
+{
+	Sync();
+	return m_Buffers[m_FrameIndex & 1].Allocate(size, alignment);
+}
+
+const char* FrameMemory::Format(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	va_list argsCopy;
+	va_copy(argsCopy, args);
+
+	int length = std::vsnprintf(nullptr, 0, format, args);
+	char* buffer = Allocate<char>(length + 1);
+	std::vsnprintf(buffer, length + 1, format, argsCopy);
+
+	va_end(argsCopy);
+	va_end(args);
+
+	return buffer;
+}
+
+void FrameMemory::Sync()
+{
+	uint64_t frameIndex = s_FrameIndex.load(std::memory_order_relaxed);
+	if (frameIndex == m_FrameIndex)
+		return;
+
+	size_t bytes = m_Buffers[m_FrameIndex & 1].GetUsedBytes();
+	m_LastFrameBytes.store(frameIndex - m_FrameIndex == 1 ? bytes : 0, std::memory_order_relaxed);
+	if (bytes > m_HighWaterMark.load(std::memory_order_relaxed))
+		m_HighWaterMark.store(bytes, std::memory_order_relaxed);
+
+	// The buffer of the previous frame is kept, the one before it can go.
+	// A thread which skipped frames has nothing left that is still in use.
+	m_Buffers[frameIndex & 1].Reset();
+	if (frameIndex - m_FrameIndex > 1)
+		m_Buffers[(frameIndex + 1) & 1].Reset();
+
+	m_FrameIndex = frameIndex;
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "LinearAllocator.h"
+
+// Double-buffered per-frame memory. Everything allocated during a frame stays valid until the end
+// of the next one and is then dropped at once, so transient containers never have to be freed.
+// Every thread (main and job workers) has its own instance, allocating never takes a lock.
+class FrameMemory
+{
+public:
+	static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+private:
+	static std::atomic<uint64_t> s_FrameIndex;
+	static std::vector<FrameMemory*> s_Instances;
+	static std::mutex s_Mutex;
+
+	std::array<LinearAllocator, 2> m_Buffers;
+	uint64_t m_FrameIndex;
+
+	// Read by the debug panel from the main thread while workers allocate
+	std::atomic<size_t> m_LastFrameBytes{ 0 };
+	std::atomic<size_t> m_HighWaterMark{ 0 };
+
+public:
+	FrameMemory(size_t capacity = DEFAULT_CAPACITY);
+	~FrameMemory();
+
+	FrameMemory(const FrameMemory&) = delete;
+	FrameMemory& operator=(const FrameMemory&) = delete;
+
+	// Called once per frame from the main loop, each thread flips its buffers on its next allocation
+	static void BeginFrame();
+	// Frame memory of the calling thread
+	static FrameMemory& Get();
+
+	// Summed over all threads
+	static size_t GetLastFrameBytes();
+	static size_t GetHighWaterMark();
+
+	void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	template<typename T>
+	T* Allocate(size_t count)
+	{
+		return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	// printf style, the string lives as long as the rest of the frame memory
+	const char* Format(const char* format, ...);
+
+private:
+	void Sync();
+};
+
+// Stateless STL allocator over the frame memory of the allocating thread, deallocation is a no-op.
+// Containers using it must not be kept past the next frame.
+template<typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator() = default;
+
+	template<typename U>
+	FrameAllocator(const FrameAllocator<U>&)
+	{
+	}
+
+	T* allocate(size_t count)
+	{
+		return FrameMemory::Get().Allocate<T>(count);
+	}
+
+	void deallocate(T*, size_t)
+	{
+	}
+
+	template<typename U>
+	bool operator==(const FrameAllocator<U>&) const { return true; }
+	template<typename U>
+	bool operator!=(const FrameAllocator<U>&) const { return false; }
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
\ No newline at end of file
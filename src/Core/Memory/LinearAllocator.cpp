@@ -0,0 +1,62 @@
+#include "LinearAllocator.h"
+
+#include <new>
+
+LinearAllocator::LinearAllocator(size_t capacity)
+	: m_Capacity(capacity)
+{
+	m_Buffer = static_cast<char*>(::operator new(m_Capacity));
+}
+
+LinearAllocator::~LinearAllocator()
+{
+	for (void* block : m_OverflowBlocks)
+	{
+		::operator delete(block);
+	}
+
+	::operator delete(m_Buffer);
+}
+
+void* LinearAllocator::Allocate(size_t size, size_t alignment)
+{
+	// The buffer itself is only aligned to the default new alignment
+	size_t offset = (m_Offset + alignment - 1) & ~(alignment - 1);
+	if (offset + size <= m_Capacity && alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	{
+		m_Offset = offset + size;
+		return m_Buffer + offset;
+	}
+
+	// Over-allocate so the block can be aligned without a separate aligned delete
+	char* block = static_cast<char*>(::operator new(size + alignment));
+	m_OverflowBlocks.push_back(block);
+	m_OverflowBytes += size + alignment;
+
+	size_t misalignment = reinterpret_cast<size_t>(block) & (alignment - 1);
+	return misalignment ? block + alignment - misalignment : block;
+}
+
+void LinearAllocator::Reset()
+{
+	m_Offset = 0;
+
+	if (m_OverflowBlocks.empty())
+		return;
+
+	for (void* block : m_OverflowBlocks)
+	{
+		::operator delete(block);
+	}
+	m_OverflowBlocks.clear();
+
+	// Grow to fit everything this frame needed, with some headroom
+	size_t capacity = m_Capacity ? m_Capacity : 1;
+	while (capacity < m_Capacity + m_OverflowBytes)
+		capacity *= 2;
+
+	::operator delete(m_Buffer);
+	m_Buffer = static_cast<char*>(::operator new(capacity));
+	m_Capacity = capacity;
+	m_OverflowBytes = 0;
+}
\ No newline at end of file
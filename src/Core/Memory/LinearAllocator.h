@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Bump allocator, individual allocations are never freed, everything is released at once by Reset.
+// Requests which do not fit go to overflow blocks; the next Reset grows the buffer to cover them,
+// so after a few frames the allocator stops touching the heap.
+class LinearAllocator
+{
+private:
+	char* m_Buffer = nullptr;
+	size_t m_Capacity = 0;
+	size_t m_Offset = 0;
+
+	std::vector<void*> m_OverflowBlocks;
+	size_t m_OverflowBytes = 0;
+
+public:
+	LinearAllocator(size_t capacity);
+	~LinearAllocator();
+
+	LinearAllocator(const LinearAllocator&) = delete;
+	LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+	void* Allocate(size_t size, size_t alignment);
+	void Reset();
+
+	inline size_t GetUsedBytes() const { return m_Offset + m_OverflowBytes; }
+	inline size_t GetCapacity() const { return m_Capacity; }
+};
\ No newline at end of file
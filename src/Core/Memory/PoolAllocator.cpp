@@ -0,0 +1,115 @@
+#include "PoolAllocator.h"
+
+#include <algorithm>
+#include <functional>
+#include <new>
+
+PoolAllocator::PoolAllocator(size_t blockSize, size_t blocksPerChunk)
+	: m_BlocksPerChunk(blocksPerChunk)
+{
+	// Every free block stores the pointer to the next one
+	m_BlockSize = blockSize < sizeof(void*) ? sizeof(void*) : blockSize;
+}
+
+PoolAllocator::~PoolAllocator()
+{
+	for (void* chunk : m_Chunks)
+	{
+		::operator delete(chunk);
+	}
+}
+
+void* PoolAllocator::Allocate()
+{
+	if (!m_FreeList)
+		AllocateChunk();
+
+	void* block = m_FreeList;
+	m_FreeList = *static_cast<void**>(block);
+
+	m_AllocationsCount++;
+	m_LiveBlocksCount++;
+
+	return block;
+}
+
+void PoolAllocator::Deallocate(void* block)
+{
+	*static_cast<void**>(block) = m_FreeList;
+	m_FreeList = block;
+
+	m_LiveBlocksCount--;
+}
+
+size_t PoolAllocator::ReleaseEmptyChunks()
+{
+	if (m_Chunks.size() < 2)
+		return 0;
+
+	std::sort(m_Chunks.begin(), m_Chunks.end(), std::less<void*>());
+	auto findChunk = [this](void* block)
+	{
+		return std::upper_bound(m_Chunks.begin(), m_Chunks.end(), block, std::less<void*>()) - m_Chunks.begin() - 1;
+	};
+
+	std::vector<size_t> freeBlocks(m_Chunks.size(), 0);
+	for (void* block = m_FreeList; block; block = *static_cast<void**>(block))
+		freeBlocks[findChunk(block)]++;
+
+	// One empty chunk is kept, so adding and removing a single object does not allocate a chunk every time
+	std::vector<bool> released(m_Chunks.size(), false);
+	size_t releasedCount = 0;
+	bool keptEmptyChunk = false;
+	for (size_t i = 0; i < m_Chunks.size(); i++)
+	{
+		if (freeBlocks[i] != m_BlocksPerChunk)
+			continue;
+
+		if (keptEmptyChunk)
+		{
+			released[i] = true;
+			releasedCount++;
+		}
+		keptEmptyChunk = true;
+	}
+
+	if (!releasedCount)
+		return 0;
+
+	// Unlinks the blocks of the released chunks, the other blocks keep their order
+	void** link = &m_FreeList;
+	while (*link)
+	{
+		void* block = *link;
+		if (released[findChunk(block)])
+			*link = *static_cast<void**>(block);
+		else
+			link = static_cast<void**>(block);
+	}
+
+	size_t keptCount = 0;
+	for (size_t i = 0; i < m_Chunks.size(); i++)
+	{
+		if (released[i])
+			::operator delete(m_Chunks[i]);
+		else
+			m_Chunks[keptCount++] = m_Chunks[i];
+	}
+	m_Chunks.resize(keptCount);
+
+	return releasedCount;
+}
+
+void PoolAllocator::AllocateChunk()
+{
+	char* chunk = static_cast<char*>(::operator new(m_BlockSize * m_BlocksPerChunk));
+	m_Chunks.push_back(chunk);
+
+	// Link the new blocks in address order, so consecutive allocations end up next to each other
+	for (size_t i = m_BlocksPerChunk; i > 0; i--)
+	{
+		void* block = chunk + (i - 1) * m_BlockSize;
+		*static_cast<void**>(block) = m_FreeList;
+		m_FreeList = block;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Fixed-size blocks carved out of larger chunks. Freed blocks are kept in an intrusive free list,
+// chunks are returned to the system by ReleaseEmptyChunks or when the pool is destroyed.
+// Not thread safe, scene mutations happen on the main thread.
+class PoolAllocator
+{
+private:
+	size_t m_BlockSize;
+	size_t m_BlocksPerChunk;
+
+	std::vector<void*> m_Chunks;
+	void* m_FreeList = nullptr;
+
+	size_t m_AllocationsCount = 0;
+	size_t m_LiveBlocksCount = 0;
+
+public:
+	PoolAllocator(size_t blockSize, size_t blocksPerChunk = 256);
+	~PoolAllocator();
+
+	PoolAllocator(const PoolAllocator&) = delete;
+	PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+	void* Allocate();
+	void Deallocate(void* block);
+	// Frees the chunks without any live block but one, walks the whole free list. Returns how many were freed
+	size_t ReleaseEmptyChunks();
+
+	inline size_t GetBlockSize() const { return m_BlockSize; }
+	inline size_t GetAllocationsCount() const { return m_AllocationsCount; }
+	inline size_t GetLiveBlocksCount() const { return m_LiveBlocksCount; }
+	inline size_t GetChunksCount() const { return m_Chunks.size(); }
+	inline size_t GetReservedBytes() const { return m_Chunks.size() * m_BlocksPerChunk * m_BlockSize; }
+
+private:
+	void AllocateChunk();
+};
\ No newline at end of file
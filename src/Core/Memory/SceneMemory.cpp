@@ -0,0 +1,180 @@
+#include "SceneMemory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+SceneMemory::TypeID SceneMemory::s_NextTypeID = 0;
+
+void* SceneMemory::AllocateObject(TypeID type, size_t size, size_t alignment)
+{
+	if (!IsPooled(size, alignment))
+		return AllocateHeap(size);
+
+	if (type >= m_TypePools.size())
+		m_TypePools.resize(type + 1);
+
+	// Blocks are rounded like the array classes so every block stays aligned for any object
+	if (!m_TypePools[type])
+		m_TypePools[type] = std::make_unique<PoolAllocator>((size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY * SIZE_CLASS_GRANULARITY);
+
+	return m_TypePools[type]->Allocate();
+}
+
+void SceneMemory::DeallocateObject(TypeID type, void* memory, size_t size, size_t alignment)
+{
+	if (!IsPooled(size, alignment))
+	{
+		DeallocateHeap(memory);
+		return;
+	}
+
+	m_TypePools[type]->Deallocate(memory);
+}
+
+void* SceneMemory::AllocateArray(size_t size, size_t alignment)
+{
+	if (!IsPooled(size, alignment))
+		return AllocateHeap(size);
+
+	size_t sizeClass = (size - 1) / SIZE_CLASS_GRANULARITY;
+	if (!m_ArrayPools[sizeClass])
+		m_ArrayPools[sizeClass] = std::make_unique<PoolAllocator>((sizeClass + 1) * SIZE_CLASS_GRANULARITY);
+
+	return m_ArrayPools[sizeClass]->Allocate();
+}
+
+void SceneMemory::DeallocateArray(void* memory, size_t size, size_t alignment)
+{
+	if (!IsPooled(size, alignment))
+	{
+		DeallocateHeap(memory);
+		return;
+	}
+
+	m_ArrayPools[(size - 1) / SIZE_CLASS_GRANULARITY]->Deallocate(memory);
+}
+
+std::string_view SceneMemory::StoreName(std::string_view name)
+{
+	size_t size = name.size() + 1;
+	if (m_NameChunks.empty() || m_NameChunkOffset + size > m_NameChunkSize)
+	{
+		// Names longer than a chunk get a chunk of their own
+		m_NameChunkSize = std::max(size, NAME_CHUNK_SIZE);
+		m_NameChunks.push_back(std::make_unique<char[]>(m_NameChunkSize));
+		m_NameChunkOffset = 0;
+		m_NameReservedBytes += m_NameChunkSize;
+	}
+
+	char* copy = m_NameChunks.back().get() + m_NameChunkOffset;
+	std::memcpy(copy, name.data(), name.size());
+	copy[name.size()] = '\0';
+
+	m_NameChunkOffset += size;
+	m_NameBytes += size;
+
+	return std::string_view(copy, name.size());
+}
+
+void SceneMemory::ReleaseEmptyChunks()
+{
+	for (auto& pool : m_TypePools)
+	{
+		if (pool)
+			pool->ReleaseEmptyChunks();
+	}
+	for (auto& pool : m_ArrayPools)
+	{
+		if (pool)
+			pool->ReleaseEmptyChunks();
+	}
+}
+
+size_t SceneMemory::GetAllocationsCount() const
+{
+	size_t count = m_HeapAllocationsCount + m_NameChunks.size();
+	for (auto& pool : m_TypePools)
+	{
+		if (pool)
+			count += pool->GetAllocationsCount();
+	}
+	for (auto& pool : m_ArrayPools)
+	{
+		if (pool)
+			count += pool->GetAllocationsCount();
+	}
+
+	return count;
+}
+
+size_t SceneMemory::GetLiveAllocationsCount() const
+{
+	size_t count = m_LiveHeapAllocationsCount + m_NameChunks.size();
+	for (auto& pool : m_TypePools)
+	{
+		if (pool)
+			count += pool->GetLiveBlocksCount();
+	}
+	for (auto& pool : m_ArrayPools)
+	{
+		if (pool)
+			count += pool->GetLiveBlocksCount();
+	}
+
+	return count;
+}
+
+size_t SceneMemory::GetChunksCount() const
+{
+	size_t count = m_NameChunks.size();
+	for (auto& pool : m_TypePools)
+	{
+		if (pool)
+			count += pool->GetChunksCount();
+	}
+	for (auto& pool : m_ArrayPools)
+	{
+		if (pool)
+			count += pool->GetChunksCount();
+	}
+
+	return count;
+}
+
+size_t SceneMemory::GetReservedBytes() const
+{
+	size_t bytes = m_NameReservedBytes;
+	for (auto& pool : m_TypePools)
+	{
+		if (pool)
+			bytes += pool->GetReservedBytes();
+	}
+	for (auto& pool : m_ArrayPools)
+	{
+		if (pool)
+			bytes += pool->GetReservedBytes();
+	}
+
+	return bytes;
+}
+
+bool SceneMemory::IsPooled(size_t size, size_t alignment)
+{
+	// Chunks come from the global operator new, so only its default alignment is guaranteed
+	return size > 0 && size <= MAX_POOLED_SIZE && alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+void* SceneMemory::AllocateHeap(size_t size)
+{
+	m_HeapAllocationsCount++;
+	m_LiveHeapAllocationsCount++;
+
+	return ::operator new(size);
+}
+
+void SceneMemory::DeallocateHeap(void* memory)
+{
+	m_LiveHeapAllocationsCount--;
+	::operator delete(memory);
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "typedefs.h"
+#include "PoolAllocator.h"
+
+// Scene owned memory for entities, components, their small arrays and names.
+// Single objects (an entity, a component with its shared_ptr control block) get the pool of their
+// type, so all objects of a type are packed next to each other. Arrays are rounded up to a size class
+// and served by the pool of that class, bigger requests go to the heap. Names are copied into an arena
+// which is only released with the scene. Everything goes away in one pass over the chunks.
+class SceneMemory
+{
+public:
+	static constexpr size_t SIZE_CLASS_GRANULARITY = 16;
+	static constexpr size_t SIZE_CLASSES_COUNT = 64;
+	static constexpr size_t MAX_POOLED_SIZE = SIZE_CLASS_GRANULARITY * SIZE_CLASSES_COUNT;
+	static constexpr size_t NAME_CHUNK_SIZE = 4096;
+
+	using TypeID = uint32_t;
+
+private:
+	std::vector<std::unique_ptr<PoolAllocator>> m_TypePools;
+	std::array<std::unique_ptr<PoolAllocator>, SIZE_CLASSES_COUNT> m_ArrayPools;
+
+	std::vector<std::unique_ptr<char[]>> m_NameChunks;
+	size_t m_NameChunkSize = 0;
+	size_t m_NameChunkOffset = 0;
+	size_t m_NameBytes = 0;
+	size_t m_NameReservedBytes = 0;
+
+	size_t m_HeapAllocationsCount = 0;
+	size_t m_LiveHeapAllocationsCount = 0;
+
+	static TypeID s_NextTypeID;
+
+public:
+	SceneMemory() = default;
+
+	SceneMemory(const SceneMemory&) = delete;
+	SceneMemory& operator=(const SceneMemory&) = delete;
+
+	template<typename T>
+	static TypeID GetTypeID()
+	{
+		static const TypeID id = s_NextTypeID++;
+		return id;
+	}
+
+	void* AllocateObject(TypeID type, size_t size, size_t alignment);
+	void DeallocateObject(TypeID type, void* memory, size_t size, size_t alignment);
+
+	void* AllocateArray(size_t size, size_t alignment);
+	void DeallocateArray(void* memory, size_t size, size_t alignment);
+
+	// Copy of the name with a terminating null, valid as long as the scene
+	std::string_view StoreName(std::string_view name);
+
+	// Returns the pool chunks emptied by removed objects, names stay until the scene is destroyed
+	void ReleaseEmptyChunks();
+
+	size_t GetAllocationsCount() const;
+	size_t GetLiveAllocationsCount() const;
+	size_t GetChunksCount() const;
+	size_t GetReservedBytes() const;
+	inline size_t GetHeapAllocationsCount() const { return m_HeapAllocationsCount; }
+	inline size_t GetTypePoolsCount() const { return m_TypePools.size(); }
+	inline size_t GetNameBytes() const { return m_NameBytes; }
+
+private:
+	static bool IsPooled(size_t size, size_t alignment);
+
+	void* AllocateHeap(size_t size);
+	void DeallocateHeap(void* memory);
+};
+
+// STL allocator backed by the scene memory. Only holds a pointer to it: the scene owns the memory
+// and releases it last, so nothing allocated from a scene may outlive it.
+template<typename T>
+class SceneAllocator
+{
+public:
+	using value_type = T;
+
+	SceneAllocator(SceneMemory* memory)
+		: m_Memory(memory)
+	{
+	}
+
+	template<typename U>
+	SceneAllocator(const SceneAllocator<U>& other)
+		: m_Memory(other.m_Memory)
+	{
+	}
+
+	T* allocate(size_t count)
+	{
+		if (count == 1)
+			return static_cast<T*>(m_Memory->AllocateObject(SceneMemory::GetTypeID<T>(), sizeof(T), alignof(T)));
+
+		return static_cast<T*>(m_Memory->AllocateArray(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T* memory, size_t count)
+	{
+		if (count == 1)
+			m_Memory->DeallocateObject(SceneMemory::GetTypeID<T>(), memory, sizeof(T), alignof(T));
+		else
+			m_Memory->DeallocateArray(memory, count * sizeof(T), alignof(T));
+	}
+
+	template<typename U>
+	bool operator==(const SceneAllocator<U>& other) const { return m_Memory == other.m_Memory; }
+	template<typename U>
+	bool operator!=(const SceneAllocator<U>& other) const { return m_Memory != other.m_Memory; }
+
+private:
+	SceneMemory* m_Memory;
+
+	template<typename U>
+	friend class SceneAllocator;
+};
+
+template<typename T>
+using SceneVector = std::vector<T, SceneAllocator<T>>;
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Non-owning view over contiguous elements, for read accessors which should not expose
+// how the container is allocated. Only valid as long as the viewed container is not resized.
+template<typename T>
+class Span
+{
+private:
+	T* m_Data = nullptr;
+	size_t m_Size = 0;
+
+public:
+	Span() = default;
+
+	Span(T* data, size_t size)
+		: m_Data(data), m_Size(size)
+	{
+	}
+
+	template<typename Allocator>
+	Span(const std::vector<std::remove_const_t<T>, Allocator>& vector)
+		: m_Data(vector.data()), m_Size(vector.size())
+	{
+	}
+
+	template<size_t N>
+	Span(const std::array<std::remove_const_t<T>, N>& array)
+		: m_Data(array.data()), m_Size(N)
+	{
+	}
+
+	inline T* begin() const { return m_Data; }
+	inline T* end() const { return m_Data + m_Size; }
+	inline T* data() const { return m_Data; }
+	inline size_t size() const { return m_Size; }
+	inline bool empty() const { return m_Size == 0; }
+
+	inline T& operator[](size_t index) const { return m_Data[index]; }
+};
\ No newline at end of file
@@ -99,7 +99,7 @@ void ContentBrowserPanel::MakeAction(std::string path, std::string extension)
 		std::string entityName = path.substr(path.find_last_of('/') + 1, path.find_last_of('.') - (path.find_last_of('/') + 1));
 
 		unsigned int countSameName = 0;
-		for (auto entity : m_Scene->GetEntities())
+		for (auto& entity : m_Scene->GetEntities())
 		{
 			if (entity->GetName().substr(0, entity->GetName().find_last_of(" ")) == entityName)
 				countSameName++;
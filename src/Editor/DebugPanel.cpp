@@ -1,6 +1,9 @@
 #include "DebugPanel.h"
 
 #include "Editor.h"
+#include "Core/Memory/FrameMemory.h"
+#include "Renderer/Device/StateCachingRenderDevice.h"
+#include "Renderer/GeometryArena.h"
 #include "Scene/Component/StaticMeshComponent.h"
 
 DebugPanel::DebugPanel(Ref<Editor> editor) 
@@ -14,12 +17,47 @@ void DebugPanel::Render()
 
 	ImGui::Text("Framerate: %.1f FPS (%.3f ms/frame)", ImGui::GetIO().Framerate, 1000 / ImGui::GetIO().Framerate);
 
+	auto scene = m_Editor->GetScene();
+	ImGui::Text("Entities: %i", (int)scene->GetEntities().size());
+	ImGui::Text("Entity index memory: %.1f KB", scene->GetEntityIndexMemoryUsage() / 1024.0f);
+
+	auto memory = scene->GetMemory();
+	ImGui::Text("Scene allocations: %i (%i live, %i from heap)", (int)memory->GetAllocationsCount(),
+		(int)memory->GetLiveAllocationsCount(), (int)memory->GetHeapAllocationsCount());
+	ImGui::Text("Scene memory: %.1f KB in %i chunks, %i type pools, %.1f KB of names", memory->GetReservedBytes() / 1024.0f,
+		(int)memory->GetChunksCount(), (int)memory->GetTypePoolsCount(), memory->GetNameBytes() / 1024.0f);
+	const CullingStats& culling = Renderer::GetInstance()->GetCullingStats();
+	ImGui::Text("Draws: %u tested, %u culled, %u drawn", culling.Tested, culling.Culled, culling.Drawn);
+	ImGui::Text("Shadow casters: %u tested, %u drawn", culling.ShadowCastersTested, culling.ShadowCastersDrawn);
+
+	const RenderCommandStats& commands = Renderer::GetInstance()->GetCommandStats();
+	ImGui::Text("Commands: %u in %u draw calls", commands.Commands, commands.DrawCalls);
+	ImGui::Text("State changes saved: %u programs, %u materials, %u vertex arrays, %u models",
+		commands.Commands - commands.ProgramChanges, commands.Commands - commands.MaterialChanges,
+		commands.Commands - commands.VertexArrayChanges, commands.Commands - commands.ModelChanges);
+
+	// Counted since the panel was last drawn, so over one frame
+	if (auto stateCache = dynamic_cast<StateCachingRenderDevice*>(&RenderDevice::Get()))
+	{
+		ImGui::Text("GL state changes: %u issued, %u elided", (uint32_t)stateCache->GetIssuedCount(), (uint32_t)stateCache->GetElidedCount());
+		stateCache->ResetCounts();
+	}
+
+	auto geometry = GeometryArena::GetInstance();
+	ImGui::Text("Geometry arena: %u / %u vertices, %u free ranges", geometry->GetVertexCapacity() - geometry->GetFreeVerticesCount(),
+		geometry->GetVertexCapacity(), geometry->GetFreeVertexRangesCount());
+
+	const ShadowMapStats& shadowMaps = Renderer::GetInstance()->GetShadowMapStats();
+	ImGui::Text("Shadow maps: %u rendered (%u static layers), %u reused", shadowMaps.Rendered, shadowMaps.StaticLayersRendered, shadowMaps.Reused);
+
+	ImGui::Text("Frame memory: %.1f KB (high-water %.1f KB)", FrameMemory::GetLastFrameBytes() / 1024.0f, FrameMemory::GetHighWaterMark() / 1024.0f);
+
 	auto selectedEntity = m_Editor->GetSceneHierarchyPanel()->GetSelectedEntity();
 	if (selectedEntity)
 	{
 		ImGui::Text("Selected entity: ");
 		ImGui::SameLine();
-		ImGui::Text(selectedEntity->GetName().c_str());
+		ImGui::Text(selectedEntity->GetName().data());
 
 		if (selectedEntity->GetComponent<StaticMeshComponent>())
 			ImGui::Text("Vertices: %i", selectedEntity->GetComponent<StaticMeshComponent>()->GetRenderedVerticesCount());
@@ -11,6 +11,7 @@
 #include "Scene/Component/ParticleSystemComponent.h"
 #include "Scene/Component/PlayerComponent.h"
 
+#include <cstring>
 #include <glm/gtc/type_ptr.hpp>
 
 bool Equals(float arr[3], glm::vec3 vec)
@@ -27,12 +28,21 @@ EntityDetailsPanel::EntityDetailsPanel(Ref<Editor> editor) : m_Editor(editor)
 
 void EntityDetailsPanel::Render()
 {
+	// The entity may have been removed since it was shown
+	if (!m_Entity || !m_Entity->GetScene()->IsValid(m_Entity->GetHandle()))
+	{
+		m_Entity = Ref<Entity>();
+		m_Editor->HideDetails();
+		return;
+	}
+
 	ImGui::Begin("Details");
 
-    size_t maxSize = 128;
-    char* name = (char*)m_Entity->m_Name.c_str();
-    ImGui::InputText("##Name", name, maxSize);
-    m_Entity->m_Name = name;
+    char name[128];
+    strncpy(name, m_Entity->GetName().data(), sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    if (ImGui::InputText("##Name", name, sizeof(name)))
+        m_Entity->SetName(name);
     ImGui::Dummy(ImVec2(0.0f, 10.0f));
 
     ImGui::Text("Transform");
@@ -61,6 +71,11 @@ void EntityDetailsPanel::Render()
     if (!Equals(arr, m_Entity->GetTransform().LocalScale))
         m_Entity->SetLocalScale({ arr[0], arr[1], arr[2] });
 
+    int mobility = (int)m_Entity->GetMobility();
+    const char* mobilities[] = { "Static", "Movable" };
+    if (ImGui::Combo("Mobility", &mobility, mobilities, 2))
+        m_Entity->SetMobility((Mobility)mobility);
+
     ImGui::Dummy(ImVec2(0.0f, 10.0f));
 
     if (auto mesh = m_Entity->GetComponent<StaticMeshComponent>())
@@ -98,6 +113,10 @@ void EntityDetailsPanel::Render()
             }
             ImGui::PopID();
         }
+
+        bool castShadows = mesh->CastsShadows();
+        if (ImGui::Checkbox("Cast Shadows##StaticMesh", &castShadows))
+            mesh->SetCastShadows(castShadows);
     }
     if (auto mesh = m_Entity->GetComponent<InstanceRenderedMeshComponent>())
     {
@@ -134,6 +153,11 @@ void EntityDetailsPanel::Render()
             }
             ImGui::PopID();
         }
+
+        bool castShadows = mesh->CastsShadows();
+        if (ImGui::Checkbox("Cast Shadows##InstanceRenderedMesh", &castShadows))
+            mesh->SetCastShadows(castShadows);
+
         ImGui::Dummy(ImVec2(0.0f, 10.0f));
         
         ImGui::Text("Instancing");
@@ -141,6 +165,7 @@ void EntityDetailsPanel::Render()
         ImGui::DragInt("Instances Count", &mesh->m_InstancesCount, 25, 1, 10000000);
         ImGui::DragFloat("Min Mesh Scale", &mesh->m_MinMeshScale, 0.1f, 0.1f, 2.0f);
         ImGui::DragFloat("Max Mesh Scale", &mesh->m_MaxMeshScale, 0.1f, 0.1f, 2.0f);
+        ImGui::InputScalar("Seed", ImGuiDataType_U32, &mesh->m_Seed);
 
         if (ImGui::Button("Generate"))
             mesh->Generate();
@@ -190,8 +215,13 @@ void EntityDetailsPanel::Render()
             ImGui::EndMenu();
         }
 
-        ImGui::DragFloat3("Color", (float*)&light->m_Color, 0.1f, 0.0f, 100.0f);
-        ImGui::Checkbox("Cast Shadows", &light->m_ShadowsEnabled);
+        glm::vec3 color = light->m_Color;
+        if (ImGui::DragFloat3("Color", (float*)&color, 0.1f, 0.0f, 100.0f))
+            light->SetColor(color);
+
+        bool shadowsEnabled = light->m_ShadowsEnabled;
+        if (ImGui::Checkbox("Cast Shadows", &shadowsEnabled))
+            light->SetShadowsEnabled(shadowsEnabled);
 
         if (auto spotLight = m_Entity->GetComponent<SpotLight>())
         {
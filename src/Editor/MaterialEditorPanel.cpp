@@ -28,7 +28,7 @@ void MaterialEditorPanel::Render()
         extensions.push_back("frag");
         
         auto sl = ShaderLibrary::GetInstance();
-        for (auto sh : sl->GetMaterialShaders())
+        for (auto& sh : sl->GetMaterialShaders())
         {
             if (ImGui::MenuItem(sh.first.c_str()))
             {
@@ -45,7 +45,9 @@ void MaterialEditorPanel::Render()
     {
         std::string name = param.first.substr(param.first.find_first_of('.') + 1);
 
-        ImGui::Checkbox(name.c_str(), &param.second);
+        bool value = param.second;
+        if (ImGui::Checkbox(name.c_str(), &value))
+            m_Material->SetBool(param.first, value);
     }
     ImGui::Dummy(ImVec2(0.0f, 10.0f));
 
@@ -77,7 +79,9 @@ void MaterialEditorPanel::Render()
     {
         std::string name = param.first.substr(param.first.find_first_of('.') + 1);
 
-        ImGui::ColorEdit3(name.c_str(), (float*)&param.second, ImGuiColorEditFlags_Float);
+        glm::vec3 value = param.second;
+        if (ImGui::ColorEdit3(name.c_str(), (float*)&value, ImGuiColorEditFlags_Float))
+            m_Material->SetVec3(param.first, value);
     }
     ImGui::Dummy(ImVec2(0.0f, 10.0f));
 
@@ -85,7 +89,9 @@ void MaterialEditorPanel::Render()
     {
         std::string name = param.first.substr(param.first.find_first_of('.') + 1);
 
-        ImGui::DragFloat(name.c_str(), &param.second, 0.01f, 0.0f, 1.0f);
+        float value = param.second;
+        if (ImGui::DragFloat(name.c_str(), &value, 0.01f, 0.0f, 1.0f))
+            m_Material->SetFloat(param.first, value);
     }
     ImGui::Dummy(ImVec2(0.0f, 10.0f));
 
@@ -9,7 +9,7 @@
 
 SceneHierarchyPanel::SceneHierarchyPanel(Ref<Editor> editor, Ref<Scene> scene) : m_Editor(editor), m_Scene(scene)
 {
-	m_SelectedEntity = Ref<Entity>();
+	m_SelectedEntity = EntityHandle();
 }
 
 void SceneHierarchyPanel::Render()
@@ -21,7 +21,7 @@ void SceneHierarchyPanel::Render()
 		if (ImGui::IsItemClicked())
 			m_Editor->ShowDetails(m_Scene->GetRoot());
 
-		TreeChildren(m_Scene->GetRoot());
+		TreeChildren(m_Scene->GetRoot().get());
 		ImGui::TreePop();
 	}
 
@@ -36,20 +36,11 @@ void SceneHierarchyPanel::Render()
 	if (addEntity)
 	{
 		std::string entityName = "New Entity";
-		bool unique = false;
 		int nr = 1;
-		while (!unique)
+		while (m_Scene->FindEntity(entityName))
 		{
-			unique = true;
-			for (auto entity : m_Scene->GetEntities())
-			{
-				if (entity->GetName() == entityName)
-				{
-					entityName = "New Entity (" + std::to_string(nr) + ")";
-					nr++;
-					unique = false;
-				}
-			}
+			entityName = "New Entity (" + std::to_string(nr) + ")";
+			nr++;
 		}
 
 		m_Scene->AddEntity(entityName);
@@ -60,17 +51,21 @@ void SceneHierarchyPanel::Render()
 
 void SceneHierarchyPanel::DuplicateSelectedEntity()
 {
-	std::string name = m_SelectedEntity->GetName();
-	Entity* parent = m_SelectedEntity->GetParent();
+	Entity* selectedEntity = m_Scene->GetEntity(m_SelectedEntity);
+	if (!selectedEntity)
+		return;
+
+	std::string name(selectedEntity->GetName());
+	Entity* parent = selectedEntity->GetParent();
 
 	auto newEntity = m_Scene->AddEntity(name);
 	newEntity->SetParent(parent);
 
-	newEntity->SetLocalPosition(m_SelectedEntity->GetTransform().LocalPosition);
-	newEntity->SetLocalRotation(m_SelectedEntity->GetTransform().LocalRotation);
-	newEntity->SetLocalScale(m_SelectedEntity->GetTransform().LocalScale);
+	newEntity->SetLocalPosition(selectedEntity->GetTransform().LocalPosition);
+	newEntity->SetLocalRotation(selectedEntity->GetTransform().LocalRotation);
+	newEntity->SetLocalScale(selectedEntity->GetTransform().LocalScale);
 
-	if (auto smc = m_SelectedEntity->GetComponent<StaticMeshComponent>())
+	if (auto smc = selectedEntity->GetComponent<StaticMeshComponent>())
 	{
 		auto newSMC = newEntity->AddComponent<StaticMeshComponent>();
 		newSMC->ChangeMesh(smc->GetPath());
@@ -78,7 +73,7 @@ void SceneHierarchyPanel::DuplicateSelectedEntity()
 			newSMC->ChangeMaterial(i, smc->GetMaterialsPaths()[i]);
 	}
 
-	if (auto irmc = m_SelectedEntity->GetComponent<InstanceRenderedMeshComponent>())
+	if (auto irmc = selectedEntity->GetComponent<InstanceRenderedMeshComponent>())
 	{
 		auto newIRMC = newEntity->AddComponent<InstanceRenderedMeshComponent>();
 		newIRMC->ChangeMesh(irmc->GetPath());
@@ -89,23 +84,43 @@ void SceneHierarchyPanel::DuplicateSelectedEntity()
 		newIRMC->SetRadius(irmc->GetRadius());
 		newIRMC->SetMinMeshScale(irmc->GetMinMeshScale());
 		newIRMC->SetMaxMeshScale(irmc->GetMaxMeshScale());
+		newIRMC->SetSeed(irmc->GetSeed());
 	}
 
 	SelectEntity(newEntity);
 }
 
+void SceneHierarchyPanel::RemoveSelectedEntity()
+{
+	Ref<Entity> selectedEntity = GetSelectedEntity();
+	if (!selectedEntity)
+		return;
+
+	m_Scene->RemoveEntity(selectedEntity);
+
+	UnselectEntity();
+	m_Editor->HideDetails();
+}
+
 void SceneHierarchyPanel::SelectEntity(Ref<Entity> entity)
 {
-	m_SelectedEntity = entity;
-	m_Editor->ShowDetails(m_SelectedEntity);
+	m_SelectedEntity = entity->GetHandle();
+	m_Editor->ShowDetails(entity);
 }
 
 void SceneHierarchyPanel::UnselectEntity()
 {
-	m_SelectedEntity = Ref<Entity>();
+	m_SelectedEntity = EntityHandle();
+}
+
+Ref<Entity> SceneHierarchyPanel::GetSelectedEntity() const
+{
+	// Handle of a removed entity no longer resolves
+	Entity* entity = m_Scene->GetEntity(m_SelectedEntity);
+	return entity ? entity->shared_from_this() : Ref<Entity>();
 }
 
-void SceneHierarchyPanel::TreeChildren(Ref<Entity> entity)
+void SceneHierarchyPanel::TreeChildren(Entity* entity)
 {
 	auto children = entity->m_Children;
 	for (int i = 0; i < children.size(); i++)
@@ -117,7 +132,7 @@ void SceneHierarchyPanel::TreeChildren(Ref<Entity> entity)
 			flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
 
 		bool open = false;
-		auto e = m_Scene->FindEntity(children[i]->m_ID);
+		Entity* e = children[i];
 
 		ImGui::PushID(i);
 		bool enable = e->IsEnable();
@@ -127,27 +142,29 @@ void SceneHierarchyPanel::TreeChildren(Ref<Entity> entity)
 		ImGui::PopID();
 
 		ImGui::SameLine();
-		open = ImGui::TreeNodeEx(e->GetName().c_str(), flags);
+		open = ImGui::TreeNodeEx(e->GetName().data(), flags);
 
 		if (ImGui::IsItemClicked())
 		{
-			SelectEntity(e);
+			SelectEntity(e->shared_from_this());
 		}
 
 		if (ImGui::BeginDragDropTarget())
 		{
 			if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("entity"))
 			{
-				Ref<Entity>* childEntity = static_cast<Ref<Entity>*>(payload->Data);
-				childEntity->get()->SetParent(children[i]);
+				EntityHandle childHandle = *static_cast<EntityHandle*>(payload->Data);
+				if (Entity* childEntity = m_Scene->GetEntity(childHandle))
+					childEntity->SetParent(children[i]);
 			}
 			ImGui::EndDragDropTarget();
 		}
 
 		if (ImGui::BeginDragDropSource())
 		{
-			ImGui::SetDragDropPayload("entity", &e, sizeof(Entity));
-			ImGui::Text(e->GetName().c_str());
+			EntityHandle handle = e->GetHandle();
+			ImGui::SetDragDropPayload("entity", &handle, sizeof(EntityHandle));
+			ImGui::Text(e->GetName().data());
 			ImGui::EndDragDropSource();
 		}
 
@@ -10,19 +10,20 @@ class SceneHierarchyPanel
 private:
 	Ref<Editor> m_Editor;
 	Ref<Scene> m_Scene;
-	Ref<Entity> m_SelectedEntity;
+	EntityHandle m_SelectedEntity;
 
 public:
 	SceneHierarchyPanel(Ref<Editor> editor, Ref<Scene> scene);
 	void Render();
 
 	void DuplicateSelectedEntity();
+	void RemoveSelectedEntity();
 
 	void SelectEntity(Ref<Entity> entity);
 	void UnselectEntity();
 
-	inline Ref<Entity> GetSelectedEntity() const { return m_SelectedEntity; }
+	Ref<Entity> GetSelectedEntity() const;
 
 private:
-	void TreeChildren(Ref<Entity> entity);
+	void TreeChildren(Entity* entity);
 };
\ No newline at end of file
@@ -39,7 +39,7 @@ void Viewport::Render(Ref<Framebuffer> framebuffer)
 
         Ref<Camera> camera = m_Scene->GetCamera();
 
-        Transform transform = selectedEntity->GetTransform();
+        const Transform& transform = selectedEntity->GetTransform();
 
         glm::mat4 view = camera->GetViewMatrix();
         glm::mat4 projection = camera->GetProjectionMatrix();
@@ -0,0 +1,202 @@
+#include "HeadlessRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+#include "Scene/Scene.h"
+#include "Scene/SceneSerializer.h"
+#include "Renderer/Renderer.h"
+#include "Renderer/Device/NullRenderDevice.h"
+#include "Renderer/Device/StateCachingRenderDevice.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Memory/FrameMemory.h"
+
+template<typename Function>
+static void Measure(PhaseTiming& timing, Function&& function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+
+	timing.Add(std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+static void WriteString(std::ostream& out, const std::string& string)
+{
+	out << '"';
+	for (char c : string)
+	{
+		if (c == '"' || c == '\\')
+			out << '\\';
+		out << c;
+	}
+	out << '"';
+}
+
+static void WriteTiming(std::ostream& out, const PhaseTiming& timing)
+{
+	out << "\t\t\"" << timing.Name << "\": { \"calls\": " << timing.Calls
+		<< ", \"total_ms\": " << timing.TotalMilliseconds
+		<< ", \"average_ms\": " << (timing.Calls ? timing.TotalMilliseconds / timing.Calls : 0.0)
+		<< ", \"max_ms\": " << timing.MaxMilliseconds << " }";
+}
+
+static void WriteCounts(std::ostream& out, const char* name, const SceneCounts& counts)
+{
+	out << "\t\"" << name << "\": {\n"
+		<< "\t\t\"entities\": " << counts.Entities << ",\n"
+		<< "\t\t\"scene_allocations\": " << counts.SceneAllocations << ",\n"
+		<< "\t\t\"live_scene_allocations\": " << counts.LiveSceneAllocations << ",\n"
+		<< "\t\t\"scene_heap_allocations\": " << counts.SceneHeapAllocations << ",\n"
+		<< "\t\t\"scene_reserved_bytes\": " << counts.SceneReservedBytes << ",\n"
+		<< "\t\t\"scene_name_bytes\": " << counts.SceneNameBytes << "\n"
+		<< "\t}";
+}
+
+void PhaseTiming::Add(double milliseconds)
+{
+	Calls++;
+	TotalMilliseconds += milliseconds;
+	MaxMilliseconds = std::max(MaxMilliseconds, milliseconds);
+}
+
+HeadlessRunner::HeadlessRunner(HeadlessConfig config)
+	: m_Config(std::move(config))
+{
+	m_Device = CreateRef<NullRenderDevice>();
+	m_StateCache = CreateRef<StateCachingRenderDevice>(m_Device);
+}
+
+bool HeadlessRunner::Run()
+{
+	// Must be in place before anything creates a buffer, texture or shader
+	RenderDevice::Set(m_StateCache);
+	m_Device->SetRecording(m_Config.RecordTrace);
+
+	JobSystem::GetInstance()->Initialize(m_Config.WorkersCount);
+	m_ThreadsCount = JobSystem::GetInstance()->GetThreadsCount();
+
+	// Sky lights render their cubemaps through the renderer while loading
+	auto renderer = Renderer::GetInstance();
+	renderer->Initialize();
+
+	if (m_Config.Render)
+	{
+		// Same targets as the editor, frames are drawn into them and never presented
+		renderer->InitializeMainSceneFramebuffer();
+		renderer->InitializePostProcessingFramebuffer();
+		renderer->InitializeShadowMapFramebuffers();
+
+		renderer->InitializePostProcessing();
+	}
+
+	Measure(m_Load, [&]() { m_Scene = SceneSerializer::Deserialize(m_Config.ScenePath); });
+	if (!m_Scene)
+	{
+		JobSystem::GetInstance()->Shutdown();
+		return false;
+	}
+
+	m_Loaded = CountScene();
+
+	Measure(m_Begin, [&]() { m_Scene->Begin(); });
+
+	if (m_Config.Play)
+		Measure(m_BeginPlay, [&]() { m_Scene->BeginPlay(); });
+
+	for (uint32_t i = 0; i < m_Config.StepsCount; i++)
+	{
+		FrameMemory::BeginFrame();
+
+		Measure(m_Update, [&]() { m_Scene->Update(); });
+
+		if (m_Config.Play)
+			Measure(m_Tick, [&]() { m_Scene->Tick(m_Config.StepTime); });
+
+		if (m_Config.Render)
+		{
+			Measure(m_Render, [&]()
+			{
+				renderer->RenderScene(m_Scene);
+
+				if (renderer->IsPostProcessing())
+					renderer->AddPostProcessingEffects();
+			});
+
+			m_RenderCommands += renderer->GetCommandStats().Commands;
+			m_DrawCalls += renderer->GetCommandStats().DrawCalls;
+		}
+	}
+
+	if (m_Config.Play)
+		Measure(m_EndPlay, [&]() { m_Scene->EndPlay(); });
+
+	m_Finished = CountScene();
+	m_FrameMemoryHighWaterMark = FrameMemory::GetHighWaterMark();
+
+	JobSystem::GetInstance()->Shutdown();
+
+	return true;
+}
+
+void HeadlessRunner::WriteReport(std::ostream& out) const
+{
+	out << "{\n"
+		<< "\t\"scene\": ";
+	WriteString(out, m_Config.ScenePath);
+	out << ",\n"
+		<< "\t\"steps\": " << m_Config.StepsCount << ",\n"
+		<< "\t\"step_time\": " << m_Config.StepTime << ",\n"
+		<< "\t\"play\": " << (m_Config.Play ? "true" : "false") << ",\n"
+		<< "\t\"render\": " << (m_Config.Render ? "true" : "false") << ",\n"
+		<< "\t\"threads\": " << m_ThreadsCount << ",\n";
+
+	out << "\t\"phases\": {\n";
+	const PhaseTiming* timings[] = { &m_Load, &m_Begin, &m_BeginPlay, &m_Update, &m_Tick, &m_Render, &m_EndPlay };
+	for (size_t i = 0; i < std::size(timings); i++)
+	{
+		WriteTiming(out, *timings[i]);
+		out << (i + 1 < std::size(timings) ? ",\n" : "\n");
+	}
+	out << "\t},\n";
+
+	WriteCounts(out, "loaded", m_Loaded);
+	out << ",\n";
+	WriteCounts(out, "finished", m_Finished);
+	out << ",\n";
+
+	out << "\t\"frame_memory_high_water_mark\": " << m_FrameMemoryHighWaterMark << ",\n"
+		<< "\t\"render_commands\": " << m_RenderCommands << ",\n"
+		<< "\t\"draw_calls\": " << m_DrawCalls << ",\n"
+		<< "\t\"device_calls\": " << m_Device->GetCallsCount() << ",\n"
+		<< "\t\"device_state_changes_issued\": " << m_StateCache->GetIssuedCount() << ",\n"
+		<< "\t\"device_state_changes_elided\": " << m_StateCache->GetElidedCount() << ",\n"
+		<< "\t\"device_errors\": " << m_Device->GetErrors().size() << "\n"
+		<< "}\n";
+}
+
+void HeadlessRunner::WriteTrace(std::ostream& out) const
+{
+	m_Device->WriteTrace(out);
+}
+
+void HeadlessRunner::WriteCallCounts(std::ostream& out) const
+{
+	m_Device->WriteCallCounts(out);
+}
+
+SceneCounts HeadlessRunner::CountScene() const
+{
+	SceneCounts counts;
+	counts.Entities = m_Scene->GetEntities().size();
+
+	const SceneMemory* memory = m_Scene->GetMemory();
+	counts.SceneAllocations = memory->GetAllocationsCount();
+	counts.LiveSceneAllocations = memory->GetLiveAllocationsCount();
+	counts.SceneHeapAllocations = memory->GetHeapAllocationsCount();
+	counts.SceneReservedBytes = memory->GetReservedBytes();
+	counts.SceneNameBytes = memory->GetNameBytes();
+
+	return counts;
+}
\ No newline at end of file
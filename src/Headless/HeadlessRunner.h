@@ -0,0 +1,88 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "typedefs.h"
+
+class Scene;
+class NullRenderDevice;
+class StateCachingRenderDevice;
+
+struct HeadlessConfig
+{
+	std::string ScenePath;
+	uint32_t StepsCount = 600;
+	float StepTime = 1.0f / 60.0f;
+	// Runs BeginPlay and a Tick after every Update, like the editor in play mode
+	bool Play = true;
+	// Renders the scene after every step, like the editor draws a frame once its updates ran
+	bool Render = true;
+	// Keeps every device call with its arguments for WriteTrace, the trace grows with each frame
+	bool RecordTrace = false;
+	// 0 picks one worker per hardware thread except the main one
+	uint32_t WorkersCount = 0;
+};
+
+struct PhaseTiming
+{
+	const char* Name;
+	uint32_t Calls = 0;
+	double TotalMilliseconds = 0.0;
+	double MaxMilliseconds = 0.0;
+
+	PhaseTiming(const char* name) : Name(name) {}
+
+	void Add(double milliseconds);
+};
+
+struct SceneCounts
+{
+	size_t Entities = 0;
+	size_t SceneAllocations = 0;
+	size_t LiveSceneAllocations = 0;
+	size_t SceneHeapAllocations = 0;
+	size_t SceneReservedBytes = 0;
+	size_t SceneNameBytes = 0;
+};
+
+// Runs the simulation of a scene for a fixed number of steps without a window, editor or GPU.
+// Graphics commands issued while loading, updating and rendering go through a state cache to a null render device.
+class HeadlessRunner
+{
+private:
+	HeadlessConfig m_Config;
+	Ref<NullRenderDevice> m_Device;
+	Ref<StateCachingRenderDevice> m_StateCache;
+	Ref<Scene> m_Scene;
+
+	PhaseTiming m_Load{ "Load" };
+	PhaseTiming m_Begin{ "Begin" };
+	PhaseTiming m_BeginPlay{ "BeginPlay" };
+	PhaseTiming m_Update{ "Update" };
+	PhaseTiming m_Tick{ "Tick" };
+	PhaseTiming m_Render{ "Render" };
+	PhaseTiming m_EndPlay{ "EndPlay" };
+
+	uint64_t m_RenderCommands = 0;
+	uint64_t m_DrawCalls = 0;
+
+	SceneCounts m_Loaded;
+	SceneCounts m_Finished;
+	size_t m_FrameMemoryHighWaterMark = 0;
+	uint32_t m_ThreadsCount = 0;
+
+public:
+	HeadlessRunner(HeadlessConfig config);
+
+	bool Run();
+	void WriteReport(std::ostream& out) const;
+
+	// Device calls of the whole run, the trace is empty unless RecordTrace was set
+	void WriteTrace(std::ostream& out) const;
+	void WriteCallCounts(std::ostream& out) const;
+
+private:
+	SceneCounts CountScene() const;
+};
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "HeadlessRunner.h"
+
+// MistHeadless <scene> [--steps N] [--step-time SECONDS] [--workers N] [--no-play] [--no-render] [--output FILE] [--trace FILE] [--call-counts FILE]
+// Loading may log to stdout, so pass --output to get a clean JSON report.
+// --trace writes every device call of the run with its arguments, --call-counts how many times each was made,
+// both come out the same for the same scene and options so CI can diff them.
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: MistHeadless <scene> [--steps N] [--step-time SECONDS] [--workers N] [--no-play] [--no-render] [--output FILE] [--trace FILE] [--call-counts FILE]" << std::endl;
+		return 1;
+	}
+
+	HeadlessConfig config;
+	config.ScenePath = argv[1];
+	const char* outputPath = nullptr;
+	const char* tracePath = nullptr;
+	const char* callCountsPath = nullptr;
+
+	for (int i = 2; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (!strcmp(argv[i], "--steps") && hasValue)
+			config.StepsCount = std::strtoul(argv[++i], nullptr, 10);
+		else if (!strcmp(argv[i], "--step-time") && hasValue)
+			config.StepTime = std::strtof(argv[++i], nullptr);
+		else if (!strcmp(argv[i], "--workers") && hasValue)
+			config.WorkersCount = std::strtoul(argv[++i], nullptr, 10);
+		else if (!strcmp(argv[i], "--no-play"))
+			config.Play = false;
+		else if (!strcmp(argv[i], "--no-render"))
+			config.Render = false;
+		else if (!strcmp(argv[i], "--output") && hasValue)
+			outputPath = argv[++i];
+		else if (!strcmp(argv[i], "--trace") && hasValue)
+			tracePath = argv[++i];
+		else if (!strcmp(argv[i], "--call-counts") && hasValue)
+			callCountsPath = argv[++i];
+		else
+		{
+			std::cerr << "Unknown argument: " << argv[i] << std::endl;
+			return 1;
+		}
+	}
+
+	config.RecordTrace = tracePath != nullptr;
+
+	HeadlessRunner runner(config);
+	if (!runner.Run())
+	{
+		std::cerr << "Failed to load scene " << config.ScenePath << std::endl;
+		return 1;
+	}
+
+	if (outputPath)
+	{
+		std::ofstream file(outputPath);
+		runner.WriteReport(file);
+	}
+	else
+		runner.WriteReport(std::cout);
+
+	if (tracePath)
+	{
+		std::ofstream file(tracePath);
+		runner.WriteTrace(file);
+	}
+
+	if (callCountsPath)
+	{
+		std::ofstream file(callCountsPath);
+		runner.WriteCallCounts(file);
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -20,7 +20,10 @@ Ref<MeshImporter> MeshImporter::GetInstance()
 std::vector<Mesh> MeshImporter::ImportMesh(std::string path)
 {
 	if (m_ImportedMeshes.find(path) != m_ImportedMeshes.end())
+	{
+		m_UsersCounts[path]++;
 		return m_ImportedMeshes.at(path);
+	}
 
 	Assimp::Importer importer;
 	const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
@@ -36,9 +39,27 @@ std::vector<Mesh> MeshImporter::ImportMesh(std::string path)
 	ProcessNode(scene->mRootNode, scene, meshes);
 
 	m_ImportedMeshes.insert({ path, meshes });
+	m_UsersCounts[path] = 1;
 	return meshes;
 }
 
+void MeshImporter::ReleaseMesh(std::string path)
+{
+	auto users = m_UsersCounts.find(path);
+	if (users == m_UsersCounts.end() || --users->second > 0)
+		return;
+
+	for (auto& mesh : m_ImportedMeshes.at(path))
+		mesh.Destroy();
+
+	m_ImportedMeshes.erase(path);
+	m_UsersCounts.erase(users);
+
+	Ref<GeometryArena> arena = GeometryArena::GetInstance();
+	if (arena->IsFragmented())
+		arena->Defragment();
+}
+
 void MeshImporter::ProcessNode(aiNode* node, const aiScene* scene, std::vector<Mesh>& meshes)
 {
 	for (unsigned int i = 0; i < node->mNumMeshes; i++)
@@ -58,6 +79,7 @@ Mesh MeshImporter::ProcessMesh(aiMesh* mesh, const aiScene* scene)
 	std::vector<Vertex> vertices;
 	std::vector<unsigned int> indices;
 	std::vector<Texture> textures;
+	AABB bounds;
 
 	for (unsigned int i = 0; i < mesh->mNumVertices; i++)
 	{
@@ -68,6 +90,7 @@ Mesh MeshImporter::ProcessMesh(aiMesh* mesh, const aiScene* scene)
 		vector.y = mesh->mVertices[i].y;
 		vector.z = mesh->mVertices[i].z;
 		vertex.position = vector;
+		bounds.Expand(vector);
 
 		vector.x = mesh->mNormals[i].x;
 		vector.y = mesh->mNormals[i].y;
@@ -103,5 +126,5 @@ Mesh MeshImporter::ProcessMesh(aiMesh* mesh, const aiScene* scene)
 		}
 	}
 
-	return Mesh(vertices, indices);
+	return Mesh(std::move(vertices), std::move(indices), bounds);
 }
@@ -23,6 +23,8 @@ public:
 	static Ref<MeshImporter> GetInstance();
 
 	std::vector<Mesh> ImportMesh(std::string path);
+	// Every ImportMesh has to be paired with a release, GPU buffers are freed with the last user
+	void ReleaseMesh(std::string path);
 
 private:
 	void ProcessNode(aiNode* node, const aiScene* scene, std::vector<Mesh>& meshes);
@@ -33,4 +35,5 @@ private:
 	static std::mutex s_Mutex;
 
 	std::unordered_map<std::string, std::vector<Mesh>> m_ImportedMeshes;
+	std::unordered_map<std::string, uint32_t> m_UsersCounts;
 };
\ No newline at end of file
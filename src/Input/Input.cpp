@@ -32,11 +32,13 @@ Ref<Input> Input::GetInstance()
 
 void Input::ProcessKeyboardInput(GLFWwindow* window)
 {
+#ifndef MIST_HEADLESS
 	for (auto actionMapping : m_KeyboardActionMappings)
 	{
 		if (glfwGetKey(window, actionMapping->m_Key) == GLFW_PRESS)
 			MakeAction(actionMapping);
 	}
+#endif
 }
 
 Ref<KeyboardActionMapping> Input::FindActionMapping(std::string name)
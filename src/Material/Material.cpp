@@ -42,32 +42,92 @@ Ref<Material> Material::Create(std::string name, std::string shaderName)
 void Material::Use()
 {
 	m_Shader->Use();
+	ApplyParameters();
+}
 
-	for (auto& param : m_BoolParameters)
+Material::~Material()
+{
+	GetParametersArena().Free(m_ParametersBlock);
+}
+
+UniformBufferArena& Material::GetParametersArena()
+{
+	// Created on first use, once there is a context to create the buffer in. Never destroyed,
+	// materials owned by other singletons are released after function statics at exit
+	static UniformBufferArena* arena = new UniformBufferArena(MATERIAL_PARAMETERS_BINDING, 64 * UniformBufferArena::BLOCK_ALIGNMENT);
+	return *arena;
+}
+
+void Material::ApplyParameters()
+{
+	if (m_ParametersBlock.IsValid())
+		GetParametersArena().Bind(m_ParametersBlock);
+
+	for (auto& uniform : m_BoolUniforms)
 	{
-		m_Shader->SetBool(param.first, param.second);
+		m_Shader->SetBool(uniform.first, *uniform.second);
 	}
-	for (auto& param : m_FloatParameters)
+	for (auto& uniform : m_FloatUniforms)
 	{
-		m_Shader->SetFloat(param.first, param.second);
+		m_Shader->SetFloat(uniform.first, *uniform.second);
 	}
-	for (auto& param : m_Vec3Parameters)
+	for (auto& uniform : m_Vec3Uniforms)
 	{
-		m_Shader->SetVec3(param.first, param.second);
+		m_Shader->SetVec3(uniform.first, *uniform.second);
 	}
 
 	int index = 0;
-	for (auto& param : m_Texture2DParameters)
+	for (auto& uniform : m_TextureUniforms)
 	{
-		if (param.second)
+		if (const Ref<Texture>& texture = *uniform.second)
 		{
-			param.second->Bind(index);
-			m_Shader->SetInt(param.first, index);
+			texture->Bind(index);
+			m_Shader->SetInt(uniform.first, index);
 			index++;
 		}
 	}
 }
 
+void Material::SetBool(const std::string& name, bool value)
+{
+	auto it = m_BoolParameters.find(name);
+	if (it == m_BoolParameters.end())
+		return;
+
+	it->second = value;
+
+	// std140 bools take four bytes
+	uint32_t packed = value ? 1 : 0;
+	WriteParameter(name, &packed, sizeof(packed));
+}
+
+void Material::SetFloat(const std::string& name, float value)
+{
+	auto it = m_FloatParameters.find(name);
+	if (it == m_FloatParameters.end())
+		return;
+
+	it->second = value;
+	WriteParameter(name, &value, sizeof(value));
+}
+
+void Material::SetVec3(const std::string& name, const glm::vec3& value)
+{
+	auto it = m_Vec3Parameters.find(name);
+	if (it == m_Vec3Parameters.end())
+		return;
+
+	it->second = value;
+	WriteParameter(name, &value, sizeof(value));
+}
+
+void Material::WriteParameter(const std::string& name, const void* value, uint32_t size)
+{
+	auto it = m_ParameterOffsets.find(name);
+	if (it != m_ParameterOffsets.end())
+		GetParametersArena().Update(m_ParametersBlock, it->second, size, value);
+}
+
 void Material::LoadParameters()
 {
 	m_BoolParameters.clear();
@@ -75,31 +135,71 @@ void Material::LoadParameters()
 	m_Vec3Parameters.clear();
 	m_Texture2DParameters.clear();
 
-	std::vector<ShaderUniform> uniforms = m_Shader->GetUniforms();
-	for (auto uniform : uniforms)
+	GetParametersArena().Free(m_ParametersBlock);
+	m_ParametersBlock = UniformBufferBlock();
+	m_ParameterOffsets.clear();
+
+	int32_t blockIndex = m_Shader->GetUniformBlockIndex(MATERIAL_PARAMETERS_BLOCK);
+
+	for (auto& uniform : m_Shader->GetUniforms())
 	{
 		std::string uniformName = uniform.name.substr(0, uniform.name.find_first_of('.'));
-		if (uniformName == "u_Material" || uniformName == "u_MaterialVS")
+		std::string name = uniform.name;
+
+		if (blockIndex >= 0 && uniform.blockIndex == blockIndex)
 		{
-			//std::string name = uniform.name.substr(uniform.name.find_first_of('.') + 1);
-
-			switch (uniform.type)
-			{
-			case ShaderUniformType::BOOL:
-				m_BoolParameters.insert({ uniform.name, false });
-				break;
-			case ShaderUniformType::INT:
-				break;
-			case ShaderUniformType::FLOAT:
-				m_FloatParameters.insert({ uniform.name, 0.0 });
-				break;
-			case ShaderUniformType::VEC3:
-				m_Vec3Parameters.insert({ uniform.name, glm::vec3(0.0f) });
-				break;
-			case ShaderUniformType::SAMPLER_2D:
-				m_Texture2DParameters.insert({ uniform.name, Ref<Texture>() });
-			}
+			// Keeps the names materials were saved with before these parameters moved into the block
+			name = "u_Material" + uniform.name.substr(uniform.name.find_first_of('.'));
+			m_ParameterOffsets.insert({ name, (uint32_t)uniform.blockOffset });
+		}
+		else if (uniformName != "u_Material" && uniformName != "u_MaterialVS")
+			continue;
+
+		switch (uniform.type)
+		{
+		case ShaderUniformType::BOOL:
+			m_BoolParameters.insert({ name, false });
+			break;
+		case ShaderUniformType::INT:
+			break;
+		case ShaderUniformType::FLOAT:
+			m_FloatParameters.insert({ name, 0.0 });
+			break;
+		case ShaderUniformType::VEC3:
+			m_Vec3Parameters.insert({ name, glm::vec3(0.0f) });
+			break;
+		case ShaderUniformType::SAMPLER_2D:
+			m_Texture2DParameters.insert({ name, Ref<Texture>() });
 		}
 	}
-}
 
+	// The defaults are all zero, which is how the arena hands out new blocks
+	if (blockIndex >= 0)
+		m_ParametersBlock = GetParametersArena().Allocate(m_Shader->GetUniformBlockSize(blockIndex));
+
+	// Map nodes never move, the values can be read through these pointers until the next reload
+	m_BoolUniforms.clear();
+	m_FloatUniforms.clear();
+	m_Vec3Uniforms.clear();
+	m_TextureUniforms.clear();
+
+	for (auto& param : m_BoolParameters)
+	{
+		if (!m_ParameterOffsets.count(param.first))
+			m_BoolUniforms.push_back({ UniformName::Get(param.first), &param.second });
+	}
+	for (auto& param : m_FloatParameters)
+	{
+		if (!m_ParameterOffsets.count(param.first))
+			m_FloatUniforms.push_back({ UniformName::Get(param.first), &param.second });
+	}
+	for (auto& param : m_Vec3Parameters)
+	{
+		if (!m_ParameterOffsets.count(param.first))
+			m_Vec3Uniforms.push_back({ UniformName::Get(param.first), &param.second });
+	}
+	for (auto& param : m_Texture2DParameters)
+	{
+		m_TextureUniforms.push_back({ UniformName::Get(param.first), &param.second });
+	}
+}
\ No newline at end of file
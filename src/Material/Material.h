@@ -7,6 +7,11 @@
 #include "typedefs.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Texture.h"
+#include "Renderer/UniformBufferArena.h"
+
+// Uniform block holding the bool, float and vec3 parameters of the material shaders
+#define MATERIAL_PARAMETERS_BLOCK "MaterialParameters"
+#define MATERIAL_PARAMETERS_BINDING 4
 
 //template <typename T>
 //struct MaterialParameter
@@ -33,6 +38,15 @@ private:
 	std::unordered_map<std::string, glm::vec3> m_Vec3Parameters;
 	std::unordered_map<std::string, Ref<Texture>> m_Texture2DParameters;
 
+	// Parameters inside the shader's parameters block are packed std140 in this material's block of the shared arena,
+	// at these offsets. The others are still set as uniforms, from the values in the maps above.
+	UniformBufferBlock m_ParametersBlock;
+	std::unordered_map<std::string, uint32_t> m_ParameterOffsets;
+	std::vector<std::pair<UniformID, const bool*>> m_BoolUniforms;
+	std::vector<std::pair<UniformID, const float*>> m_FloatUniforms;
+	std::vector<std::pair<UniformID, const glm::vec3*>> m_Vec3Uniforms;
+	std::vector<std::pair<UniformID, const Ref<Texture>*>> m_TextureUniforms;
+
 public:
 	Material(std::string name = "Default", Ref<Shader> shader = Ref<Shader>());
 	Material(uint64_t id, std::string name = "Default", Ref<Shader> shader = Ref<Shader>());
@@ -40,13 +54,30 @@ public:
 	static Ref<Material> Create(std::string name, Ref<Shader> shader);
 	static Ref<Material> Create(std::string name, std::string shaderName);
 
+	~Material();
+
+	Material(const Material&) = delete;
+	Material& operator=(const Material&) = delete;
+
 	void LoadParameters();
 	void Use();
+	// Binds the parameters block and sets the remaining uniforms, the shader has to be in use already
+	void ApplyParameters();
+
+	// Only the bytes of the changed parameter are uploaded
+	void SetBool(const std::string& name, bool value);
+	void SetFloat(const std::string& name, float value);
+	void SetVec3(const std::string& name, const glm::vec3& value);
+
+	static UniformBufferArena& GetParametersArena();
 
 	inline uint64_t GetID() const { return m_ID; }
-	inline std::string GetName() const { return m_Name; }
+	inline const std::string& GetName() const { return m_Name; }
 	inline Ref<Shader> GetShader() const { return m_Shader; }
 
+private:
+	void WriteParameter(const std::string& name, const void* value, uint32_t size);
+
 	friend class MaterialEditorPanel;
 	friend class MaterialSerializer;
 };
\ No newline at end of file
@@ -83,8 +83,7 @@ Ref<Material> MaterialSerializer::Deserialize(std::string path)
 			std::string name = param["Name"].as<std::string>();
 			bool value = param["Value"].as<bool>();
 
-			if (material->m_BoolParameters.find(name) != material->m_BoolParameters.end())
-				material->m_BoolParameters.find(name)->second = value;
+			material->SetBool(name, value);
 		}
 	}
 
@@ -96,8 +95,7 @@ Ref<Material> MaterialSerializer::Deserialize(std::string path)
 			std::string name = param["Name"].as<std::string>();
 			float value = param["Value"].as<float>();
 			
-			if (material->m_FloatParameters.find(name) != material->m_FloatParameters.end())
-				material->m_FloatParameters.find(name)->second = value;
+			material->SetFloat(name, value);
 		}
 	}
 
@@ -109,8 +107,7 @@ Ref<Material> MaterialSerializer::Deserialize(std::string path)
 			std::string name = param["Name"].as<std::string>();
 			glm::vec3 value = param["Value"].as<glm::vec3>();
 
-			if (material->m_Vec3Parameters.find(name) != material->m_Vec3Parameters.end())
-				material->m_Vec3Parameters.find(name)->second = value;
+			material->SetVec3(name, value);
 
 		}
 	}
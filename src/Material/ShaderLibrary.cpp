@@ -1,5 +1,7 @@
 #include "ShaderLibrary.h"
 
+#include "Renderer/FrameBindings.h"
+
 Ref<ShaderLibrary> ShaderLibrary::s_Instance{};
 std::mutex ShaderLibrary::s_Mutex;
 
@@ -9,6 +11,9 @@ ShaderLibrary::ShaderLibrary()
 	m_MaterialShaders.insert(std::make_pair<std::string, Ref<Shader>>("StandardInstanced", CreateRef<Shader>("StandardInstanced", "res/shaders/Material/StandardInstanced.vert", "res/shaders/Material/Standard.frag")));
 	m_MaterialShaders.insert(std::make_pair<std::string, Ref<Shader>>("GrassInstanced", CreateRef<Shader>("GrassInstanced", "res/shaders/Material/StandardInstanced.vert", "res/shaders/Material/Grass.frag")));
 
+	for (auto& shader : m_MaterialShaders)
+		FrameBindings::AssignSamplers(*shader.second);
+
 	m_PostProcessingShaders.insert(std::make_pair<std::string, Ref<Shader>>("PostProcessing", CreateRef<Shader>("PostProcessing", "res/shaders/PostProcessing/PostProcessing.vert", "res/shaders/PostProcessing/PostProcessing.frag")));
 	m_PostProcessingShaders.insert(std::make_pair<std::string, Ref<Shader>>("Threshold", CreateRef<Shader>("Threshold", "res/shaders/PostProcessing/Threshold.vert", "res/shaders/PostProcessing/Threshold.frag")));
 	m_PostProcessingShaders.insert(std::make_pair<std::string, Ref<Shader>>("Downfilter", CreateRef<Shader>("Downfilter", "res/shaders/PostProcessing/PostProcessing.vert", "res/shaders/PostProcessing/Downfilter.frag")));
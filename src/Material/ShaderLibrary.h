@@ -26,7 +26,7 @@ public:
 	Ref<Shader> GetShader(ShaderType type, std::string name);
 
 	std::vector<Ref<Shader>> GetAllMaterialShaders();
-	inline std::unordered_map<std::string, Ref<Shader>> GetMaterialShaders() const { return m_MaterialShaders; }
+	inline const std::unordered_map<std::string, Ref<Shader>>& GetMaterialShaders() const { return m_MaterialShaders; }
 
 private:
 	static Ref<ShaderLibrary> s_Instance;
@@ -0,0 +1,92 @@
+#include "Bounds.h"
+
+#include <algorithm>
+
+AABB AABB::Merge(const AABB& a, const AABB& b)
+{
+	return AABB(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+}
+
+AABB AABB::Transformed(const glm::mat4& matrix) const
+{
+	// Arvo's method, each axis of the matrix moves the bounds by its contribution to the extents
+	glm::vec3 center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0f));
+	glm::vec3 extents = GetExtents();
+
+	glm::vec3 transformedExtents = glm::abs(glm::vec3(matrix[0])) * extents.x
+		+ glm::abs(glm::vec3(matrix[1])) * extents.y
+		+ glm::abs(glm::vec3(matrix[2])) * extents.z;
+
+	return AABB(center - transformedExtents, center + transformedExtents);
+}
+
+bool BoundingSphere::Intersects(const AABB& bounds) const
+{
+	glm::vec3 closest = glm::clamp(Center, bounds.Min, bounds.Max);
+	glm::vec3 offset = closest - Center;
+
+	return glm::dot(offset, offset) <= Radius * Radius;
+}
+
+float Ray::Intersect(const AABB& bounds, float maxDistance) const
+{
+	// Slab test, division by zero gives infinities which compare correctly
+	glm::vec3 inverseDirection = 1.0f / Direction;
+	glm::vec3 t0 = (bounds.Min - Origin) * inverseDirection;
+	glm::vec3 t1 = (bounds.Max - Origin) * inverseDirection;
+
+	glm::vec3 tMin = glm::min(t0, t1);
+	glm::vec3 tMax = glm::max(t0, t1);
+
+	float enter = std::max(std::max(tMin.x, tMin.y), std::max(tMin.z, 0.0f));
+	float exit = std::min(std::min(tMax.x, tMax.y), std::min(tMax.z, maxDistance));
+
+	return enter <= exit ? enter : -1.0f;
+}
+
+Frustum Frustum::FromMatrix(const glm::mat4& viewProjection)
+{
+	// Gribb-Hartmann, rows of the matrix combined with its last row
+	glm::mat4 m = glm::transpose(viewProjection);
+
+	Frustum frustum;
+	frustum.Planes[0] = m[3] + m[0];
+	frustum.Planes[1] = m[3] - m[0];
+	frustum.Planes[2] = m[3] + m[1];
+	frustum.Planes[3] = m[3] - m[1];
+	frustum.Planes[4] = m[3] + m[2];
+	frustum.Planes[5] = m[3] - m[2];
+
+	for (auto& plane : frustum.Planes)
+		plane /= glm::length(glm::vec3(plane));
+
+	return frustum;
+}
+
+bool Frustum::Intersects(const AABB& bounds) const
+{
+	for (auto& plane : Planes)
+	{
+		// Corner furthest along the plane normal
+		glm::vec3 positive = glm::vec3(
+			plane.x >= 0.0f ? bounds.Max.x : bounds.Min.x,
+			plane.y >= 0.0f ? bounds.Max.y : bounds.Min.y,
+			plane.z >= 0.0f ? bounds.Max.z : bounds.Min.z);
+
+		if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+			return false;
+	}
+
+	return true;
+}
+
+bool Frustum::Intersects(const BoundingSphere& sphere) const
+{
+	for (auto& plane : Planes)
+	{
+		if (glm::dot(glm::vec3(plane), sphere.Center) + plane.w < -sphere.Radius)
+			return false;
+	}
+
+	return true;
+}
\ No newline at end of file
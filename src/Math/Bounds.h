@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <glm/glm.hpp>
+
+struct AABB
+{
+	glm::vec3 Min = glm::vec3(std::numeric_limits<float>::max());
+	glm::vec3 Max = glm::vec3(-std::numeric_limits<float>::max());
+
+	AABB() = default;
+	AABB(glm::vec3 min, glm::vec3 max)
+		: Min(min), Max(max)
+	{
+	}
+
+	inline bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+	inline glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+	inline glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+	inline float GetSurfaceArea() const
+	{
+		glm::vec3 size = Max - Min;
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	inline void Expand(const glm::vec3& point)
+	{
+		Min = glm::min(Min, point);
+		Max = glm::max(Max, point);
+	}
+
+	inline void Expand(const AABB& other)
+	{
+		Min = glm::min(Min, other.Min);
+		Max = glm::max(Max, other.Max);
+	}
+
+	inline bool Contains(const AABB& other) const
+	{
+		return glm::all(glm::lessThanEqual(Min, other.Min)) && glm::all(glm::greaterThanEqual(Max, other.Max));
+	}
+
+	inline bool Intersects(const AABB& other) const
+	{
+		return glm::all(glm::lessThanEqual(Min, other.Max)) && glm::all(glm::greaterThanEqual(Max, other.Min));
+	}
+
+	inline bool operator==(const AABB& other) const { return Min == other.Min && Max == other.Max; }
+	inline bool operator!=(const AABB& other) const { return !(*this == other); }
+
+	static AABB Merge(const AABB& a, const AABB& b);
+	// Bounds of the box after transforming it, not the tightest bounds of the transformed geometry
+	AABB Transformed(const glm::mat4& matrix) const;
+};
+
+struct BoundingSphere
+{
+	glm::vec3 Center = glm::vec3(0.0f);
+	float Radius = 0.0f;
+
+	bool Intersects(const AABB& bounds) const;
+};
+
+struct Ray
+{
+	glm::vec3 Origin = glm::vec3(0.0f);
+	glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+
+	// Distance at which the ray enters the box, negative if it misses it or the box is further than maxDistance
+	float Intersect(const AABB& bounds, float maxDistance) const;
+};
+
+// Planes point inwards, xyz is the normal and w the distance
+struct Frustum
+{
+	std::array<glm::vec4, 6> Planes;
+
+	static Frustum FromMatrix(const glm::mat4& viewProjection);
+
+	bool Intersects(const AABB& bounds) const;
+	bool Intersects(const BoundingSphere& sphere) const;
+};
\ No newline at end of file
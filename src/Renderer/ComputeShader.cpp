@@ -1,6 +1,7 @@
 #include "ComputeShader.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 
 ComputeShader::ComputeShader(const char* path)
     : m_Uniforms(std::vector<ShaderUniform>())
@@ -24,145 +25,150 @@ ComputeShader::ComputeShader(const char* path)
     }
 
     uint32_t computeShader = CompileShader(source.c_str());
-    uint32_t shaderProgram = glCreateProgram();
-    glProgramParameteri(shaderProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
-    glAttachShader(shaderProgram, computeShader);
-    glLinkProgram(shaderProgram);
+    uint32_t shaderProgram = RenderDevice::Get().CreateProgram();
+    RenderDevice::Get().ProgramParameteri(shaderProgram, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    RenderDevice::Get().AttachShader(shaderProgram, computeShader);
+    RenderDevice::Get().LinkProgram(shaderProgram);
 
     int result;
     char infoLog[512];
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &result);
+    RenderDevice::Get().GetProgramiv(shaderProgram, GL_LINK_STATUS, &result);
     if (!result)
     {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+        RenderDevice::Get().GetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
         std::cout << "Shader program linking failed: " << infoLog << std::endl;
     }
 
-    glDeleteShader(computeShader);
+    RenderDevice::Get().DeleteShader(computeShader);
     m_ID = shaderProgram;
 
-    LoadUniforms();
+    m_UniformTable.Load(m_ID, m_Uniforms);
 }
 
 ComputeShader::~ComputeShader()
 {
-    glDeleteProgram(m_ID);
+    RenderDevice::Get().DeleteProgram(m_ID);
 }
 
 void ComputeShader::Use() const
 {
-    glUseProgram(m_ID);
+    RenderDevice::Get().UseProgram(m_ID);
+}
+
+void ComputeShader::SetBool(UniformID uniform, bool value) const
+{
+    int intValue = value;
+    int32_t location = m_UniformTable.Update(uniform, &intValue, sizeof(intValue));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1i(location, intValue);
 }
 
 void ComputeShader::SetBool(const std::string& name, bool value) const
 {
-    glUniform1i(glGetUniformLocation(m_ID, name.c_str()), (int)value);
+    SetBool(UniformName::Get(name), value);
+}
+
+void ComputeShader::SetInt(UniformID uniform, int value) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &value, sizeof(value));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1i(location, value);
 }
 
 void ComputeShader::SetInt(const std::string& name, int value) const
 {
-    glUniform1i(glGetUniformLocation(m_ID, name.c_str()), value);
+    SetInt(UniformName::Get(name), value);
+}
+
+void ComputeShader::SetUint(UniformID uniform, unsigned int value) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &value, sizeof(value));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1ui(location, value);
 }
 
 void ComputeShader::SetUint(const std::string& name, unsigned int value) const
 {
-    glUniform1ui(glGetUniformLocation(m_ID, name.c_str()), value);
+    SetUint(UniformName::Get(name), value);
+}
+
+void ComputeShader::SetFloat(UniformID uniform, float value) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &value, sizeof(value));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1f(location, value);
 }
 
 void ComputeShader::SetFloat(const std::string& name, float value) const
 {
-    glUniform1f(glGetUniformLocation(m_ID, name.c_str()), value);
+    SetFloat(UniformName::Get(name), value);
+}
+
+void ComputeShader::SetVec2(UniformID uniform, const glm::vec2& vec) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &vec, sizeof(vec));
+    if (location >= 0)
+        RenderDevice::Get().Uniform2f(location, vec.x, vec.y);
+}
+
+void ComputeShader::SetVec2(const std::string& name, const glm::vec2& vec) const
+{
+    SetVec2(UniformName::Get(name), vec);
+}
+
+void ComputeShader::SetVec3(UniformID uniform, const glm::vec3& vec) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &vec, sizeof(vec));
+    if (location >= 0)
+        RenderDevice::Get().Uniform3f(location, vec.x, vec.y, vec.z);
+}
+
+void ComputeShader::SetVec3(const std::string& name, const glm::vec3& vec) const
+{
+    SetVec3(UniformName::Get(name), vec);
 }
 
-void ComputeShader::SetVec2(const std::string& name, glm::vec2& vec) const
+void ComputeShader::SetVec4(UniformID uniform, const glm::vec4& vec) const
 {
-    glUniform2f(glGetUniformLocation(m_ID, name.c_str()), vec.x, vec.y);
+    int32_t location = m_UniformTable.Update(uniform, &vec, sizeof(vec));
+    if (location >= 0)
+        RenderDevice::Get().Uniform4f(location, vec.x, vec.y, vec.z, vec.w);
 }
 
-void ComputeShader::SetVec3(const std::string& name, glm::vec3& vec) const
+void ComputeShader::SetVec4(const std::string& name, const glm::vec4& vec) const
 {
-    glUniform3f(glGetUniformLocation(m_ID, name.c_str()), vec.x, vec.y, vec.z);
+    SetVec4(UniformName::Get(name), vec);
 }
 
-void ComputeShader::SetVec4(const std::string& name, glm::vec4& vec) const
+void ComputeShader::SetMat4(UniformID uniform, const glm::mat4& mat) const
 {
-    glUniform4f(glGetUniformLocation(m_ID, name.c_str()), vec.x, vec.y, vec.z, vec.w);
+    int32_t location = m_UniformTable.Update(uniform, &mat, sizeof(mat));
+    if (location >= 0)
+        RenderDevice::Get().UniformMatrix4fv(location, 1, GL_FALSE, &mat[0][0]);
 }
 
-void ComputeShader::SetMat4(const std::string& name, glm::mat4& mat) const
+void ComputeShader::SetMat4(const std::string& name, const glm::mat4& mat) const
 {
-    glUniformMatrix4fv(glGetUniformLocation(m_ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    SetMat4(UniformName::Get(name), mat);
 }
 
 unsigned int ComputeShader::CompileShader(const char* source)
 {
-    unsigned int shader = glCreateShader(GL_COMPUTE_SHADER);
-    glShaderSource(shader, 1, &source, nullptr);
-    glCompileShader(shader);
+    unsigned int shader = RenderDevice::Get().CreateShader(GL_COMPUTE_SHADER);
+    RenderDevice::Get().ShaderSource(shader, 1, &source, nullptr);
+    RenderDevice::Get().CompileShader(shader);
 
     int result;
     char infoLog[512];
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &result);
+    RenderDevice::Get().GetShaderiv(shader, GL_COMPILE_STATUS, &result);
     if (result == GL_FALSE)
     {
-        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        RenderDevice::Get().GetShaderInfoLog(shader, 512, NULL, infoLog);
         std::cout << "Compute Shader compilation failed : ";
         std::cout << infoLog << std::endl;
-        glDeleteShader(shader);
+        RenderDevice::Get().DeleteShader(shader);
         return 0;
     }
 
     return shader;
-}
-
-void ComputeShader::LoadUniforms()
-{
-    m_Uniforms.clear();
-
-    GLint uniformsCount;
-    glGetProgramiv(m_ID, GL_ACTIVE_UNIFORMS, &uniformsCount);
-
-    GLsizei length;
-    GLint size;
-    GLenum type;
-    GLchar uniformName[32];
-    for (GLuint i = 0; i < uniformsCount; i++)
-    {
-        glGetActiveUniform(m_ID, i, 32, &length, &size, &type, uniformName);
-
-        ShaderUniform uniform;
-        uniform.name = uniformName;
-        switch (type)
-        {
-        case GL_BOOL:
-            uniform.type = ShaderUniformType::BOOL;
-            break;
-        case GL_INT:
-            uniform.type = ShaderUniformType::INT;
-            break;
-        case GL_FLOAT:
-            uniform.type = ShaderUniformType::FLOAT;
-            break;
-        case GL_FLOAT_VEC3:
-            uniform.type = ShaderUniformType::VEC3;
-            break;
-        case GL_FLOAT_VEC4:
-            uniform.type = ShaderUniformType::VEC4;
-            break;
-        case GL_FLOAT_MAT3:
-            uniform.type = ShaderUniformType::MAT3;
-            break;
-        case GL_FLOAT_MAT4:
-            uniform.type = ShaderUniformType::MAT4;
-            break;
-        case GL_SAMPLER_2D:
-            uniform.type = ShaderUniformType::SAMPLER_2D;
-            break;
-        case GL_SAMPLER_CUBE:
-            uniform.type = ShaderUniformType::SAMPLER_CUBE;
-            break;
-        }
-
-        m_Uniforms.push_back(uniform);
-    }
-}
+}
\ No newline at end of file
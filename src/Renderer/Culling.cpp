@@ -0,0 +1,188 @@
+#include "Culling.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <immintrin.h>
+	#define CULLING_SSE
+
+	// Only the 8-wide kernel is compiled for AVX, it is called once CPUID reports support
+	// so the engine still runs on CPUs without it
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define CULLING_AVX_TARGET
+	#else
+		#define CULLING_AVX_TARGET __attribute__((target("avx")))
+	#endif
+#endif
+
+void CullingBounds::Clear()
+{
+	MinX.clear(); MinY.clear(); MinZ.clear();
+	MaxX.clear(); MaxY.clear(); MaxZ.clear();
+}
+
+void CullingBounds::Reserve(size_t count)
+{
+	MinX.reserve(count); MinY.reserve(count); MinZ.reserve(count);
+	MaxX.reserve(count); MaxY.reserve(count); MaxZ.reserve(count);
+}
+
+void CullingBounds::Add(const AABB& bounds)
+{
+	MinX.push_back(bounds.Min.x); MinY.push_back(bounds.Min.y); MinZ.push_back(bounds.Min.z);
+	MaxX.push_back(bounds.Max.x); MaxY.push_back(bounds.Max.y); MaxZ.push_back(bounds.Max.z);
+}
+
+namespace
+{
+	// Per plane, the box corner furthest along the normal only depends on the normal's signs,
+	// so the arrays to read it from are picked once instead of per box
+	struct CullingPlane
+	{
+		const float* X;
+		const float* Y;
+		const float* Z;
+		glm::vec4 Plane;
+	};
+
+#if defined(CULLING_SSE)
+	bool HasAVX()
+	{
+#if defined(_MSC_VER)
+		// AVX itself, and the OS saving the YMM registers through XSAVE
+		int info[4];
+		__cpuid(info, 1);
+		if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)))
+			return false;
+
+		return (_xgetbv(0) & 6) == 6;
+#else
+		return __builtin_cpu_supports("avx");
+#endif
+	}
+
+	const bool s_HasAVX = HasAVX();
+
+	// Each kernel tests boxes from i while a whole vector of them is left and returns where it stopped
+	size_t FrustumCullSSE(const CullingPlane* planes, size_t i, size_t count, uint8_t* visible, uint32_t& visibleCount)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 outside = _mm_setzero_ps();
+			for (int p = 0; p < 6; p++)
+			{
+				const CullingPlane& plane = planes[p];
+				// Summed in the same order as the scalar loop, so a box on a plane gets the same answer on every path
+				__m128 distance = _mm_mul_ps(_mm_set1_ps(plane.Plane.x), _mm_loadu_ps(plane.X + i));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.Plane.y), _mm_loadu_ps(plane.Y + i)));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.Plane.z), _mm_loadu_ps(plane.Z + i)));
+				distance = _mm_add_ps(distance, _mm_set1_ps(plane.Plane.w));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+			}
+
+			int mask = _mm_movemask_ps(outside);
+			for (int j = 0; j < 4; j++)
+			{
+				visible[i + j] = !((mask >> j) & 1);
+				visibleCount += visible[i + j];
+			}
+		}
+
+		return i;
+	}
+
+	CULLING_AVX_TARGET size_t FrustumCullAVX(const CullingPlane* planes, size_t i, size_t count, uint8_t* visible, uint32_t& visibleCount)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 outside = _mm256_setzero_ps();
+			for (int p = 0; p < 6; p++)
+			{
+				const CullingPlane& plane = planes[p];
+				__m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.Plane.x), _mm256_loadu_ps(plane.X + i));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.Plane.y), _mm256_loadu_ps(plane.Y + i)));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.Plane.z), _mm256_loadu_ps(plane.Z + i)));
+				distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.Plane.w));
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, zero, _CMP_LT_OQ));
+			}
+
+			int mask = _mm256_movemask_ps(outside);
+			for (int j = 0; j < 8; j++)
+			{
+				visible[i + j] = !((mask >> j) & 1);
+				visibleCount += visible[i + j];
+			}
+		}
+
+		// Avoids the penalty of mixing AVX and SSE code
+		_mm256_zeroupper();
+
+		return i;
+	}
+#endif
+}
+
+uint32_t Culling::FrustumCull(const Frustum& frustum, const CullingBounds& bounds, uint8_t* visible)
+{
+	CullingPlane planes[6];
+	for (int p = 0; p < 6; p++)
+	{
+		const glm::vec4& plane = frustum.Planes[p];
+		planes[p].X = plane.x >= 0.0f ? bounds.MaxX.data() : bounds.MinX.data();
+		planes[p].Y = plane.y >= 0.0f ? bounds.MaxY.data() : bounds.MinY.data();
+		planes[p].Z = plane.z >= 0.0f ? bounds.MaxZ.data() : bounds.MinZ.data();
+		planes[p].Plane = plane;
+	}
+
+	size_t count = bounds.Size();
+	size_t i = 0;
+	uint32_t visibleCount = 0;
+
+#if defined(CULLING_SSE)
+	if (s_HasAVX)
+		i = FrustumCullAVX(planes, i, count, visible, visibleCount);
+
+	i = FrustumCullSSE(planes, i, count, visible, visibleCount);
+#endif
+
+	// Scalar fallback and the remainder of the vector loops
+	for (; i < count; i++)
+	{
+		bool inside = true;
+		for (auto& p : planes)
+		{
+			if (p.Plane.x * p.X[i] + p.Plane.y * p.Y[i] + p.Plane.z * p.Z[i] + p.Plane.w < 0.0f)
+			{
+				inside = false;
+				break;
+			}
+		}
+
+		visible[i] = inside;
+		visibleCount += inside;
+	}
+
+	return visibleCount;
+}
+
+uint32_t Culling::SphereCull(const BoundingSphere& sphere, const CullingBounds& bounds, uint8_t* visible)
+{
+	float radiusSquared = sphere.Radius * sphere.Radius;
+	uint32_t visibleCount = 0;
+
+	for (size_t i = 0; i < bounds.Size(); i++)
+	{
+		float dx = std::max(std::max(bounds.MinX[i] - sphere.Center.x, sphere.Center.x - bounds.MaxX[i]), 0.0f);
+		float dy = std::max(std::max(bounds.MinY[i] - sphere.Center.y, sphere.Center.y - bounds.MaxY[i]), 0.0f);
+		float dz = std::max(std::max(bounds.MinZ[i] - sphere.Center.z, sphere.Center.z - bounds.MaxZ[i]), 0.0f);
+
+		bool inside = dx * dx + dy * dy + dz * dz <= radiusSquared;
+		visible[i] = inside;
+		visibleCount += inside;
+	}
+
+	return visibleCount;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Math/Bounds.h"
+
+// World bounds kept as separate arrays per component, so several boxes can be tested at once
+struct CullingBounds
+{
+	std::vector<float> MinX, MinY, MinZ;
+	std::vector<float> MaxX, MaxY, MaxZ;
+
+	inline size_t Size() const { return MinX.size(); }
+
+	void Clear();
+	void Reserve(size_t count);
+	void Add(const AABB& bounds);
+};
+
+struct CullingStats
+{
+	uint32_t Tested = 0;
+	uint32_t Culled = 0;
+	uint32_t Drawn = 0;
+
+	// Summed over every shadow casting light
+	uint32_t ShadowCastersTested = 0;
+	uint32_t ShadowCastersDrawn = 0;
+};
+
+namespace Culling
+{
+	// Sets visible[i] to 1 for every box at least partially inside the frustum, returns how many are
+	uint32_t FrustumCull(const Frustum& frustum, const CullingBounds& bounds, uint8_t* visible);
+	// Same for the boxes overlapping the sphere, used for point lights
+	uint32_t SphereCull(const BoundingSphere& sphere, const CullingBounds& bounds, uint8_t* visible);
+}
\ No newline at end of file
@@ -0,0 +1,413 @@
+#include "GLRenderDevice.h"
+
+#include <glad/glad.h>
+
+void GLRenderDevice::ActiveTexture(uint32_t texture)
+{
+	glActiveTexture(texture);
+}
+
+void GLRenderDevice::AttachShader(uint32_t program, uint32_t shader)
+{
+	glAttachShader(program, shader);
+}
+
+void GLRenderDevice::BindBuffer(uint32_t target, uint32_t buffer)
+{
+	glBindBuffer(target, buffer);
+}
+
+void GLRenderDevice::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer)
+{
+	glBindBufferBase(target, index, buffer);
+}
+
+void GLRenderDevice::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset, ptrdiff_t size)
+{
+	glBindBufferRange(target, index, buffer, offset, size);
+}
+
+void GLRenderDevice::BindFramebuffer(uint32_t target, uint32_t framebuffer)
+{
+	glBindFramebuffer(target, framebuffer);
+}
+
+void GLRenderDevice::BindRenderbuffer(uint32_t target, uint32_t renderbuffer)
+{
+	glBindRenderbuffer(target, renderbuffer);
+}
+
+void GLRenderDevice::BindTexture(uint32_t target, uint32_t texture)
+{
+	glBindTexture(target, texture);
+}
+
+void GLRenderDevice::BindVertexArray(uint32_t array)
+{
+	glBindVertexArray(array);
+}
+
+void GLRenderDevice::BlendFunc(uint32_t sourceFactor, uint32_t destinationFactor)
+{
+	glBlendFunc(sourceFactor, destinationFactor);
+}
+
+void GLRenderDevice::BufferData(uint32_t target, ptrdiff_t size, const void* data, uint32_t usage)
+{
+	glBufferData(target, size, data, usage);
+}
+
+void GLRenderDevice::BufferSubData(uint32_t target, ptrdiff_t offset, ptrdiff_t size, const void* data)
+{
+	glBufferSubData(target, offset, size, data);
+}
+
+uint32_t GLRenderDevice::CheckFramebufferStatus(uint32_t target)
+{
+	return glCheckFramebufferStatus(target);
+}
+
+void GLRenderDevice::Clear(uint32_t mask)
+{
+	glClear(mask);
+}
+
+void GLRenderDevice::ClearColor(float red, float green, float blue, float alpha)
+{
+	glClearColor(red, green, blue, alpha);
+}
+
+void GLRenderDevice::CompileShader(uint32_t shader)
+{
+	glCompileShader(shader);
+}
+
+void GLRenderDevice::CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, ptrdiff_t readOffset, ptrdiff_t writeOffset, ptrdiff_t size)
+{
+	glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+void GLRenderDevice::CopyImageSubData(uint32_t sourceName, uint32_t sourceTarget, int32_t sourceLevel, int32_t sourceX, int32_t sourceY, int32_t sourceZ, uint32_t destinationName, uint32_t destinationTarget, int32_t destinationLevel, int32_t destinationX, int32_t destinationY, int32_t destinationZ, int32_t width, int32_t height, int32_t depth)
+{
+	glCopyImageSubData(sourceName, sourceTarget, sourceLevel, sourceX, sourceY, sourceZ, destinationName, destinationTarget, destinationLevel, destinationX, destinationY, destinationZ, width, height, depth);
+}
+
+uint32_t GLRenderDevice::CreateProgram()
+{
+	return glCreateProgram();
+}
+
+uint32_t GLRenderDevice::CreateShader(uint32_t type)
+{
+	return glCreateShader(type);
+}
+
+void GLRenderDevice::CullFace(uint32_t mode)
+{
+	glCullFace(mode);
+}
+
+void GLRenderDevice::DeleteBuffers(int32_t count, const uint32_t* buffers)
+{
+	glDeleteBuffers(count, buffers);
+}
+
+void GLRenderDevice::DeleteFramebuffers(int32_t count, const uint32_t* framebuffers)
+{
+	glDeleteFramebuffers(count, framebuffers);
+}
+
+void GLRenderDevice::DeleteProgram(uint32_t program)
+{
+	glDeleteProgram(program);
+}
+
+void GLRenderDevice::DeleteRenderbuffers(int32_t count, const uint32_t* renderbuffers)
+{
+	glDeleteRenderbuffers(count, renderbuffers);
+}
+
+void GLRenderDevice::DeleteShader(uint32_t shader)
+{
+	glDeleteShader(shader);
+}
+
+void GLRenderDevice::DeleteTextures(int32_t count, const uint32_t* textures)
+{
+	glDeleteTextures(count, textures);
+}
+
+void GLRenderDevice::DeleteVertexArrays(int32_t count, const uint32_t* arrays)
+{
+	glDeleteVertexArrays(count, arrays);
+}
+
+void GLRenderDevice::DepthFunc(uint32_t function)
+{
+	glDepthFunc(function);
+}
+
+void GLRenderDevice::Disable(uint32_t capability)
+{
+	glDisable(capability);
+}
+
+void GLRenderDevice::DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+{
+	glDispatchCompute(groupsX, groupsY, groupsZ);
+}
+
+void GLRenderDevice::DrawArrays(uint32_t mode, int32_t first, int32_t count)
+{
+	glDrawArrays(mode, first, count);
+}
+
+void GLRenderDevice::DrawBuffer(uint32_t buffer)
+{
+	glDrawBuffer(buffer);
+}
+
+void GLRenderDevice::DrawElements(uint32_t mode, int32_t count, uint32_t type, const void* indices)
+{
+	glDrawElements(mode, count, type, indices);
+}
+
+void GLRenderDevice::DrawElementsBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t baseVertex)
+{
+	glDrawElementsBaseVertex(mode, count, type, indices, baseVertex);
+}
+
+void GLRenderDevice::DrawElementsInstanced(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances)
+{
+	glDrawElementsInstanced(mode, count, type, indices, instances);
+}
+
+void GLRenderDevice::DrawElementsInstancedBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances, int32_t baseVertex)
+{
+	glDrawElementsInstancedBaseVertex(mode, count, type, indices, instances, baseVertex);
+}
+
+void GLRenderDevice::Enable(uint32_t capability)
+{
+	glEnable(capability);
+}
+
+void GLRenderDevice::EnableVertexAttribArray(uint32_t index)
+{
+	glEnableVertexAttribArray(index);
+}
+
+void GLRenderDevice::FramebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbufferTarget, uint32_t renderbuffer)
+{
+	glFramebufferRenderbuffer(target, attachment, renderbufferTarget, renderbuffer);
+}
+
+void GLRenderDevice::FramebufferTexture(uint32_t target, uint32_t attachment, uint32_t texture, int32_t level)
+{
+	glFramebufferTexture(target, attachment, texture, level);
+}
+
+void GLRenderDevice::FramebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textureTarget, uint32_t texture, int32_t level)
+{
+	glFramebufferTexture2D(target, attachment, textureTarget, texture, level);
+}
+
+void GLRenderDevice::GenBuffers(int32_t count, uint32_t* buffers)
+{
+	glGenBuffers(count, buffers);
+}
+
+void GLRenderDevice::GenFramebuffers(int32_t count, uint32_t* framebuffers)
+{
+	glGenFramebuffers(count, framebuffers);
+}
+
+void GLRenderDevice::GenRenderbuffers(int32_t count, uint32_t* renderbuffers)
+{
+	glGenRenderbuffers(count, renderbuffers);
+}
+
+void GLRenderDevice::GenTextures(int32_t count, uint32_t* textures)
+{
+	glGenTextures(count, textures);
+}
+
+void GLRenderDevice::GenVertexArrays(int32_t count, uint32_t* arrays)
+{
+	glGenVertexArrays(count, arrays);
+}
+
+void GLRenderDevice::GenerateMipmap(uint32_t target)
+{
+	glGenerateMipmap(target);
+}
+
+void GLRenderDevice::GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name)
+{
+	glGetActiveUniform(program, index, bufferSize, length, size, type, name);
+}
+
+void GLRenderDevice::GetActiveUniformBlockiv(uint32_t program, uint32_t blockIndex, uint32_t parameter, int32_t* value)
+{
+	glGetActiveUniformBlockiv(program, blockIndex, parameter, value);
+}
+
+void GLRenderDevice::GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values)
+{
+	glGetActiveUniformsiv(program, count, indices, parameter, values);
+}
+
+uint32_t GLRenderDevice::GetError()
+{
+	return glGetError();
+}
+
+void GLRenderDevice::GetProgramInfoLog(uint32_t program, int32_t bufferSize, int32_t* length, char* infoLog)
+{
+	glGetProgramInfoLog(program, bufferSize, length, infoLog);
+}
+
+void GLRenderDevice::GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value)
+{
+	glGetProgramiv(program, parameter, value);
+}
+
+void GLRenderDevice::GetShaderInfoLog(uint32_t shader, int32_t bufferSize, int32_t* length, char* infoLog)
+{
+	glGetShaderInfoLog(shader, bufferSize, length, infoLog);
+}
+
+void GLRenderDevice::GetShaderiv(uint32_t shader, uint32_t parameter, int32_t* value)
+{
+	glGetShaderiv(shader, parameter, value);
+}
+
+uint32_t GLRenderDevice::GetUniformBlockIndex(uint32_t program, const char* name)
+{
+	return glGetUniformBlockIndex(program, name);
+}
+
+int32_t GLRenderDevice::GetUniformLocation(uint32_t program, const char* name)
+{
+	return glGetUniformLocation(program, name);
+}
+
+void GLRenderDevice::LinkProgram(uint32_t program)
+{
+	glLinkProgram(program);
+}
+
+void* GLRenderDevice::MapBufferRange(uint32_t target, ptrdiff_t offset, ptrdiff_t length, uint32_t access)
+{
+	return glMapBufferRange(target, offset, length, access);
+}
+
+void GLRenderDevice::MemoryBarrierBits(uint32_t barriers)
+{
+	glMemoryBarrier(barriers);
+}
+
+void GLRenderDevice::MultiDrawElementsIndirect(uint32_t mode, uint32_t type, const void* indirect, int32_t drawCount, int32_t stride)
+{
+	glMultiDrawElementsIndirect(mode, type, indirect, drawCount, stride);
+}
+
+void GLRenderDevice::ProgramParameteri(uint32_t program, uint32_t parameter, int32_t value)
+{
+	glProgramParameteri(program, parameter, value);
+}
+
+void GLRenderDevice::ReadBuffer(uint32_t buffer)
+{
+	glReadBuffer(buffer);
+}
+
+void GLRenderDevice::RenderbufferStorage(uint32_t target, uint32_t internalFormat, int32_t width, int32_t height)
+{
+	glRenderbufferStorage(target, internalFormat, width, height);
+}
+
+void GLRenderDevice::ShaderSource(uint32_t shader, int32_t count, const char* const* sources, const int32_t* lengths)
+{
+	glShaderSource(shader, count, sources, lengths);
+}
+
+void GLRenderDevice::TexImage2D(uint32_t target, int32_t level, int32_t internalFormat, int32_t width, int32_t height, int32_t border, uint32_t format, uint32_t type, const void* pixels)
+{
+	glTexImage2D(target, level, internalFormat, width, height, border, format, type, pixels);
+}
+
+void GLRenderDevice::TexParameterfv(uint32_t target, uint32_t parameter, const float* values)
+{
+	glTexParameterfv(target, parameter, values);
+}
+
+void GLRenderDevice::TexParameteri(uint32_t target, uint32_t parameter, int32_t value)
+{
+	glTexParameteri(target, parameter, value);
+}
+
+void GLRenderDevice::Uniform1f(int32_t location, float x)
+{
+	glUniform1f(location, x);
+}
+
+void GLRenderDevice::Uniform1i(int32_t location, int32_t x)
+{
+	glUniform1i(location, x);
+}
+
+void GLRenderDevice::Uniform1ui(int32_t location, uint32_t x)
+{
+	glUniform1ui(location, x);
+}
+
+void GLRenderDevice::Uniform2f(int32_t location, float x, float y)
+{
+	glUniform2f(location, x, y);
+}
+
+void GLRenderDevice::Uniform3f(int32_t location, float x, float y, float z)
+{
+	glUniform3f(location, x, y, z);
+}
+
+void GLRenderDevice::Uniform4f(int32_t location, float x, float y, float z, float w)
+{
+	glUniform4f(location, x, y, z, w);
+}
+
+void GLRenderDevice::UniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float* values)
+{
+	glUniformMatrix4fv(location, count, transpose ? GL_TRUE : GL_FALSE, values);
+}
+
+bool GLRenderDevice::UnmapBuffer(uint32_t target)
+{
+	return glUnmapBuffer(target) == GL_TRUE;
+}
+
+void GLRenderDevice::UseProgram(uint32_t program)
+{
+	glUseProgram(program);
+}
+
+void GLRenderDevice::VertexAttribDivisor(uint32_t index, uint32_t divisor)
+{
+	glVertexAttribDivisor(index, divisor);
+}
+
+void GLRenderDevice::VertexAttribIPointer(uint32_t index, int32_t size, uint32_t type, int32_t stride, const void* offset)
+{
+	glVertexAttribIPointer(index, size, type, stride, offset);
+}
+
+void GLRenderDevice::VertexAttribPointer(uint32_t index, int32_t size, uint32_t type, bool normalized, int32_t stride, const void* offset)
+{
+	glVertexAttribPointer(index, size, type, normalized ? GL_TRUE : GL_FALSE, stride, offset);
+}
+
+void GLRenderDevice::Viewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	glViewport(x, y, width, height);
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "RenderDevice.h"
+
+// Forwards every command to the OpenGL context current on the calling thread
+class GLRenderDevice : public RenderDevice
+{
+public:
+	virtual void ActiveTexture(uint32_t texture) override;
+	virtual void AttachShader(uint32_t program, uint32_t shader) override;
+	virtual void BindBuffer(uint32_t target, uint32_t buffer) override;
+	virtual void BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) override;
+	virtual void BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset, ptrdiff_t size) override;
+	virtual void BindFramebuffer(uint32_t target, uint32_t framebuffer) override;
+	virtual void BindRenderbuffer(uint32_t target, uint32_t renderbuffer) override;
+	virtual void BindTexture(uint32_t target, uint32_t texture) override;
+	virtual void BindVertexArray(uint32_t array) override;
+	virtual void BlendFunc(uint32_t sourceFactor, uint32_t destinationFactor) override;
+	virtual void BufferData(uint32_t target, ptrdiff_t size, const void* data, uint32_t usage) override;
+	virtual void BufferSubData(uint32_t target, ptrdiff_t offset, ptrdiff_t size, const void* data) override;
+	virtual uint32_t CheckFramebufferStatus(uint32_t target) override;
+	virtual void Clear(uint32_t mask) override;
+	virtual void ClearColor(float red, float green, float blue, float alpha) override;
+	virtual void CompileShader(uint32_t shader) override;
+	virtual void CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, ptrdiff_t readOffset, ptrdiff_t writeOffset, ptrdiff_t size) override;
+	virtual void CopyImageSubData(uint32_t sourceName, uint32_t sourceTarget, int32_t sourceLevel, int32_t sourceX, int32_t sourceY, int32_t sourceZ, uint32_t destinationName, uint32_t destinationTarget, int32_t destinationLevel, int32_t destinationX, int32_t destinationY, int32_t destinationZ, int32_t width, int32_t height, int32_t depth) override;
+	virtual uint32_t CreateProgram() override;
+	virtual uint32_t CreateShader(uint32_t type) override;
+	virtual void CullFace(uint32_t mode) override;
+	virtual void DeleteBuffers(int32_t count, const uint32_t* buffers) override;
+	virtual void DeleteFramebuffers(int32_t count, const uint32_t* framebuffers) override;
+	virtual void DeleteProgram(uint32_t program) override;
+	virtual void DeleteRenderbuffers(int32_t count, const uint32_t* renderbuffers) override;
+	virtual void DeleteShader(uint32_t shader) override;
+	virtual void DeleteTextures(int32_t count, const uint32_t* textures) override;
+	virtual void DeleteVertexArrays(int32_t count, const uint32_t* arrays) override;
+	virtual void DepthFunc(uint32_t function) override;
+	virtual void Disable(uint32_t capability) override;
+	virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) override;
+	virtual void DrawArrays(uint32_t mode, int32_t first, int32_t count) override;
+	virtual void DrawBuffer(uint32_t buffer) override;
+	virtual void DrawElements(uint32_t mode, int32_t count, uint32_t type, const void* indices) override;
+	virtual void DrawElementsBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t baseVertex) override;
+	virtual void DrawElementsInstanced(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances) override;
+	virtual void DrawElementsInstancedBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances, int32_t baseVertex) override;
+	virtual void Enable(uint32_t capability) override;
+	virtual void EnableVertexAttribArray(uint32_t index) override;
+	virtual void FramebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbufferTarget, uint32_t renderbuffer) override;
+	virtual void FramebufferTexture(uint32_t target, uint32_t attachment, uint32_t texture, int32_t level) override;
+	virtual void FramebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textureTarget, uint32_t texture, int32_t level) override;
+	virtual void GenBuffers(int32_t count, uint32_t* buffers) override;
+	virtual void GenFramebuffers(int32_t count, uint32_t* framebuffers) override;
+	virtual void GenRenderbuffers(int32_t count, uint32_t* renderbuffers) override;
+	virtual void GenTextures(int32_t count, uint32_t* textures) override;
+	virtual void GenVertexArrays(int32_t count, uint32_t* arrays) override;
+	virtual void GenerateMipmap(uint32_t target) override;
+	virtual void GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name) override;
+	virtual void GetActiveUniformBlockiv(uint32_t program, uint32_t blockIndex, uint32_t parameter, int32_t* value) override;
+	virtual void GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values) override;
+	virtual uint32_t GetError() override;
+	virtual void GetProgramInfoLog(uint32_t program, int32_t bufferSize, int32_t* length, char* infoLog) override;
+	virtual void GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value) override;
+	virtual void GetShaderInfoLog(uint32_t shader, int32_t bufferSize, int32_t* length, char* infoLog) override;
+	virtual void GetShaderiv(uint32_t shader, uint32_t parameter, int32_t* value) override;
+	virtual uint32_t GetUniformBlockIndex(uint32_t program, const char* name) override;
+	virtual int32_t GetUniformLocation(uint32_t program, const char* name) override;
+	virtual void LinkProgram(uint32_t program) override;
+	virtual void* MapBufferRange(uint32_t target, ptrdiff_t offset, ptrdiff_t length, uint32_t access) override;
+	virtual void MemoryBarrierBits(uint32_t barriers) override;
+	virtual void MultiDrawElementsIndirect(uint32_t mode, uint32_t type, const void* indirect, int32_t drawCount, int32_t stride) override;
+	virtual void ProgramParameteri(uint32_t program, uint32_t parameter, int32_t value) override;
+	virtual void ReadBuffer(uint32_t buffer) override;
+	virtual void RenderbufferStorage(uint32_t target, uint32_t internalFormat, int32_t width, int32_t height) override;
+	virtual void ShaderSource(uint32_t shader, int32_t count, const char* const* sources, const int32_t* lengths) override;
+	virtual void TexImage2D(uint32_t target, int32_t level, int32_t internalFormat, int32_t width, int32_t height, int32_t border, uint32_t format, uint32_t type, const void* pixels) override;
+	virtual void TexParameterfv(uint32_t target, uint32_t parameter, const float* values) override;
+	virtual void TexParameteri(uint32_t target, uint32_t parameter, int32_t value) override;
+	virtual void Uniform1f(int32_t location, float x) override;
+	virtual void Uniform1i(int32_t location, int32_t x) override;
+	virtual void Uniform1ui(int32_t location, uint32_t x) override;
+	virtual void Uniform2f(int32_t location, float x, float y) override;
+	virtual void Uniform3f(int32_t location, float x, float y, float z) override;
+	virtual void Uniform4f(int32_t location, float x, float y, float z, float w) override;
+	virtual void UniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float* values) override;
+	virtual bool UnmapBuffer(uint32_t target) override;
+	virtual void UseProgram(uint32_t program) override;
+	virtual void VertexAttribDivisor(uint32_t index, uint32_t divisor) override;
+	virtual void VertexAttribIPointer(uint32_t index, int32_t size, uint32_t type, int32_t stride, const void* offset) override;
+	virtual void VertexAttribPointer(uint32_t index, int32_t size, uint32_t type, bool normalized, int32_t stride, const void* offset) override;
+	virtual void Viewport(int32_t x, int32_t y, int32_t width, int32_t height) override;
+};
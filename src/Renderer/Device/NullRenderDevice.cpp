@@ -0,0 +1,720 @@
+#include "NullRenderDevice.h"
+
+#include <glad/glad.h>
+
+static const char* s_DeviceCallNames[] =
+{
+	"ActiveTexture",
+	"AttachShader",
+	"BindBuffer",
+	"BindBufferBase",
+	"BindBufferRange",
+	"BindFramebuffer",
+	"BindRenderbuffer",
+	"BindTexture",
+	"BindVertexArray",
+	"BlendFunc",
+	"BufferData",
+	"BufferSubData",
+	"CheckFramebufferStatus",
+	"Clear",
+	"ClearColor",
+	"CompileShader",
+	"CopyBufferSubData",
+	"CopyImageSubData",
+	"CreateProgram",
+	"CreateShader",
+	"CullFace",
+	"DeleteBuffers",
+	"DeleteFramebuffers",
+	"DeleteProgram",
+	"DeleteRenderbuffers",
+	"DeleteShader",
+	"DeleteTextures",
+	"DeleteVertexArrays",
+	"DepthFunc",
+	"Disable",
+	"DispatchCompute",
+	"DrawArrays",
+	"DrawBuffer",
+	"DrawElements",
+	"DrawElementsBaseVertex",
+	"DrawElementsInstanced",
+	"DrawElementsInstancedBaseVertex",
+	"Enable",
+	"EnableVertexAttribArray",
+	"FramebufferRenderbuffer",
+	"FramebufferTexture",
+	"FramebufferTexture2D",
+	"GenBuffers",
+	"GenFramebuffers",
+	"GenRenderbuffers",
+	"GenTextures",
+	"GenVertexArrays",
+	"GenerateMipmap",
+	"GetActiveUniform",
+	"GetActiveUniformBlockiv",
+	"GetActiveUniformsiv",
+	"GetError",
+	"GetProgramInfoLog",
+	"GetProgramiv",
+	"GetShaderInfoLog",
+	"GetShaderiv",
+	"GetUniformBlockIndex",
+	"GetUniformLocation",
+	"LinkProgram",
+	"MapBufferRange",
+	"MemoryBarrierBits",
+	"MultiDrawElementsIndirect",
+	"ProgramParameteri",
+	"ReadBuffer",
+	"RenderbufferStorage",
+	"ShaderSource",
+	"TexImage2D",
+	"TexParameterfv",
+	"TexParameteri",
+	"Uniform1f",
+	"Uniform1i",
+	"Uniform1ui",
+	"Uniform2f",
+	"Uniform3f",
+	"Uniform4f",
+	"UniformMatrix4fv",
+	"UnmapBuffer",
+	"UseProgram",
+	"VertexAttribDivisor",
+	"VertexAttribIPointer",
+	"VertexAttribPointer",
+	"Viewport"};
+
+static_assert(sizeof(s_DeviceCallNames) / sizeof(s_DeviceCallNames[0]) == (size_t)DeviceCall::COUNT);
+
+const char* GetDeviceCallName(DeviceCall call)
+{
+	return s_DeviceCallNames[(size_t)call];
+}
+
+void NullRenderDevice::Reset()
+{
+	m_CallsCount = 0;
+	m_CallCounts.fill(0);
+	m_Trace.clear();
+	m_Errors.clear();
+}
+
+size_t NullRenderDevice::GetLiveObjectsCount() const
+{
+	size_t count = 0;
+	for (const ObjectPool& pool : m_Objects)
+		count += pool.Live.size();
+
+	return count;
+}
+
+void NullRenderDevice::WriteTrace(std::ostream& out) const
+{
+	for (const RecordedCall& call : m_Trace)
+	{
+		out << GetDeviceCallName(call.Call);
+		for (uint8_t i = 0; i < call.ArgsCount; i++)
+			out << ' ' << call.Args[i];
+		out << '\n';
+	}
+}
+
+void NullRenderDevice::WriteCallCounts(std::ostream& out) const
+{
+	for (size_t i = 0; i < m_CallCounts.size(); i++)
+	{
+		if (m_CallCounts[i])
+			out << s_DeviceCallNames[i] << ' ' << m_CallCounts[i] << '\n';
+	}
+}
+
+void NullRenderDevice::Record(DeviceCall call, std::initializer_list<double> args)
+{
+	m_CallsCount++;
+	m_CallCounts[(size_t)call]++;
+
+	if (!m_Recording)
+		return;
+
+	RecordedCall& recorded = m_Trace.emplace_back();
+	recorded.Call = call;
+	recorded.ArgsCount = 0;
+	for (double arg : args)
+	{
+		if (recorded.ArgsCount == MAX_RECORDED_CALL_ARGS)
+			break;
+		recorded.Args[recorded.ArgsCount++] = arg;
+	}
+}
+
+void NullRenderDevice::Error(DeviceCall call, const std::string& message)
+{
+	// Errors are raised before the call is counted, so the index is the one the call is about to get
+	m_Errors.push_back("#" + std::to_string(m_CallsCount) + " " + GetDeviceCallName(call) + ": " + message);
+}
+
+uint32_t NullRenderDevice::Create(ObjectType type)
+{
+	ObjectPool& pool = m_Objects[(size_t)type];
+	uint32_t id = pool.NextID++;
+	pool.Live.insert(id);
+	return id;
+}
+
+void NullRenderDevice::Destroy(DeviceCall call, ObjectType type, uint32_t id)
+{
+	// Deleting name 0 is silently ignored by OpenGL
+	if (id == 0)
+		return;
+
+	if (!m_Objects[(size_t)type].Live.erase(id))
+		Error(call, "deleting unknown object " + std::to_string(id));
+}
+
+void NullRenderDevice::Validate(DeviceCall call, ObjectType type, uint32_t id)
+{
+	if (id != 0 && !m_Objects[(size_t)type].Live.count(id))
+		Error(call, "unknown object " + std::to_string(id));
+}
+
+void NullRenderDevice::ActiveTexture(uint32_t texture)
+{
+	Record(DeviceCall::ACTIVE_TEXTURE, { (double)texture });
+}
+
+void NullRenderDevice::AttachShader(uint32_t program, uint32_t shader)
+{
+	Validate(DeviceCall::ATTACH_SHADER, ObjectType::PROGRAM, program);
+	Validate(DeviceCall::ATTACH_SHADER, ObjectType::SHADER, shader);
+	Record(DeviceCall::ATTACH_SHADER, { (double)program, (double)shader });
+}
+
+void NullRenderDevice::BindBuffer(uint32_t target, uint32_t buffer)
+{
+	Validate(DeviceCall::BIND_BUFFER, ObjectType::BUFFER, buffer);
+	Record(DeviceCall::BIND_BUFFER, { (double)target, (double)buffer });
+}
+
+void NullRenderDevice::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer)
+{
+	Validate(DeviceCall::BIND_BUFFER_BASE, ObjectType::BUFFER, buffer);
+	Record(DeviceCall::BIND_BUFFER_BASE, { (double)target, (double)index, (double)buffer });
+}
+
+void NullRenderDevice::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset, ptrdiff_t size)
+{
+	Validate(DeviceCall::BIND_BUFFER_RANGE, ObjectType::BUFFER, buffer);
+	Record(DeviceCall::BIND_BUFFER_RANGE, { (double)target, (double)index, (double)buffer, (double)offset, (double)size });
+}
+
+void NullRenderDevice::BindFramebuffer(uint32_t target, uint32_t framebuffer)
+{
+	Validate(DeviceCall::BIND_FRAMEBUFFER, ObjectType::FRAMEBUFFER, framebuffer);
+	Record(DeviceCall::BIND_FRAMEBUFFER, { (double)target, (double)framebuffer });
+}
+
+void NullRenderDevice::BindRenderbuffer(uint32_t target, uint32_t renderbuffer)
+{
+	Validate(DeviceCall::BIND_RENDERBUFFER, ObjectType::RENDERBUFFER, renderbuffer);
+	Record(DeviceCall::BIND_RENDERBUFFER, { (double)target, (double)renderbuffer });
+}
+
+void NullRenderDevice::BindTexture(uint32_t target, uint32_t texture)
+{
+	Validate(DeviceCall::BIND_TEXTURE, ObjectType::TEXTURE, texture);
+	Record(DeviceCall::BIND_TEXTURE, { (double)target, (double)texture });
+}
+
+void NullRenderDevice::BindVertexArray(uint32_t array)
+{
+	Validate(DeviceCall::BIND_VERTEX_ARRAY, ObjectType::VERTEX_ARRAY, array);
+	m_VertexArray = array;
+	Record(DeviceCall::BIND_VERTEX_ARRAY, { (double)array });
+}
+
+void NullRenderDevice::BlendFunc(uint32_t sourceFactor, uint32_t destinationFactor)
+{
+	Record(DeviceCall::BLEND_FUNC, { (double)sourceFactor, (double)destinationFactor });
+}
+
+void NullRenderDevice::BufferData(uint32_t target, ptrdiff_t size, const void* data, uint32_t usage)
+{
+	Record(DeviceCall::BUFFER_DATA, { (double)target, (double)size, (double)usage });
+}
+
+void NullRenderDevice::BufferSubData(uint32_t target, ptrdiff_t offset, ptrdiff_t size, const void* data)
+{
+	Record(DeviceCall::BUFFER_SUB_DATA, { (double)target, (double)offset, (double)size });
+}
+
+uint32_t NullRenderDevice::CheckFramebufferStatus(uint32_t target)
+{
+	Record(DeviceCall::CHECK_FRAMEBUFFER_STATUS, { (double)target });
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+void NullRenderDevice::Clear(uint32_t mask)
+{
+	Record(DeviceCall::CLEAR, { (double)mask });
+}
+
+void NullRenderDevice::ClearColor(float red, float green, float blue, float alpha)
+{
+	Record(DeviceCall::CLEAR_COLOR, { (double)red, (double)green, (double)blue, (double)alpha });
+}
+
+void NullRenderDevice::CompileShader(uint32_t shader)
+{
+	Validate(DeviceCall::COMPILE_SHADER, ObjectType::SHADER, shader);
+	Record(DeviceCall::COMPILE_SHADER, { (double)shader });
+}
+
+void NullRenderDevice::CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, ptrdiff_t readOffset, ptrdiff_t writeOffset, ptrdiff_t size)
+{
+	Record(DeviceCall::COPY_BUFFER_SUB_DATA, { (double)readTarget, (double)writeTarget, (double)readOffset, (double)writeOffset, (double)size });
+}
+
+void NullRenderDevice::CopyImageSubData(uint32_t sourceName, uint32_t sourceTarget, int32_t sourceLevel, int32_t sourceX, int32_t sourceY, int32_t sourceZ, uint32_t destinationName, uint32_t destinationTarget, int32_t destinationLevel, int32_t destinationX, int32_t destinationY, int32_t destinationZ, int32_t width, int32_t height, int32_t depth)
+{
+	Validate(DeviceCall::COPY_IMAGE_SUB_DATA, ObjectType::TEXTURE, sourceName);
+	Validate(DeviceCall::COPY_IMAGE_SUB_DATA, ObjectType::TEXTURE, destinationName);
+	Record(DeviceCall::COPY_IMAGE_SUB_DATA, { (double)sourceName, (double)destinationName, (double)width, (double)height, (double)depth });
+}
+
+uint32_t NullRenderDevice::CreateProgram()
+{
+	uint32_t program = Create(ObjectType::PROGRAM);
+	Record(DeviceCall::CREATE_PROGRAM, { (double)program });
+	return program;
+}
+
+uint32_t NullRenderDevice::CreateShader(uint32_t type)
+{
+	uint32_t shader = Create(ObjectType::SHADER);
+	Record(DeviceCall::CREATE_SHADER, { (double)type, (double)shader });
+	return shader;
+}
+
+void NullRenderDevice::CullFace(uint32_t mode)
+{
+	Record(DeviceCall::CULL_FACE, { (double)mode });
+}
+
+void NullRenderDevice::DeleteBuffers(int32_t count, const uint32_t* buffers)
+{
+	for (int32_t i = 0; i < count; i++)
+		Destroy(DeviceCall::DELETE_BUFFERS, ObjectType::BUFFER, buffers[i]);
+	Record(DeviceCall::DELETE_BUFFERS, { (double)count, count > 0 ? (double)buffers[0] : 0.0 });
+}
+
+void NullRenderDevice::DeleteFramebuffers(int32_t count, const uint32_t* framebuffers)
+{
+	for (int32_t i = 0; i < count; i++)
+		Destroy(DeviceCall::DELETE_FRAMEBUFFERS, ObjectType::FRAMEBUFFER, framebuffers[i]);
+	Record(DeviceCall::DELETE_FRAMEBUFFERS, { (double)count, count > 0 ? (double)framebuffers[0] : 0.0 });
+}
+
+void NullRenderDevice::DeleteProgram(uint32_t program)
+{
+	Destroy(DeviceCall::DELETE_PROGRAM, ObjectType::PROGRAM, program);
+	if (m_Program == program)
+		m_Program = 0;
+	Record(DeviceCall::DELETE_PROGRAM, { (double)program });
+}
+
+void NullRenderDevice::DeleteRenderbuffers(int32_t count, const uint32_t* renderbuffers)
+{
+	for (int32_t i = 0; i < count; i++)
+		Destroy(DeviceCall::DELETE_RENDERBUFFERS, ObjectType::RENDERBUFFER, renderbuffers[i]);
+	Record(DeviceCall::DELETE_RENDERBUFFERS, { (double)count, count > 0 ? (double)renderbuffers[0] : 0.0 });
+}
+
+void NullRenderDevice::DeleteShader(uint32_t shader)
+{
+	Destroy(DeviceCall::DELETE_SHADER, ObjectType::SHADER, shader);
+	Record(DeviceCall::DELETE_SHADER, { (double)shader });
+}
+
+void NullRenderDevice::DeleteTextures(int32_t count, const uint32_t* textures)
+{
+	for (int32_t i = 0; i < count; i++)
+		Destroy(DeviceCall::DELETE_TEXTURES, ObjectType::TEXTURE, textures[i]);
+	Record(DeviceCall::DELETE_TEXTURES, { (double)count, count > 0 ? (double)textures[0] : 0.0 });
+}
+
+void NullRenderDevice::DeleteVertexArrays(int32_t count, const uint32_t* arrays)
+{
+	for (int32_t i = 0; i < count; i++)
+		Destroy(DeviceCall::DELETE_VERTEX_ARRAYS, ObjectType::VERTEX_ARRAY, arrays[i]);
+	Record(DeviceCall::DELETE_VERTEX_ARRAYS, { (double)count, count > 0 ? (double)arrays[0] : 0.0 });
+}
+
+void NullRenderDevice::DepthFunc(uint32_t function)
+{
+	Record(DeviceCall::DEPTH_FUNC, { (double)function });
+}
+
+void NullRenderDevice::Disable(uint32_t capability)
+{
+	Record(DeviceCall::DISABLE, { (double)capability });
+}
+
+void NullRenderDevice::DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+{
+	if (!m_Program)
+		Error(DeviceCall::DISPATCH_COMPUTE, "no program in use");
+	Record(DeviceCall::DISPATCH_COMPUTE, { (double)groupsX, (double)groupsY, (double)groupsZ });
+}
+
+void NullRenderDevice::DrawArrays(uint32_t mode, int32_t first, int32_t count)
+{
+	if (!m_Program)
+		Error(DeviceCall::DRAW_ARRAYS, "no program in use");
+	if (!m_VertexArray)
+		Error(DeviceCall::DRAW_ARRAYS, "no vertex array bound");
+	Record(DeviceCall::DRAW_ARRAYS, { (double)mode, (double)first, (double)count });
+}
+
+void NullRenderDevice::DrawBuffer(uint32_t buffer)
+{
+	Record(DeviceCall::DRAW_BUFFER, { (double)buffer });
+}
+
+void NullRenderDevice::DrawElements(uint32_t mode, int32_t count, uint32_t type, const void* indices)
+{
+	if (!m_Program)
+		Error(DeviceCall::DRAW_ELEMENTS, "no program in use");
+	if (!m_VertexArray)
+		Error(DeviceCall::DRAW_ELEMENTS, "no vertex array bound");
+	Record(DeviceCall::DRAW_ELEMENTS, { (double)mode, (double)count, (double)type });
+}
+
+void NullRenderDevice::DrawElementsBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t baseVertex)
+{
+	if (!m_Program)
+		Error(DeviceCall::DRAW_ELEMENTS_BASE_VERTEX, "no program in use");
+	if (!m_VertexArray)
+		Error(DeviceCall::DRAW_ELEMENTS_BASE_VERTEX, "no vertex array bound");
+	Record(DeviceCall::DRAW_ELEMENTS_BASE_VERTEX, { (double)mode, (double)count, (double)type, (double)(size_t)indices, (double)baseVertex });
+}
+
+void NullRenderDevice::DrawElementsInstanced(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances)
+{
+	if (!m_Program)
+		Error(DeviceCall::DRAW_ELEMENTS_INSTANCED, "no program in use");
+	if (!m_VertexArray)
+		Error(DeviceCall::DRAW_ELEMENTS_INSTANCED, "no vertex array bound");
+	Record(DeviceCall::DRAW_ELEMENTS_INSTANCED, { (double)mode, (double)count, (double)type, (double)instances });
+}
+
+void NullRenderDevice::DrawElementsInstancedBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances, int32_t baseVertex)
+{
+	if (!m_Program)
+		Error(DeviceCall::DRAW_ELEMENTS_INSTANCED_BASE_VERTEX, "no program in use");
+	if (!m_VertexArray)
+		Error(DeviceCall::DRAW_ELEMENTS_INSTANCED_BASE_VERTEX, "no vertex array bound");
+	Record(DeviceCall::DRAW_ELEMENTS_INSTANCED_BASE_VERTEX, { (double)mode, (double)count, (double)(size_t)indices, (double)instances, (double)baseVertex });
+}
+
+void NullRenderDevice::Enable(uint32_t capability)
+{
+	Record(DeviceCall::ENABLE, { (double)capability });
+}
+
+void NullRenderDevice::EnableVertexAttribArray(uint32_t index)
+{
+	if (!m_VertexArray)
+		Error(DeviceCall::ENABLE_VERTEX_ATTRIB_ARRAY, "no vertex array bound");
+	Record(DeviceCall::ENABLE_VERTEX_ATTRIB_ARRAY, { (double)index });
+}
+
+void NullRenderDevice::FramebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbufferTarget, uint32_t renderbuffer)
+{
+	Validate(DeviceCall::FRAMEBUFFER_RENDERBUFFER, ObjectType::RENDERBUFFER, renderbuffer);
+	Record(DeviceCall::FRAMEBUFFER_RENDERBUFFER, { (double)target, (double)attachment, (double)renderbufferTarget, (double)renderbuffer });
+}
+
+void NullRenderDevice::FramebufferTexture(uint32_t target, uint32_t attachment, uint32_t texture, int32_t level)
+{
+	Validate(DeviceCall::FRAMEBUFFER_TEXTURE, ObjectType::TEXTURE, texture);
+	Record(DeviceCall::FRAMEBUFFER_TEXTURE, { (double)target, (double)attachment, (double)texture, (double)level });
+}
+
+void NullRenderDevice::FramebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textureTarget, uint32_t texture, int32_t level)
+{
+	Validate(DeviceCall::FRAMEBUFFER_TEXTURE_2D, ObjectType::TEXTURE, texture);
+	Record(DeviceCall::FRAMEBUFFER_TEXTURE_2D, { (double)target, (double)attachment, (double)textureTarget, (double)texture, (double)level });
+}
+
+void NullRenderDevice::GenBuffers(int32_t count, uint32_t* buffers)
+{
+	for (int32_t i = 0; i < count; i++)
+		buffers[i] = Create(ObjectType::BUFFER);
+	Record(DeviceCall::GEN_BUFFERS, { (double)count, count > 0 ? (double)buffers[0] : 0.0 });
+}
+
+void NullRenderDevice::GenFramebuffers(int32_t count, uint32_t* framebuffers)
+{
+	for (int32_t i = 0; i < count; i++)
+		framebuffers[i] = Create(ObjectType::FRAMEBUFFER);
+	Record(DeviceCall::GEN_FRAMEBUFFERS, { (double)count, count > 0 ? (double)framebuffers[0] : 0.0 });
+}
+
+void NullRenderDevice::GenRenderbuffers(int32_t count, uint32_t* renderbuffers)
+{
+	for (int32_t i = 0; i < count; i++)
+		renderbuffers[i] = Create(ObjectType::RENDERBUFFER);
+	Record(DeviceCall::GEN_RENDERBUFFERS, { (double)count, count > 0 ? (double)renderbuffers[0] : 0.0 });
+}
+
+void NullRenderDevice::GenTextures(int32_t count, uint32_t* textures)
+{
+	for (int32_t i = 0; i < count; i++)
+		textures[i] = Create(ObjectType::TEXTURE);
+	Record(DeviceCall::GEN_TEXTURES, { (double)count, count > 0 ? (double)textures[0] : 0.0 });
+}
+
+void NullRenderDevice::GenVertexArrays(int32_t count, uint32_t* arrays)
+{
+	for (int32_t i = 0; i < count; i++)
+		arrays[i] = Create(ObjectType::VERTEX_ARRAY);
+	Record(DeviceCall::GEN_VERTEX_ARRAYS, { (double)count, count > 0 ? (double)arrays[0] : 0.0 });
+}
+
+void NullRenderDevice::GenerateMipmap(uint32_t target)
+{
+	Record(DeviceCall::GENERATE_MIPMAP, { (double)target });
+}
+
+void NullRenderDevice::GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name)
+{
+	// Programs report no active uniforms, this is never reached through UniformTable::Load
+	if (length)
+		*length = 0;
+	if (bufferSize > 0)
+		name[0] = '\0';
+	*size = 0;
+	*type = 0;
+	Record(DeviceCall::GET_ACTIVE_UNIFORM, { (double)program, (double)index, (double)bufferSize });
+}
+
+void NullRenderDevice::GetActiveUniformBlockiv(uint32_t program, uint32_t blockIndex, uint32_t parameter, int32_t* value)
+{
+	*value = 0;
+	Record(DeviceCall::GET_ACTIVE_UNIFORM_BLOCK_IV, { (double)program, (double)blockIndex, (double)parameter });
+}
+
+void NullRenderDevice::GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values)
+{
+	for (int32_t i = 0; i < count; i++)
+		values[i] = -1;
+	Record(DeviceCall::GET_ACTIVE_UNIFORMS_IV, { (double)program, (double)count, (double)parameter });
+}
+
+uint32_t NullRenderDevice::GetError()
+{
+	Record(DeviceCall::GET_ERROR, {});
+	return GL_NO_ERROR;
+}
+
+void NullRenderDevice::GetProgramInfoLog(uint32_t program, int32_t bufferSize, int32_t* length, char* infoLog)
+{
+	if (length)
+		*length = 0;
+	if (bufferSize > 0)
+		infoLog[0] = '\0';
+	Record(DeviceCall::GET_PROGRAM_INFO_LOG, { (double)program, (double)bufferSize });
+}
+
+void NullRenderDevice::GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value)
+{
+	// Everything compiles and links, without any active uniform to reflect
+	*value = parameter == GL_ACTIVE_UNIFORMS ? 0 : GL_TRUE;
+	Record(DeviceCall::GET_PROGRAM_IV, { (double)program, (double)parameter });
+}
+
+void NullRenderDevice::GetShaderInfoLog(uint32_t shader, int32_t bufferSize, int32_t* length, char* infoLog)
+{
+	if (length)
+		*length = 0;
+	if (bufferSize > 0)
+		infoLog[0] = '\0';
+	Record(DeviceCall::GET_SHADER_INFO_LOG, { (double)shader, (double)bufferSize });
+}
+
+void NullRenderDevice::GetShaderiv(uint32_t shader, uint32_t parameter, int32_t* value)
+{
+	// Everything compiles and links, without any active uniform to reflect
+	*value = parameter == GL_ACTIVE_UNIFORMS ? 0 : GL_TRUE;
+	Record(DeviceCall::GET_SHADER_IV, { (double)shader, (double)parameter });
+}
+
+uint32_t NullRenderDevice::GetUniformBlockIndex(uint32_t program, const char* name)
+{
+	// Programs report no uniform blocks
+	Record(DeviceCall::GET_UNIFORM_BLOCK_INDEX, { (double)program });
+	return GL_INVALID_INDEX;
+}
+
+int32_t NullRenderDevice::GetUniformLocation(uint32_t program, const char* name)
+{
+	auto it = m_UniformLocations.try_emplace(name, (int32_t)m_UniformLocations.size()).first;
+	int32_t location = it->second;
+	Record(DeviceCall::GET_UNIFORM_LOCATION, { (double)program, (double)location });
+	return location;
+}
+
+void NullRenderDevice::LinkProgram(uint32_t program)
+{
+	Validate(DeviceCall::LINK_PROGRAM, ObjectType::PROGRAM, program);
+	Record(DeviceCall::LINK_PROGRAM, { (double)program });
+}
+
+void* NullRenderDevice::MapBufferRange(uint32_t target, ptrdiff_t offset, ptrdiff_t length, uint32_t access)
+{
+	m_MappedBuffer.resize(length);
+	Record(DeviceCall::MAP_BUFFER_RANGE, { (double)target, (double)offset, (double)length, (double)access });
+	return m_MappedBuffer.data();
+}
+
+void NullRenderDevice::MemoryBarrierBits(uint32_t barriers)
+{
+	Record(DeviceCall::MEMORY_BARRIER_BITS, { (double)barriers });
+}
+
+void NullRenderDevice::MultiDrawElementsIndirect(uint32_t mode, uint32_t type, const void* indirect, int32_t drawCount, int32_t stride)
+{
+	if (!m_Program)
+		Error(DeviceCall::MULTI_DRAW_ELEMENTS_INDIRECT, "no program in use");
+	if (!m_VertexArray)
+		Error(DeviceCall::MULTI_DRAW_ELEMENTS_INDIRECT, "no vertex array bound");
+	Record(DeviceCall::MULTI_DRAW_ELEMENTS_INDIRECT, { (double)mode, (double)type, (double)(size_t)indirect, (double)drawCount, (double)stride });
+}
+
+void NullRenderDevice::ProgramParameteri(uint32_t program, uint32_t parameter, int32_t value)
+{
+	Validate(DeviceCall::PROGRAM_PARAMETER_I, ObjectType::PROGRAM, program);
+	Record(DeviceCall::PROGRAM_PARAMETER_I, { (double)program, (double)parameter, (double)value });
+}
+
+void NullRenderDevice::ReadBuffer(uint32_t buffer)
+{
+	Record(DeviceCall::READ_BUFFER, { (double)buffer });
+}
+
+void NullRenderDevice::RenderbufferStorage(uint32_t target, uint32_t internalFormat, int32_t width, int32_t height)
+{
+	Record(DeviceCall::RENDERBUFFER_STORAGE, { (double)target, (double)internalFormat, (double)width, (double)height });
+}
+
+void NullRenderDevice::ShaderSource(uint32_t shader, int32_t count, const char* const* sources, const int32_t* lengths)
+{
+	Validate(DeviceCall::SHADER_SOURCE, ObjectType::SHADER, shader);
+	Record(DeviceCall::SHADER_SOURCE, { (double)shader, (double)count });
+}
+
+void NullRenderDevice::TexImage2D(uint32_t target, int32_t level, int32_t internalFormat, int32_t width, int32_t height, int32_t border, uint32_t format, uint32_t type, const void* pixels)
+{
+	Record(DeviceCall::TEX_IMAGE_2D, { (double)target, (double)level, (double)width, (double)height });
+}
+
+void NullRenderDevice::TexParameterfv(uint32_t target, uint32_t parameter, const float* values)
+{
+	Record(DeviceCall::TEX_PARAMETER_FV, { (double)target, (double)parameter });
+}
+
+void NullRenderDevice::TexParameteri(uint32_t target, uint32_t parameter, int32_t value)
+{
+	Record(DeviceCall::TEX_PARAMETER_I, { (double)target, (double)parameter, (double)value });
+}
+
+void NullRenderDevice::Uniform1f(int32_t location, float x)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_1F, "no program in use");
+	Record(DeviceCall::UNIFORM_1F, { (double)location, (double)x });
+}
+
+void NullRenderDevice::Uniform1i(int32_t location, int32_t x)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_1I, "no program in use");
+	Record(DeviceCall::UNIFORM_1I, { (double)location, (double)x });
+}
+
+void NullRenderDevice::Uniform1ui(int32_t location, uint32_t x)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_1UI, "no program in use");
+	Record(DeviceCall::UNIFORM_1UI, { (double)location, (double)x });
+}
+
+void NullRenderDevice::Uniform2f(int32_t location, float x, float y)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_2F, "no program in use");
+	Record(DeviceCall::UNIFORM_2F, { (double)location, (double)x, (double)y });
+}
+
+void NullRenderDevice::Uniform3f(int32_t location, float x, float y, float z)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_3F, "no program in use");
+	Record(DeviceCall::UNIFORM_3F, { (double)location, (double)x, (double)y, (double)z });
+}
+
+void NullRenderDevice::Uniform4f(int32_t location, float x, float y, float z, float w)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_4F, "no program in use");
+	Record(DeviceCall::UNIFORM_4F, { (double)location, (double)x, (double)y, (double)z, (double)w });
+}
+
+void NullRenderDevice::UniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float* values)
+{
+	if (!m_Program)
+		Error(DeviceCall::UNIFORM_MATRIX_4FV, "no program in use");
+	Record(DeviceCall::UNIFORM_MATRIX_4FV, { (double)location, (double)count, (double)transpose });
+}
+
+bool NullRenderDevice::UnmapBuffer(uint32_t target)
+{
+	Record(DeviceCall::UNMAP_BUFFER, { (double)target });
+	return true;
+}
+
+void NullRenderDevice::UseProgram(uint32_t program)
+{
+	Validate(DeviceCall::USE_PROGRAM, ObjectType::PROGRAM, program);
+	m_Program = program;
+	Record(DeviceCall::USE_PROGRAM, { (double)program });
+}
+
+void NullRenderDevice::VertexAttribDivisor(uint32_t index, uint32_t divisor)
+{
+	if (!m_VertexArray)
+		Error(DeviceCall::VERTEX_ATTRIB_DIVISOR, "no vertex array bound");
+	Record(DeviceCall::VERTEX_ATTRIB_DIVISOR, { (double)index, (double)divisor });
+}
+
+void NullRenderDevice::VertexAttribIPointer(uint32_t index, int32_t size, uint32_t type, int32_t stride, const void* offset)
+{
+	if (!m_VertexArray)
+		Error(DeviceCall::VERTEX_ATTRIB_I_POINTER, "no vertex array bound");
+	Record(DeviceCall::VERTEX_ATTRIB_I_POINTER, { (double)index, (double)size, (double)type, (double)stride });
+}
+
+void NullRenderDevice::VertexAttribPointer(uint32_t index, int32_t size, uint32_t type, bool normalized, int32_t stride, const void* offset)
+{
+	if (!m_VertexArray)
+		Error(DeviceCall::VERTEX_ATTRIB_POINTER, "no vertex array bound");
+	Record(DeviceCall::VERTEX_ATTRIB_POINTER, { (double)index, (double)size, (double)type, (double)normalized, (double)stride });
+}
+
+void NullRenderDevice::Viewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	Record(DeviceCall::VIEWPORT, { (double)x, (double)y, (double)width, (double)height });
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "RenderDevice.h"
+
+#include "GLRenderDevice.h"
+#include "StateCachingRenderDevice.h"
+
+// Never destroyed, shaders and textures cached by other singletons are released through it at exit
+static Ref<RenderDevice>& Instance()
+{
+	static Ref<RenderDevice>* instance = new Ref<RenderDevice>();
+	return *instance;
+}
+
+RenderDevice& RenderDevice::Get()
+{
+	Ref<RenderDevice>& instance = Instance();
+	if (instance == nullptr)
+		instance = CreateRef<StateCachingRenderDevice>(CreateRef<GLRenderDevice>());
+
+	return *instance;
+}
+
+void RenderDevice::Set(Ref<RenderDevice> device)
+{
+	Instance() = std::move(device);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "typedefs.h"
+
+// Thin layer over the graphics API, one method per OpenGL entry point the engine uses.
+// Enum arguments keep their OpenGL values so call sites stay a straight translation.
+class RenderDevice
+{
+public:
+	virtual ~RenderDevice() = default;
+
+	// Called for every graphics command, so the device is not guarded by a mutex: set it before the renderer starts.
+	// Defaults to the OpenGL device behind a state cache.
+	static RenderDevice& Get();
+	static void Set(Ref<RenderDevice> device);
+
+	virtual void ActiveTexture(uint32_t texture) = 0;
+	virtual void AttachShader(uint32_t program, uint32_t shader) = 0;
+	virtual void BindBuffer(uint32_t target, uint32_t buffer) = 0;
+	virtual void BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) = 0;
+	virtual void BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset, ptrdiff_t size) = 0;
+	virtual void BindFramebuffer(uint32_t target, uint32_t framebuffer) = 0;
+	virtual void BindRenderbuffer(uint32_t target, uint32_t renderbuffer) = 0;
+	virtual void BindTexture(uint32_t target, uint32_t texture) = 0;
+	virtual void BindVertexArray(uint32_t array) = 0;
+	virtual void BlendFunc(uint32_t sourceFactor, uint32_t destinationFactor) = 0;
+	virtual void BufferData(uint32_t target, ptrdiff_t size, const void* data, uint32_t usage) = 0;
+	virtual void BufferSubData(uint32_t target, ptrdiff_t offset, ptrdiff_t size, const void* data) = 0;
+	virtual uint32_t CheckFramebufferStatus(uint32_t target) = 0;
+	virtual void Clear(uint32_t mask) = 0;
+	virtual void ClearColor(float red, float green, float blue, float alpha) = 0;
+	virtual void CompileShader(uint32_t shader) = 0;
+	virtual void CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, ptrdiff_t readOffset, ptrdiff_t writeOffset, ptrdiff_t size) = 0;
+	virtual void CopyImageSubData(uint32_t sourceName, uint32_t sourceTarget, int32_t sourceLevel, int32_t sourceX, int32_t sourceY, int32_t sourceZ, uint32_t destinationName, uint32_t destinationTarget, int32_t destinationLevel, int32_t destinationX, int32_t destinationY, int32_t destinationZ, int32_t width, int32_t height, int32_t depth) = 0;
+	virtual uint32_t CreateProgram() = 0;
+	virtual uint32_t CreateShader(uint32_t type) = 0;
+	virtual void CullFace(uint32_t mode) = 0;
+	virtual void DeleteBuffers(int32_t count, const uint32_t* buffers) = 0;
+	virtual void DeleteFramebuffers(int32_t count, const uint32_t* framebuffers) = 0;
+	virtual void DeleteProgram(uint32_t program) = 0;
+	virtual void DeleteRenderbuffers(int32_t count, const uint32_t* renderbuffers) = 0;
+	virtual void DeleteShader(uint32_t shader) = 0;
+	virtual void DeleteTextures(int32_t count, const uint32_t* textures) = 0;
+	virtual void DeleteVertexArrays(int32_t count, const uint32_t* arrays) = 0;
+	virtual void DepthFunc(uint32_t function) = 0;
+	virtual void Disable(uint32_t capability) = 0;
+	virtual void DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) = 0;
+	virtual void DrawArrays(uint32_t mode, int32_t first, int32_t count) = 0;
+	virtual void DrawBuffer(uint32_t buffer) = 0;
+	virtual void DrawElements(uint32_t mode, int32_t count, uint32_t type, const void* indices) = 0;
+	virtual void DrawElementsBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t baseVertex) = 0;
+	virtual void DrawElementsInstanced(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances) = 0;
+	virtual void DrawElementsInstancedBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances, int32_t baseVertex) = 0;
+	virtual void Enable(uint32_t capability) = 0;
+	virtual void EnableVertexAttribArray(uint32_t index) = 0;
+	virtual void FramebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbufferTarget, uint32_t renderbuffer) = 0;
+	virtual void FramebufferTexture(uint32_t target, uint32_t attachment, uint32_t texture, int32_t level) = 0;
+	virtual void FramebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textureTarget, uint32_t texture, int32_t level) = 0;
+	virtual void GenBuffers(int32_t count, uint32_t* buffers) = 0;
+	virtual void GenFramebuffers(int32_t count, uint32_t* framebuffers) = 0;
+	virtual void GenRenderbuffers(int32_t count, uint32_t* renderbuffers) = 0;
+	virtual void GenTextures(int32_t count, uint32_t* textures) = 0;
+	virtual void GenVertexArrays(int32_t count, uint32_t* arrays) = 0;
+	virtual void GenerateMipmap(uint32_t target) = 0;
+	virtual void GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name) = 0;
+	virtual void GetActiveUniformBlockiv(uint32_t program, uint32_t blockIndex, uint32_t parameter, int32_t* value) = 0;
+	virtual void GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values) = 0;
+	virtual uint32_t GetError() = 0;
+	virtual void GetProgramInfoLog(uint32_t program, int32_t bufferSize, int32_t* length, char* infoLog) = 0;
+	virtual void GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value) = 0;
+	virtual void GetShaderInfoLog(uint32_t shader, int32_t bufferSize, int32_t* length, char* infoLog) = 0;
+	virtual void GetShaderiv(uint32_t shader, uint32_t parameter, int32_t* value) = 0;
+	virtual uint32_t GetUniformBlockIndex(uint32_t program, const char* name) = 0;
+	virtual int32_t GetUniformLocation(uint32_t program, const char* name) = 0;
+	virtual void LinkProgram(uint32_t program) = 0;
+	virtual void* MapBufferRange(uint32_t target, ptrdiff_t offset, ptrdiff_t length, uint32_t access) = 0;
+	virtual void MemoryBarrierBits(uint32_t barriers) = 0;
+	virtual void MultiDrawElementsIndirect(uint32_t mode, uint32_t type, const void* indirect, int32_t drawCount, int32_t stride) = 0;
+	virtual void ProgramParameteri(uint32_t program, uint32_t parameter, int32_t value) = 0;
+	virtual void ReadBuffer(uint32_t buffer) = 0;
+	virtual void RenderbufferStorage(uint32_t target, uint32_t internalFormat, int32_t width, int32_t height) = 0;
+	virtual void ShaderSource(uint32_t shader, int32_t count, const char* const* sources, const int32_t* lengths) = 0;
+	virtual void TexImage2D(uint32_t target, int32_t level, int32_t internalFormat, int32_t width, int32_t height, int32_t border, uint32_t format, uint32_t type, const void* pixels) = 0;
+	virtual void TexParameterfv(uint32_t target, uint32_t parameter, const float* values) = 0;
+	virtual void TexParameteri(uint32_t target, uint32_t parameter, int32_t value) = 0;
+	virtual void Uniform1f(int32_t location, float x) = 0;
+	virtual void Uniform1i(int32_t location, int32_t x) = 0;
+	virtual void Uniform1ui(int32_t location, uint32_t x) = 0;
+	virtual void Uniform2f(int32_t location, float x, float y) = 0;
+	virtual void Uniform3f(int32_t location, float x, float y, float z) = 0;
+	virtual void Uniform4f(int32_t location, float x, float y, float z, float w) = 0;
+	virtual void UniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float* values) = 0;
+	virtual bool UnmapBuffer(uint32_t target) = 0;
+	virtual void UseProgram(uint32_t program) = 0;
+	virtual void VertexAttribDivisor(uint32_t index, uint32_t divisor) = 0;
+	virtual void VertexAttribIPointer(uint32_t index, int32_t size, uint32_t type, int32_t stride, const void* offset) = 0;
+	virtual void VertexAttribPointer(uint32_t index, int32_t size, uint32_t type, bool normalized, int32_t stride, const void* offset) = 0;
+	virtual void Viewport(int32_t x, int32_t y, int32_t width, int32_t height) = 0;
+};
@@ -0,0 +1,626 @@
+#include "StateCachingRenderDevice.h"
+
+#include <glad/glad.h>
+
+StateCachingRenderDevice::StateCachingRenderDevice(Ref<RenderDevice> device)
+	: m_Device(device), m_ActiveTextureUnit(0)
+{
+	Invalidate();
+}
+
+void StateCachingRenderDevice::Invalidate()
+{
+	m_Program = UNKNOWN;
+	m_VertexArray = UNKNOWN;
+	m_DrawFramebuffer = UNKNOWN;
+	m_ReadFramebuffer = UNKNOWN;
+	m_Buffers.clear();
+	m_BufferRanges.clear();
+
+	// The requested unit is kept, it is activated again before the next call depending on it
+	m_DeviceTextureUnit = UNKNOWN;
+	m_TextureUnits.fill(TextureUnit());
+
+	m_Capabilities.clear();
+	m_Viewport = { -1, -1, -1, -1 };
+	m_BlendSourceFactor = UNKNOWN;
+	m_BlendDestinationFactor = UNKNOWN;
+	m_DepthFunction = UNKNOWN;
+	m_CullFaceMode = UNKNOWN;
+}
+
+bool StateCachingRenderDevice::Change(uint32_t& cached, uint32_t value)
+{
+	m_RequestedCount++;
+	if (cached == value)
+		return false;
+
+	cached = value;
+	m_IssuedCount++;
+	return true;
+}
+
+void StateCachingRenderDevice::FlushActiveTexture()
+{
+	if (m_ActiveTextureUnit == m_DeviceTextureUnit)
+		return;
+
+	m_Device->ActiveTexture(GL_TEXTURE0 + m_ActiveTextureUnit);
+	m_DeviceTextureUnit = m_ActiveTextureUnit;
+	m_IssuedCount++;
+}
+
+StateCachingRenderDevice::TextureUnit* StateCachingRenderDevice::GetTextureUnit(uint32_t unit)
+{
+	return unit < MAX_CACHED_TEXTURE_UNITS ? &m_TextureUnits[unit] : nullptr;
+}
+
+uint32_t* StateCachingRenderDevice::GetCachedTexture(TextureUnit& unit, uint32_t target)
+{
+	switch (target)
+	{
+	case GL_TEXTURE_2D:
+		return &unit.Texture2D;
+	case GL_TEXTURE_CUBE_MAP:
+		return &unit.TextureCubeMap;
+	default:
+		return nullptr;
+	}
+}
+
+void StateCachingRenderDevice::SetCapability(uint32_t capability, bool enabled)
+{
+	m_RequestedCount++;
+
+	auto it = m_Capabilities.find(capability);
+	if (it != m_Capabilities.end() && it->second == enabled)
+		return;
+
+	m_Capabilities[capability] = enabled;
+	m_IssuedCount++;
+
+	if (enabled)
+		m_Device->Enable(capability);
+	else
+		m_Device->Disable(capability);
+}
+
+void StateCachingRenderDevice::ActiveTexture(uint32_t texture)
+{
+	// Counted as issued only once flushed
+	m_RequestedCount++;
+	m_ActiveTextureUnit = texture - GL_TEXTURE0;
+}
+
+void StateCachingRenderDevice::BindBuffer(uint32_t target, uint32_t buffer)
+{
+	if (target == GL_ELEMENT_ARRAY_BUFFER)
+	{
+		m_RequestedCount++;
+		m_IssuedCount++;
+		m_Device->BindBuffer(target, buffer);
+		return;
+	}
+
+	auto it = m_Buffers.try_emplace(target, UNKNOWN).first;
+	if (Change(it->second, buffer))
+		m_Device->BindBuffer(target, buffer);
+}
+
+void StateCachingRenderDevice::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer)
+{
+	// Binding an index also binds the generic binding point
+	m_Buffers[target] = buffer;
+
+	BufferRange range = { buffer, 0, -1 };
+	BufferRange& cached = m_BufferRanges.try_emplace(((uint64_t)target << 32) | index, BufferRange{ UNKNOWN, 0, 0 }).first->second;
+
+	m_RequestedCount++;
+	if (cached.Buffer == range.Buffer && cached.Offset == range.Offset && cached.Size == range.Size)
+		return;
+
+	cached = range;
+	m_IssuedCount++;
+	m_Device->BindBufferBase(target, index, buffer);
+}
+
+void StateCachingRenderDevice::BindBufferRange(uint32_t target, uint32_t index, uint32_t buffer, ptrdiff_t offset, ptrdiff_t size)
+{
+	m_Buffers[target] = buffer;
+
+	BufferRange range = { buffer, offset, size };
+	BufferRange& cached = m_BufferRanges.try_emplace(((uint64_t)target << 32) | index, BufferRange{ UNKNOWN, 0, 0 }).first->second;
+
+	m_RequestedCount++;
+	if (cached.Buffer == range.Buffer && cached.Offset == range.Offset && cached.Size == range.Size)
+		return;
+
+	cached = range;
+	m_IssuedCount++;
+	m_Device->BindBufferRange(target, index, buffer, offset, size);
+}
+
+void StateCachingRenderDevice::BindFramebuffer(uint32_t target, uint32_t framebuffer)
+{
+	m_RequestedCount++;
+
+	bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+	bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+	if ((!draw || m_DrawFramebuffer == framebuffer) && (!read || m_ReadFramebuffer == framebuffer))
+		return;
+
+	if (draw)
+		m_DrawFramebuffer = framebuffer;
+	if (read)
+		m_ReadFramebuffer = framebuffer;
+
+	m_IssuedCount++;
+	m_Device->BindFramebuffer(target, framebuffer);
+}
+
+void StateCachingRenderDevice::BindTexture(uint32_t target, uint32_t texture)
+{
+	TextureUnit* unit = GetTextureUnit(m_ActiveTextureUnit);
+	uint32_t* cached = unit ? GetCachedTexture(*unit, target) : nullptr;
+
+	if (cached)
+	{
+		if (!Change(*cached, texture))
+			return;
+	}
+	else
+	{
+		m_RequestedCount++;
+		m_IssuedCount++;
+	}
+
+	FlushActiveTexture();
+	m_Device->BindTexture(target, texture);
+}
+
+void StateCachingRenderDevice::BindVertexArray(uint32_t array)
+{
+	if (Change(m_VertexArray, array))
+		m_Device->BindVertexArray(array);
+}
+
+void StateCachingRenderDevice::BlendFunc(uint32_t sourceFactor, uint32_t destinationFactor)
+{
+	m_RequestedCount++;
+	if (m_BlendSourceFactor == sourceFactor && m_BlendDestinationFactor == destinationFactor)
+		return;
+
+	m_BlendSourceFactor = sourceFactor;
+	m_BlendDestinationFactor = destinationFactor;
+	m_IssuedCount++;
+	m_Device->BlendFunc(sourceFactor, destinationFactor);
+}
+
+void StateCachingRenderDevice::CullFace(uint32_t mode)
+{
+	if (Change(m_CullFaceMode, mode))
+		m_Device->CullFace(mode);
+}
+
+void StateCachingRenderDevice::DeleteBuffers(int32_t count, const uint32_t* buffers)
+{
+	// Deleted objects are unbound from every binding point
+	for (int32_t i = 0; i < count; i++)
+	{
+		for (auto& binding : m_Buffers)
+		{
+			if (binding.second == buffers[i])
+				binding.second = 0;
+		}
+		for (auto& range : m_BufferRanges)
+		{
+			if (range.second.Buffer == buffers[i])
+				range.second = { 0, 0, -1 };
+		}
+	}
+
+	m_Device->DeleteBuffers(count, buffers);
+}
+
+void StateCachingRenderDevice::DeleteFramebuffers(int32_t count, const uint32_t* framebuffers)
+{
+	for (int32_t i = 0; i < count; i++)
+	{
+		if (m_DrawFramebuffer == framebuffers[i])
+			m_DrawFramebuffer = 0;
+		if (m_ReadFramebuffer == framebuffers[i])
+			m_ReadFramebuffer = 0;
+	}
+
+	m_Device->DeleteFramebuffers(count, framebuffers);
+}
+
+void StateCachingRenderDevice::DeleteProgram(uint32_t program)
+{
+	// A program in use stays in use until another one replaces it, forget it so its name can be reused
+	if (m_Program == program)
+		m_Program = UNKNOWN;
+
+	m_Device->DeleteProgram(program);
+}
+
+void StateCachingRenderDevice::DeleteTextures(int32_t count, const uint32_t* textures)
+{
+	for (int32_t i = 0; i < count; i++)
+	{
+		for (TextureUnit& unit : m_TextureUnits)
+		{
+			if (unit.Texture2D == textures[i])
+				unit.Texture2D = 0;
+			if (unit.TextureCubeMap == textures[i])
+				unit.TextureCubeMap = 0;
+		}
+	}
+
+	m_Device->DeleteTextures(count, textures);
+}
+
+void StateCachingRenderDevice::DeleteVertexArrays(int32_t count, const uint32_t* arrays)
+{
+	for (int32_t i = 0; i < count; i++)
+	{
+		if (m_VertexArray == arrays[i])
+			m_VertexArray = 0;
+	}
+
+	m_Device->DeleteVertexArrays(count, arrays);
+}
+
+void StateCachingRenderDevice::DepthFunc(uint32_t function)
+{
+	if (Change(m_DepthFunction, function))
+		m_Device->DepthFunc(function);
+}
+
+void StateCachingRenderDevice::Disable(uint32_t capability)
+{
+	SetCapability(capability, false);
+}
+
+void StateCachingRenderDevice::Enable(uint32_t capability)
+{
+	SetCapability(capability, true);
+}
+
+void StateCachingRenderDevice::GenerateMipmap(uint32_t target)
+{
+	FlushActiveTexture();
+	m_Device->GenerateMipmap(target);
+}
+
+void StateCachingRenderDevice::TexImage2D(uint32_t target, int32_t level, int32_t internalFormat, int32_t width, int32_t height, int32_t border, uint32_t format, uint32_t type, const void* pixels)
+{
+	FlushActiveTexture();
+	m_Device->TexImage2D(target, level, internalFormat, width, height, border, format, type, pixels);
+}
+
+void StateCachingRenderDevice::TexParameterfv(uint32_t target, uint32_t parameter, const float* values)
+{
+	FlushActiveTexture();
+	m_Device->TexParameterfv(target, parameter, values);
+}
+
+void StateCachingRenderDevice::TexParameteri(uint32_t target, uint32_t parameter, int32_t value)
+{
+	FlushActiveTexture();
+	m_Device->TexParameteri(target, parameter, value);
+}
+
+void StateCachingRenderDevice::UseProgram(uint32_t program)
+{
+	if (Change(m_Program, program))
+		m_Device->UseProgram(program);
+}
+
+void StateCachingRenderDevice::Viewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	m_RequestedCount++;
+
+	std::array<int32_t, 4> viewport = { x, y, width, height };
+	if (m_Viewport == viewport)
+		return;
+
+	m_Viewport = viewport;
+	m_IssuedCount++;
+	m_Device->Viewport(x, y, width, height);
+}
+
+void StateCachingRenderDevice::AttachShader(uint32_t program, uint32_t shader)
+{
+	m_Device->AttachShader(program, shader);
+}
+
+void StateCachingRenderDevice::BindRenderbuffer(uint32_t target, uint32_t renderbuffer)
+{
+	m_Device->BindRenderbuffer(target, renderbuffer);
+}
+
+void StateCachingRenderDevice::BufferData(uint32_t target, ptrdiff_t size, const void* data, uint32_t usage)
+{
+	m_Device->BufferData(target, size, data, usage);
+}
+
+void StateCachingRenderDevice::BufferSubData(uint32_t target, ptrdiff_t offset, ptrdiff_t size, const void* data)
+{
+	m_Device->BufferSubData(target, offset, size, data);
+}
+
+uint32_t StateCachingRenderDevice::CheckFramebufferStatus(uint32_t target)
+{
+	return m_Device->CheckFramebufferStatus(target);
+}
+
+void StateCachingRenderDevice::Clear(uint32_t mask)
+{
+	m_Device->Clear(mask);
+}
+
+void StateCachingRenderDevice::ClearColor(float red, float green, float blue, float alpha)
+{
+	m_Device->ClearColor(red, green, blue, alpha);
+}
+
+void StateCachingRenderDevice::CompileShader(uint32_t shader)
+{
+	m_Device->CompileShader(shader);
+}
+
+void StateCachingRenderDevice::CopyBufferSubData(uint32_t readTarget, uint32_t writeTarget, ptrdiff_t readOffset, ptrdiff_t writeOffset, ptrdiff_t size)
+{
+	m_Device->CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+void StateCachingRenderDevice::CopyImageSubData(uint32_t sourceName, uint32_t sourceTarget, int32_t sourceLevel, int32_t sourceX, int32_t sourceY, int32_t sourceZ, uint32_t destinationName, uint32_t destinationTarget, int32_t destinationLevel, int32_t destinationX, int32_t destinationY, int32_t destinationZ, int32_t width, int32_t height, int32_t depth)
+{
+	m_Device->CopyImageSubData(sourceName, sourceTarget, sourceLevel, sourceX, sourceY, sourceZ, destinationName, destinationTarget, destinationLevel, destinationX, destinationY, destinationZ, width, height, depth);
+}
+
+uint32_t StateCachingRenderDevice::CreateProgram()
+{
+	return m_Device->CreateProgram();
+}
+
+uint32_t StateCachingRenderDevice::CreateShader(uint32_t type)
+{
+	return m_Device->CreateShader(type);
+}
+
+void StateCachingRenderDevice::DeleteRenderbuffers(int32_t count, const uint32_t* renderbuffers)
+{
+	m_Device->DeleteRenderbuffers(count, renderbuffers);
+}
+
+void StateCachingRenderDevice::DeleteShader(uint32_t shader)
+{
+	m_Device->DeleteShader(shader);
+}
+
+void StateCachingRenderDevice::DispatchCompute(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ)
+{
+	m_Device->DispatchCompute(groupsX, groupsY, groupsZ);
+}
+
+void StateCachingRenderDevice::DrawArrays(uint32_t mode, int32_t first, int32_t count)
+{
+	m_Device->DrawArrays(mode, first, count);
+}
+
+void StateCachingRenderDevice::DrawBuffer(uint32_t buffer)
+{
+	m_Device->DrawBuffer(buffer);
+}
+
+void StateCachingRenderDevice::DrawElements(uint32_t mode, int32_t count, uint32_t type, const void* indices)
+{
+	m_Device->DrawElements(mode, count, type, indices);
+}
+
+void StateCachingRenderDevice::DrawElementsBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t baseVertex)
+{
+	m_Device->DrawElementsBaseVertex(mode, count, type, indices, baseVertex);
+}
+
+void StateCachingRenderDevice::DrawElementsInstanced(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances)
+{
+	m_Device->DrawElementsInstanced(mode, count, type, indices, instances);
+}
+
+void StateCachingRenderDevice::DrawElementsInstancedBaseVertex(uint32_t mode, int32_t count, uint32_t type, const void* indices, int32_t instances, int32_t baseVertex)
+{
+	m_Device->DrawElementsInstancedBaseVertex(mode, count, type, indices, instances, baseVertex);
+}
+
+void StateCachingRenderDevice::EnableVertexAttribArray(uint32_t index)
+{
+	m_Device->EnableVertexAttribArray(index);
+}
+
+void StateCachingRenderDevice::FramebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbufferTarget, uint32_t renderbuffer)
+{
+	m_Device->FramebufferRenderbuffer(target, attachment, renderbufferTarget, renderbuffer);
+}
+
+void StateCachingRenderDevice::FramebufferTexture(uint32_t target, uint32_t attachment, uint32_t texture, int32_t level)
+{
+	m_Device->FramebufferTexture(target, attachment, texture, level);
+}
+
+void StateCachingRenderDevice::FramebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textureTarget, uint32_t texture, int32_t level)
+{
+	m_Device->FramebufferTexture2D(target, attachment, textureTarget, texture, level);
+}
+
+void StateCachingRenderDevice::GenBuffers(int32_t count, uint32_t* buffers)
+{
+	m_Device->GenBuffers(count, buffers);
+}
+
+void StateCachingRenderDevice::GenFramebuffers(int32_t count, uint32_t* framebuffers)
+{
+	m_Device->GenFramebuffers(count, framebuffers);
+}
+
+void StateCachingRenderDevice::GenRenderbuffers(int32_t count, uint32_t* renderbuffers)
+{
+	m_Device->GenRenderbuffers(count, renderbuffers);
+}
+
+void StateCachingRenderDevice::GenTextures(int32_t count, uint32_t* textures)
+{
+	m_Device->GenTextures(count, textures);
+}
+
+void StateCachingRenderDevice::GenVertexArrays(int32_t count, uint32_t* arrays)
+{
+	m_Device->GenVertexArrays(count, arrays);
+}
+
+void StateCachingRenderDevice::GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name)
+{
+	m_Device->GetActiveUniform(program, index, bufferSize, length, size, type, name);
+}
+
+void StateCachingRenderDevice::GetActiveUniformBlockiv(uint32_t program, uint32_t blockIndex, uint32_t parameter, int32_t* value)
+{
+	m_Device->GetActiveUniformBlockiv(program, blockIndex, parameter, value);
+}
+
+void StateCachingRenderDevice::GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values)
+{
+	m_Device->GetActiveUniformsiv(program, count, indices, parameter, values);
+}
+
+uint32_t StateCachingRenderDevice::GetError()
+{
+	return m_Device->GetError();
+}
+
+void StateCachingRenderDevice::GetProgramInfoLog(uint32_t program, int32_t bufferSize, int32_t* length, char* infoLog)
+{
+	m_Device->GetProgramInfoLog(program, bufferSize, length, infoLog);
+}
+
+void StateCachingRenderDevice::GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value)
+{
+	m_Device->GetProgramiv(program, parameter, value);
+}
+
+void StateCachingRenderDevice::GetShaderInfoLog(uint32_t shader, int32_t bufferSize, int32_t* length, char* infoLog)
+{
+	m_Device->GetShaderInfoLog(shader, bufferSize, length, infoLog);
+}
+
+void StateCachingRenderDevice::GetShaderiv(uint32_t shader, uint32_t parameter, int32_t* value)
+{
+	m_Device->GetShaderiv(shader, parameter, value);
+}
+
+uint32_t StateCachingRenderDevice::GetUniformBlockIndex(uint32_t program, const char* name)
+{
+	return m_Device->GetUniformBlockIndex(program, name);
+}
+
+int32_t StateCachingRenderDevice::GetUniformLocation(uint32_t program, const char* name)
+{
+	return m_Device->GetUniformLocation(program, name);
+}
+
+void StateCachingRenderDevice::LinkProgram(uint32_t program)
+{
+	m_Device->LinkProgram(program);
+}
+
+void* StateCachingRenderDevice::MapBufferRange(uint32_t target, ptrdiff_t offset, ptrdiff_t length, uint32_t access)
+{
+	return m_Device->MapBufferRange(target, offset, length, access);
+}
+
+void StateCachingRenderDevice::MemoryBarrierBits(uint32_t barriers)
+{
+	m_Device->MemoryBarrierBits(barriers);
+}
+
+void StateCachingRenderDevice::MultiDrawElementsIndirect(uint32_t mode, uint32_t type, const void* indirect, int32_t drawCount, int32_t stride)
+{
+	m_Device->MultiDrawElementsIndirect(mode, type, indirect, drawCount, stride);
+}
+
+void StateCachingRenderDevice::ProgramParameteri(uint32_t program, uint32_t parameter, int32_t value)
+{
+	m_Device->ProgramParameteri(program, parameter, value);
+}
+
+void StateCachingRenderDevice::ReadBuffer(uint32_t buffer)
+{
+	m_Device->ReadBuffer(buffer);
+}
+
+void StateCachingRenderDevice::RenderbufferStorage(uint32_t target, uint32_t internalFormat, int32_t width, int32_t height)
+{
+	m_Device->RenderbufferStorage(target, internalFormat, width, height);
+}
+
+void StateCachingRenderDevice::ShaderSource(uint32_t shader, int32_t count, const char* const* sources, const int32_t* lengths)
+{
+	m_Device->ShaderSource(shader, count, sources, lengths);
+}
+
+void StateCachingRenderDevice::Uniform1f(int32_t location, float x)
+{
+	m_Device->Uniform1f(location, x);
+}
+
+void StateCachingRenderDevice::Uniform1i(int32_t location, int32_t x)
+{
+	m_Device->Uniform1i(location, x);
+}
+
+void StateCachingRenderDevice::Uniform1ui(int32_t location, uint32_t x)
+{
+	m_Device->Uniform1ui(location, x);
+}
+
+void StateCachingRenderDevice::Uniform2f(int32_t location, float x, float y)
+{
+	m_Device->Uniform2f(location, x, y);
+}
+
+void StateCachingRenderDevice::Uniform3f(int32_t location, float x, float y, float z)
+{
+	m_Device->Uniform3f(location, x, y, z);
+}
+
+void StateCachingRenderDevice::Uniform4f(int32_t location, float x, float y, float z, float w)
+{
+	m_Device->Uniform4f(location, x, y, z, w);
+}
+
+void StateCachingRenderDevice::UniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float* values)
+{
+	m_Device->UniformMatrix4fv(location, count, transpose, values);
+}
+
+bool StateCachingRenderDevice::UnmapBuffer(uint32_t target)
+{
+	return m_Device->UnmapBuffer(target);
+}
+
+void StateCachingRenderDevice::VertexAttribDivisor(uint32_t index, uint32_t divisor)
+{
+	m_Device->VertexAttribDivisor(index, divisor);
+}
+
+void StateCachingRenderDevice::VertexAttribIPointer(uint32_t index, int32_t size, uint32_t type, int32_t stride, const void* offset)
+{
+	m_Device->VertexAttribIPointer(index, size, type, stride, offset);
+}
+
+void StateCachingRenderDevice::VertexAttribPointer(uint32_t index, int32_t size, uint32_t type, bool normalized, int32_t stride, const void* offset)
+{
+	m_Device->VertexAttribPointer(index, size, type, normalized, stride, offset);
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "FrameBindings.h"
+
+#include <array>
+
+#include <glad/glad.h>
+#include "Device/RenderDevice.h"
+
+#include "Shader.h"
+#include "Scene/FrameLights.h"
+
+struct FrameSamplers
+{
+	UniformID IrradianceMap = UniformName::Get("u_IrradianceMap");
+	UniformID PrefilterMap = UniformName::Get("u_PrefilterMap");
+	UniformID BRDFLUT = UniformName::Get("u_BRDFLUT");
+	UniformID DirectionalLightShadowMap = UniformName::Get("u_DirectionalLightShadowMap");
+	std::array<UniformID, MAX_POINT_LIGHTS> PointLightShadowMaps;
+	std::array<UniformID, MAX_SPOT_LIGHTS> SpotLightShadowMaps;
+
+	FrameSamplers()
+	{
+		for (uint32_t i = 0; i < PointLightShadowMaps.size(); i++)
+			PointLightShadowMaps[i] = UniformName::Get("u_PointLightShadowMaps", i);
+		for (uint32_t i = 0; i < SpotLightShadowMaps.size(); i++)
+			SpotLightShadowMaps[i] = UniformName::Get("u_SpotLightShadowMaps", i);
+	}
+};
+
+static const FrameSamplers& GetFrameSamplers()
+{
+	static const FrameSamplers samplers;
+	return samplers;
+}
+
+void FrameBindings::AssignSamplers(const Shader& shader)
+{
+	const FrameSamplers& samplers = GetFrameSamplers();
+
+	// Samplers the program does not declare are skipped by its uniform table
+	shader.Use();
+	shader.SetInt(samplers.IrradianceMap, IRRADIANCE_MAP_UNIT);
+	shader.SetInt(samplers.PrefilterMap, PREFILTER_MAP_UNIT);
+	shader.SetInt(samplers.BRDFLUT, BRDF_LUT_UNIT);
+	shader.SetInt(samplers.DirectionalLightShadowMap, DIRECTIONAL_LIGHT_SHADOW_MAP_UNIT);
+
+	for (int i = 0; i < MAX_POINT_LIGHTS; i++)
+		shader.SetInt(samplers.PointLightShadowMaps[i], POINT_LIGHT_SHADOW_MAPS_UNIT + i);
+
+	for (int i = 0; i < MAX_SPOT_LIGHTS; i++)
+		shader.SetInt(samplers.SpotLightShadowMaps[i], SPOT_LIGHT_SHADOW_MAPS_UNIT + i);
+}
+
+void FrameBindings::BindTextures(const FrameLights& lights, uint32_t directionalLightShadowMap)
+{
+	RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + IRRADIANCE_MAP_UNIT);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, lights.IrradianceMap);
+	RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + PREFILTER_MAP_UNIT);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, lights.PrefilterMap);
+	RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + BRDF_LUT_UNIT);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_2D, lights.BRDFLUT);
+	RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + DIRECTIONAL_LIGHT_SHADOW_MAP_UNIT);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_2D, directionalLightShadowMap);
+
+	for (int i = 0; i < MAX_POINT_LIGHTS; i++)
+	{
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + POINT_LIGHT_SHADOW_MAPS_UNIT + i);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, lights.PointLightShadowMaps[i]);
+	}
+
+	for (int i = 0; i < MAX_SPOT_LIGHTS; i++)
+	{
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + SPOT_LIGHT_SHADOW_MAPS_UNIT + i);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, lights.SpotLightShadowMaps[i]);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Scene/Component/Light/Light.h"
+
+class Shader;
+struct FrameLights;
+
+// Texture units reserved for the resources every draw of a frame shares, materials bind their own textures from unit 0
+#define IRRADIANCE_MAP_UNIT 20
+#define PREFILTER_MAP_UNIT 21
+#define BRDF_LUT_UNIT 22
+#define DIRECTIONAL_LIGHT_SHADOW_MAP_UNIT 23
+#define POINT_LIGHT_SHADOW_MAPS_UNIT 24
+#define SPOT_LIGHT_SHADOW_MAPS_UNIT (POINT_LIGHT_SHADOW_MAPS_UNIT + MAX_POINT_LIGHTS)
+
+namespace FrameBindings
+{
+	// Points the frame samplers the program declares at their reserved units.
+	// Programs keep sampler values, so this runs once after linking and leaves the program in use.
+	void AssignSamplers(const Shader& shader);
+	// Binds the frame's textures into the reserved units, once before the draws using them
+	void BindTextures(const FrameLights& lights, uint32_t directionalLightShadowMap);
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Framebuffer.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 #include "Renderer.h"
 
 Ref<Framebuffer> Framebuffer::Create(const FramebufferConfig& config)
@@ -16,25 +17,25 @@ Framebuffer::Framebuffer(const FramebufferConfig& config)
 
 Framebuffer::~Framebuffer()
 {
-	glDeleteFramebuffers(1, &m_ID);
-	glDeleteTextures(1, &m_ColorAttachment);
-	glDeleteRenderbuffers(1, &m_DepthAttachment);
+	RenderDevice::Get().DeleteFramebuffers(1, &m_ID);
+	RenderDevice::Get().DeleteTextures(1, &m_ColorAttachment);
+	RenderDevice::Get().DeleteRenderbuffers(1, &m_DepthAttachment);
 }
 
 void Framebuffer::Bind()
 {
-	glBindFramebuffer(GL_FRAMEBUFFER, m_ID);
-	glViewport(0, 0, m_Config.Width, m_Config.Height);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_ID);
+	RenderDevice::Get().Viewport(0, 0, m_Config.Width, m_Config.Height);
 }
 
 void Framebuffer::UpdateTarget(const FramebufferTextureConfig& textureConfig, int i)
 {
-	glFramebufferTexture2D(GL_FRAMEBUFFER, textureConfig.Attachment, textureConfig.Target + i, m_ColorAttachment, 0);
+	RenderDevice::Get().FramebufferTexture2D(GL_FRAMEBUFFER, textureConfig.Attachment, textureConfig.Target + i, m_ColorAttachment, 0);
 }
 
 void Framebuffer::Unbind()
 {
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
 void Framebuffer::Resize(uint32_t width, uint32_t height)
@@ -44,13 +45,13 @@ void Framebuffer::Resize(uint32_t width, uint32_t height)
 
 	if (m_ID)
 	{
-		glDeleteFramebuffers(1, &m_ID);
-		glDeleteTextures(1, &m_ColorAttachment);
-		glDeleteRenderbuffers(1, &m_DepthAttachment);
+		RenderDevice::Get().DeleteFramebuffers(1, &m_ID);
+		RenderDevice::Get().DeleteTextures(1, &m_ColorAttachment);
+		RenderDevice::Get().DeleteRenderbuffers(1, &m_DepthAttachment);
 	}
 
-	glGenFramebuffers(1, &m_ID);
-	glBindFramebuffer(GL_FRAMEBUFFER, m_ID);
+	RenderDevice::Get().GenFramebuffers(1, &m_ID);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_ID);
 
 	if (m_Config.Textures.size())
 	{
@@ -66,48 +67,48 @@ void Framebuffer::Resize(uint32_t width, uint32_t height)
 				attachment = &m_DepthAttachment;
 			}
 
-			glGenTextures(1, attachment);
-			glBindTexture(textureConfig.Target, *attachment);
-			glTexImage2D(textureConfig.Target, 0, textureConfig.InternalFormat, m_Config.Width, m_Config.Height, 0, textureConfig.Format, textureConfig.Type, nullptr);
+			RenderDevice::Get().GenTextures(1, attachment);
+			RenderDevice::Get().BindTexture(textureConfig.Target, *attachment);
+			RenderDevice::Get().TexImage2D(textureConfig.Target, 0, textureConfig.InternalFormat, m_Config.Width, m_Config.Height, 0, textureConfig.Format, textureConfig.Type, nullptr);
 
-			glTexParameteri(textureConfig.Target, GL_TEXTURE_MIN_FILTER, textureConfig.MinFilter);
-			glTexParameteri(textureConfig.Target, GL_TEXTURE_MAG_FILTER, textureConfig.MagFilter);
+			RenderDevice::Get().TexParameteri(textureConfig.Target, GL_TEXTURE_MIN_FILTER, textureConfig.MinFilter);
+			RenderDevice::Get().TexParameteri(textureConfig.Target, GL_TEXTURE_MAG_FILTER, textureConfig.MagFilter);
 
 			if (textureConfig.WrapS != GL_NONE && textureConfig.WrapT != GL_NONE)
 			{
-				glTexParameteri(textureConfig.Target, GL_TEXTURE_WRAP_S, textureConfig.WrapS);
-				glTexParameteri(textureConfig.Target, GL_TEXTURE_WRAP_T, textureConfig.WrapT);
+				RenderDevice::Get().TexParameteri(textureConfig.Target, GL_TEXTURE_WRAP_S, textureConfig.WrapS);
+				RenderDevice::Get().TexParameteri(textureConfig.Target, GL_TEXTURE_WRAP_T, textureConfig.WrapT);
 			}
 
 			if (textureConfig.Border)
 			{
 				float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-				glTexParameterfv(textureConfig.Target, GL_TEXTURE_BORDER_COLOR, border);
+				RenderDevice::Get().TexParameterfv(textureConfig.Target, GL_TEXTURE_BORDER_COLOR, border);
 			}
 
-			glFramebufferTexture2D(GL_FRAMEBUFFER, textureConfig.Attachment, textureConfig.Target, *attachment, 0);
+			RenderDevice::Get().FramebufferTexture2D(GL_FRAMEBUFFER, textureConfig.Attachment, textureConfig.Target, *attachment, 0);
 		}
 	}
 	
 	if (!m_ColorAttachment)
 	{
-		glDrawBuffer(GL_NONE);
-		glReadBuffer(GL_NONE);
+		RenderDevice::Get().DrawBuffer(GL_NONE);
+		RenderDevice::Get().ReadBuffer(GL_NONE);
 	}
 
 	if (m_Config.Renderbuffers.size())
 	{
 		for (auto& renderbufferConfig : m_Config.Renderbuffers)
 		{
-			glGenRenderbuffers(1, &m_DepthAttachment);
-			glBindRenderbuffer(GL_RENDERBUFFER, m_DepthAttachment);
-			glRenderbufferStorage(GL_RENDERBUFFER, renderbufferConfig.InternalFormat, m_Config.Width, m_Config.Height);
-			glFramebufferRenderbuffer(GL_FRAMEBUFFER, renderbufferConfig.Attachment, GL_RENDERBUFFER, m_DepthAttachment);
+			RenderDevice::Get().GenRenderbuffers(1, &m_DepthAttachment);
+			RenderDevice::Get().BindRenderbuffer(GL_RENDERBUFFER, m_DepthAttachment);
+			RenderDevice::Get().RenderbufferStorage(GL_RENDERBUFFER, renderbufferConfig.InternalFormat, m_Config.Width, m_Config.Height);
+			RenderDevice::Get().FramebufferRenderbuffer(GL_FRAMEBUFFER, renderbufferConfig.Attachment, GL_RENDERBUFFER, m_DepthAttachment);
 		}
 	}
 
-	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	if (RenderDevice::Get().CheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 		std::cout << "Framebuffer is incomplete!" << std::endl;
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 }
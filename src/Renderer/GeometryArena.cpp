@@ -0,0 +1,333 @@
+#include "GeometryArena.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <glad/glad.h>
+#include "Device/RenderDevice.h"
+
+#include "Mesh.h"
+
+Ref<GeometryArena> GeometryArena::s_Instance{};
+std::mutex GeometryArena::s_Mutex;
+
+// Room for a few dozen imported models before the first growth
+#define INITIAL_VERTEX_CAPACITY (1 << 16)
+#define INITIAL_INDEX_CAPACITY (1 << 18)
+#define INITIAL_DRAW_INDEX_CAPACITY 1024
+
+template<typename Ranges>
+static int32_t FindRange(const Ranges& ranges, uint32_t count)
+{
+	for (size_t i = 0; i < ranges.size(); i++)
+	{
+		if (ranges[i].Count >= count)
+			return (int32_t)i;
+	}
+
+	return -1;
+}
+
+template<typename Ranges>
+static uint32_t TakeRange(Ranges& ranges, int32_t index, uint32_t count)
+{
+	uint32_t offset = ranges[index].Offset;
+	ranges[index].Offset += count;
+	ranges[index].Count -= count;
+	if (ranges[index].Count == 0)
+		ranges.erase(ranges.begin() + index);
+
+	return offset;
+}
+
+template<typename Ranges, typename Range>
+static void ReturnRange(Ranges& ranges, Range range)
+{
+	if (range.Count == 0)
+		return;
+
+	auto it = std::lower_bound(ranges.begin(), ranges.end(), range, [](const Range& a, const Range& b) { return a.Offset < b.Offset; });
+	it = ranges.insert(it, range);
+
+	// Merge with the following range, then with the previous one
+	if (it + 1 != ranges.end() && it->Offset + it->Count == (it + 1)->Offset)
+	{
+		it->Count += (it + 1)->Count;
+		ranges.erase(it + 1);
+	}
+	if (it != ranges.begin() && (it - 1)->Offset + (it - 1)->Count == it->Offset)
+	{
+		(it - 1)->Count += it->Count;
+		ranges.erase(it);
+	}
+}
+
+template<typename Ranges>
+static uint32_t CountFree(const Ranges& ranges)
+{
+	uint32_t count = 0;
+	for (auto& range : ranges)
+		count += range.Count;
+
+	return count;
+}
+
+// Free space not at the end of the buffer, compared to the part of the buffer in use
+template<typename Ranges>
+static bool HasHoles(const Ranges& ranges, uint32_t capacity)
+{
+	uint32_t holes = CountFree(ranges);
+	uint32_t usedEnd = capacity;
+	if (!ranges.empty() && ranges.back().Offset + ranges.back().Count == capacity)
+	{
+		holes -= ranges.back().Count;
+		usedEnd = ranges.back().Offset;
+	}
+
+	return holes * 4 > usedEnd;
+}
+
+GeometryArena::GeometryArena()
+{
+	RenderDevice::Get().GenVertexArrays(1, &m_VAO);
+	RenderDevice::Get().GenBuffers(1, &m_DrawIndexBuffer);
+
+	// Divisor 1 and the draw's base instance select the element holding the draw's index
+	RenderDevice::Get().BindVertexArray(m_VAO);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, m_DrawIndexBuffer);
+	RenderDevice::Get().EnableVertexAttribArray(DRAW_INDEX_ATTRIBUTE);
+	RenderDevice::Get().VertexAttribIPointer(DRAW_INDEX_ATTRIBUTE, 1, GL_UNSIGNED_INT, sizeof(uint32_t), (void*)0);
+	RenderDevice::Get().VertexAttribDivisor(DRAW_INDEX_ATTRIBUTE, 1);
+	RenderDevice::Get().BindVertexArray(0);
+
+	ReserveDrawIndices(INITIAL_DRAW_INDEX_CAPACITY);
+	Reallocate(INITIAL_VERTEX_CAPACITY, INITIAL_INDEX_CAPACITY, false);
+}
+
+Ref<GeometryArena> GeometryArena::GetInstance()
+{
+	std::lock_guard<std::mutex> lock(s_Mutex);
+	if (s_Instance == nullptr)
+		s_Instance = CreateRef<GeometryArena>();
+
+	return s_Instance;
+}
+
+GeometryHandle GeometryArena::Allocate(const Vertex* vertices, uint32_t verticesCount, const uint32_t* indices, uint32_t indicesCount)
+{
+	if (verticesCount == 0 || indicesCount == 0)
+		return INVALID_GEOMETRY_HANDLE;
+
+	int32_t vertexRange = FindRange(m_FreeVertexRanges, verticesCount);
+	int32_t indexRange = FindRange(m_FreeIndexRanges, indicesCount);
+	if (vertexRange < 0 || indexRange < 0)
+	{
+		// Packing leaves all the free space in one range, grow only when that is not enough
+		uint32_t freeVertices = GetFreeVerticesCount();
+		uint32_t freeIndices = CountFree(m_FreeIndexRanges);
+		if (freeVertices >= verticesCount && freeIndices >= indicesCount)
+		{
+			Defragment();
+		}
+		else
+		{
+			uint32_t vertexCapacity = std::max(m_VertexCapacity * 2, m_VertexCapacity - freeVertices + verticesCount);
+			uint32_t indexCapacity = std::max(m_IndexCapacity * 2, m_IndexCapacity - freeIndices + indicesCount);
+			Reallocate(vertexCapacity, indexCapacity, true);
+		}
+
+		vertexRange = FindRange(m_FreeVertexRanges, verticesCount);
+		indexRange = FindRange(m_FreeIndexRanges, indicesCount);
+	}
+
+	GeometryAllocation allocation;
+	allocation.FirstVertex = TakeRange(m_FreeVertexRanges, vertexRange, verticesCount);
+	allocation.VerticesCount = verticesCount;
+	allocation.FirstIndex = TakeRange(m_FreeIndexRanges, indexRange, indicesCount);
+	allocation.IndicesCount = indicesCount;
+
+	RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, m_VertexBuffer);
+	RenderDevice::Get().BufferSubData(GL_COPY_WRITE_BUFFER, allocation.FirstVertex * sizeof(Vertex), verticesCount * sizeof(Vertex), vertices);
+	RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, m_IndexBuffer);
+	RenderDevice::Get().BufferSubData(GL_COPY_WRITE_BUFFER, allocation.FirstIndex * sizeof(uint32_t), indicesCount * sizeof(uint32_t), indices);
+	RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	GeometryHandle handle;
+	if (!m_FreeHandles.empty())
+	{
+		handle = m_FreeHandles.back();
+		m_FreeHandles.pop_back();
+		m_Allocations[handle] = allocation;
+		m_Live[handle] = 1;
+	}
+	else
+	{
+		handle = m_Allocations.size();
+		m_Allocations.push_back(allocation);
+		m_Live.push_back(1);
+	}
+
+	return handle;
+}
+
+void GeometryArena::Free(GeometryHandle handle)
+{
+	if (handle == INVALID_GEOMETRY_HANDLE || !m_Live[handle])
+		return;
+
+	const GeometryAllocation& allocation = m_Allocations[handle];
+	ReturnRange(m_FreeVertexRanges, Range{ allocation.FirstVertex, allocation.VerticesCount });
+	ReturnRange(m_FreeIndexRanges, Range{ allocation.FirstIndex, allocation.IndicesCount });
+
+	m_Allocations[handle] = GeometryAllocation();
+	m_Live[handle] = 0;
+	m_FreeHandles.push_back(handle);
+}
+
+void GeometryArena::Defragment()
+{
+	if (m_FreeVertexRanges.size() <= 1 && m_FreeIndexRanges.size() <= 1 && !IsFragmented())
+		return;
+
+	Reallocate(m_VertexCapacity, m_IndexCapacity, true);
+}
+
+bool GeometryArena::IsFragmented() const
+{
+	return HasHoles(m_FreeVertexRanges, m_VertexCapacity) || HasHoles(m_FreeIndexRanges, m_IndexCapacity);
+}
+
+void GeometryArena::AttachVertexArray(uint32_t vao)
+{
+	m_AttachedVertexArrays.push_back(vao);
+	SetupVertexArray(vao);
+}
+
+void GeometryArena::DetachVertexArray(uint32_t vao)
+{
+	auto it = std::find(m_AttachedVertexArrays.begin(), m_AttachedVertexArrays.end(), vao);
+	if (it != m_AttachedVertexArrays.end())
+		m_AttachedVertexArrays.erase(it);
+}
+
+void GeometryArena::ReserveDrawIndices(uint32_t count)
+{
+	if (count <= m_DrawIndexCapacity)
+		return;
+
+	m_DrawIndexCapacity = std::max(count, m_DrawIndexCapacity * 2);
+
+	std::vector<uint32_t> drawIndices(m_DrawIndexCapacity);
+	std::iota(drawIndices.begin(), drawIndices.end(), 0);
+
+	// Same buffer name, so the vertex array keeps sourcing from it
+	RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, m_DrawIndexBuffer);
+	RenderDevice::Get().BufferData(GL_COPY_WRITE_BUFFER, drawIndices.size() * sizeof(uint32_t), drawIndices.data(), GL_STATIC_DRAW);
+	RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+uint32_t GeometryArena::GetFreeVerticesCount() const
+{
+	return CountFree(m_FreeVertexRanges);
+}
+
+void GeometryArena::Reallocate(uint32_t vertexCapacity, uint32_t indexCapacity, bool compact)
+{
+	// Copies the live elements of every allocation into the new buffer, returns where the packed data ends
+	auto copy = [&](uint32_t source, uint32_t destination, uint32_t elementSize,
+		uint32_t GeometryAllocation::* first, uint32_t GeometryAllocation::* count, std::vector<Range>& freeRanges, uint32_t oldCapacity, uint32_t newCapacity)
+	{
+		RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, destination);
+		RenderDevice::Get().BufferData(GL_COPY_WRITE_BUFFER, (ptrdiff_t)newCapacity * elementSize, nullptr, GL_STATIC_DRAW);
+
+		if (!source)
+		{
+			freeRanges = { Range{ 0, newCapacity } };
+			return;
+		}
+
+		RenderDevice::Get().BindBuffer(GL_COPY_READ_BUFFER, source);
+
+		if (!compact)
+		{
+			RenderDevice::Get().CopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (ptrdiff_t)oldCapacity * elementSize);
+			ReturnRange(freeRanges, Range{ oldCapacity, newCapacity - oldCapacity });
+			return;
+		}
+
+		// Kept in their current order so meshes imported together stay together
+		std::vector<GeometryHandle> handles;
+		for (GeometryHandle handle = 0; handle < m_Allocations.size(); handle++)
+		{
+			if (m_Live[handle])
+				handles.push_back(handle);
+		}
+		std::sort(handles.begin(), handles.end(), [&](GeometryHandle a, GeometryHandle b) { return m_Allocations[a].*first < m_Allocations[b].*first; });
+
+		uint32_t end = 0;
+		for (GeometryHandle handle : handles)
+		{
+			GeometryAllocation& allocation = m_Allocations[handle];
+			RenderDevice::Get().CopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+				(ptrdiff_t)(allocation.*first) * elementSize, (ptrdiff_t)end * elementSize, (ptrdiff_t)(allocation.*count) * elementSize);
+			allocation.*first = end;
+			end += allocation.*count;
+		}
+
+		freeRanges.clear();
+		if (end < newCapacity)
+			freeRanges.push_back(Range{ end, newCapacity - end });
+	};
+
+	uint32_t vertexBuffer, indexBuffer;
+	RenderDevice::Get().GenBuffers(1, &vertexBuffer);
+	RenderDevice::Get().GenBuffers(1, &indexBuffer);
+
+	copy(m_VertexBuffer, vertexBuffer, sizeof(Vertex), &GeometryAllocation::FirstVertex, &GeometryAllocation::VerticesCount,
+		m_FreeVertexRanges, m_VertexCapacity, vertexCapacity);
+	copy(m_IndexBuffer, indexBuffer, sizeof(uint32_t), &GeometryAllocation::FirstIndex, &GeometryAllocation::IndicesCount,
+		m_FreeIndexRanges, m_IndexCapacity, indexCapacity);
+
+	RenderDevice::Get().BindBuffer(GL_COPY_READ_BUFFER, 0);
+	RenderDevice::Get().BindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	if (m_VertexBuffer)
+		RenderDevice::Get().DeleteBuffers(1, &m_VertexBuffer);
+	if (m_IndexBuffer)
+		RenderDevice::Get().DeleteBuffers(1, &m_IndexBuffer);
+
+	m_VertexBuffer = vertexBuffer;
+	m_IndexBuffer = indexBuffer;
+	m_VertexCapacity = vertexCapacity;
+	m_IndexCapacity = indexCapacity;
+
+	SetupVertexArray(m_VAO);
+	for (uint32_t vao : m_AttachedVertexArrays)
+		SetupVertexArray(vao);
+}
+
+void GeometryArena::SetupVertexArray(uint32_t vao) const
+{
+	RenderDevice::Get().BindVertexArray(vao);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
+
+	// Vertex positions
+	RenderDevice::Get().EnableVertexAttribArray(0);
+	RenderDevice::Get().VertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+
+	// Vertex normals
+	RenderDevice::Get().EnableVertexAttribArray(1);
+	RenderDevice::Get().VertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+
+	// Vertex texture coords
+	RenderDevice::Get().EnableVertexAttribArray(2);
+	RenderDevice::Get().VertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
+
+	// Tangent
+	RenderDevice::Get().EnableVertexAttribArray(3);
+	RenderDevice::Get().VertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, tangent));
+
+	RenderDevice::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer);
+	RenderDevice::Get().BindVertexArray(0);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
+}
\ No newline at end of file
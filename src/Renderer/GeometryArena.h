@@ -0,0 +1,97 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "typedefs.h"
+
+struct Vertex;
+
+// Index of a mesh's allocation, stays valid until freed even when the arena moves the data
+typedef uint32_t GeometryHandle;
+#define INVALID_GEOMETRY_HANDLE 0xFFFFFFFF
+
+// Counted in vertices and indices, not bytes
+struct GeometryAllocation
+{
+	uint32_t FirstVertex = 0;
+	uint32_t VerticesCount = 0;
+	uint32_t FirstIndex = 0;
+	uint32_t IndicesCount = 0;
+};
+
+// Vertices and indices of every mesh, suballocated from two large buffers and read through a single vertex array.
+// Meshes only differ by their base vertex and first index, so the renderer can submit many of them with one
+// glMultiDrawElementsIndirect. Freed ranges are reused first fit, Defragment packs the live allocations together.
+class GeometryArena
+{
+public:
+	// Per-instance attribute of the arena's vertex array holding the index of a draw in a multi-draw.
+	// It is read at the draw's base instance, which the renderer sets to the draw's index.
+	static constexpr uint32_t DRAW_INDEX_ATTRIBUTE = 8;
+
+private:
+	struct Range
+	{
+		uint32_t Offset;
+		uint32_t Count;
+	};
+
+	static Ref<GeometryArena> s_Instance;
+	static std::mutex s_Mutex;
+
+	uint32_t m_VAO = 0;
+	uint32_t m_VertexBuffer = 0;
+	uint32_t m_IndexBuffer = 0;
+	uint32_t m_DrawIndexBuffer = 0;
+
+	uint32_t m_VertexCapacity = 0;
+	uint32_t m_IndexCapacity = 0;
+	uint32_t m_DrawIndexCapacity = 0;
+
+	std::vector<GeometryAllocation> m_Allocations;
+	std::vector<uint8_t> m_Live;
+	std::vector<GeometryHandle> m_FreeHandles;
+	// Sorted by offset, neighbours are merged
+	std::vector<Range> m_FreeVertexRanges;
+	std::vector<Range> m_FreeIndexRanges;
+
+	// Vertex arrays of other users (e.g. instanced meshes) reading the arena's buffers
+	std::vector<uint32_t> m_AttachedVertexArrays;
+
+public:
+	// Lives until exit like the other singletons, its objects go with the context
+	GeometryArena();
+
+	GeometryArena(GeometryArena& other) = delete;
+	void operator=(const GeometryArena&) = delete;
+
+	static Ref<GeometryArena> GetInstance();
+
+	GeometryHandle Allocate(const Vertex* vertices, uint32_t verticesCount, const uint32_t* indices, uint32_t indicesCount);
+	void Free(GeometryHandle handle);
+
+	// Moves every live allocation to the start of the buffers, leaving one free range at the end
+	void Defragment();
+	// True when more than a quarter of the used part of a buffer is holes left by freed meshes
+	bool IsFragmented() const;
+
+	// Points the mesh attributes and index buffer of the vertex array at the arena, again whenever the buffers are replaced
+	void AttachVertexArray(uint32_t vao);
+	void DetachVertexArray(uint32_t vao);
+
+	// Makes the draw index attribute cover draw indices below count
+	void ReserveDrawIndices(uint32_t count);
+
+	inline const GeometryAllocation& Get(GeometryHandle handle) const { return m_Allocations[handle]; }
+	inline uint32_t GetVAO() const { return m_VAO; }
+	inline uint32_t GetVertexCapacity() const { return m_VertexCapacity; }
+	inline uint32_t GetIndexCapacity() const { return m_IndexCapacity; }
+	uint32_t GetFreeVerticesCount() const;
+	inline uint32_t GetFreeVertexRangesCount() const { return m_FreeVertexRanges.size(); }
+
+private:
+	// Replaces the buffers with ones of the given capacities, copying the live data over (packed when compacting)
+	void Reallocate(uint32_t vertexCapacity, uint32_t indexCapacity, bool compact);
+	void SetupVertexArray(uint32_t vao) const;
+};
\ No newline at end of file
@@ -1,111 +1,45 @@
 #include "Mesh.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 
-Mesh::Mesh(std::vector<Vertex> inVertices, std::vector<unsigned int> inIndices, bool instanced)
-	: vertices(inVertices), indices(inIndices)
+Mesh::Mesh(std::vector<Vertex> inVertices, std::vector<unsigned int> inIndices, AABB bounds)
+	: vertices(std::move(inVertices)), indices(std::move(inIndices)), m_Bounds(bounds)
 {
-	if (instanced)
-		SetupMeshInstanced();
-	else
-		SetupMesh();
+	Ref<GeometryArena> arena = GeometryArena::GetInstance();
+	m_VAO = arena->GetVAO();
+	m_Geometry = arena->Allocate(vertices.data(), vertices.size(), indices.data(), indices.size());
 }
 
-void Mesh::Render()
+void Mesh::Render() const
 {
-	glBindVertexArray(VAO);
-	glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
-	glBindVertexArray(0);
+	RenderDevice::Get().BindVertexArray(m_VAO);
+	Draw();
+	RenderDevice::Get().BindVertexArray(0);
 }
 
-void Mesh::RenderInstanced(uint32_t count)
+void Mesh::Draw() const
 {
-	glBindVertexArray(VAO);
-	glDrawElementsInstanced(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0, count);
-	glBindVertexArray(0);
-}
-
-void Mesh::SetupMesh()
-{
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	glGenBuffers(1, &EBO);
-
-	glBindVertexArray(VAO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);
-
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
+	if (m_Geometry == INVALID_GEOMETRY_HANDLE)
+		return;
 
-	// Vertex positions
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-
-	// Vertex normals
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-	// Vertex texture coords
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
-
-	glEnableVertexAttribArray(3);
-	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, tangent));
-
-	glBindVertexArray(0);
+	const GeometryAllocation& allocation = GeometryArena::GetInstance()->Get(m_Geometry);
+	RenderDevice::Get().DrawElementsBaseVertex(GL_TRIANGLES, allocation.IndicesCount, GL_UNSIGNED_INT,
+		(void*)(allocation.FirstIndex * sizeof(uint32_t)), allocation.FirstVertex);
 }
 
-void Mesh::SetupMeshInstanced()
+void Mesh::DrawInstanced(uint32_t count) const
 {
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	glGenBuffers(1, &EBO);
-
-	glBindVertexArray(VAO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);
+	if (m_Geometry == INVALID_GEOMETRY_HANDLE)
+		return;
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-	// Vertex positions
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-
-	// Vertex normals
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
-
-	// Vertex texture coords
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
-
-	// Tangent
-	glEnableVertexAttribArray(3);
-	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, tangent));
-
-	// Transformation matrix
-	glEnableVertexAttribArray(4);
-	glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)0);
-
-	glEnableVertexAttribArray(4);
-	glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)sizeof(glm::vec4));
-
-	glEnableVertexAttribArray(4);
-	glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(2 * sizeof(glm::vec4)));
-
-	glEnableVertexAttribArray(4);
-	glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(3 * sizeof(glm::vec4)));
-
-	glVertexAttribDivisor(4, 1);
-	glVertexAttribDivisor(5, 1);
-	glVertexAttribDivisor(6, 1);
-	glVertexAttribDivisor(7, 1);
-
-	glBindVertexArray(0);
+	const GeometryAllocation& allocation = GeometryArena::GetInstance()->Get(m_Geometry);
+	RenderDevice::Get().DrawElementsInstancedBaseVertex(GL_TRIANGLES, allocation.IndicesCount, GL_UNSIGNED_INT,
+		(void*)(allocation.FirstIndex * sizeof(uint32_t)), count, allocation.FirstVertex);
 }
 
-
+void Mesh::Destroy()
+{
+	GeometryArena::GetInstance()->Free(m_Geometry);
+	m_Geometry = INVALID_GEOMETRY_HANDLE;
+}
\ No newline at end of file
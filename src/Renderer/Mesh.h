@@ -3,6 +3,8 @@
 #include "glm/glm.hpp"
 #include "Shader.h"
 #include "Texture.h"
+#include "Math/Bounds.h"
+#include "GeometryArena.h"
 
 struct Vertex
 {
@@ -12,21 +14,28 @@ struct Vertex
 	glm::vec3 tangent;
 };
 
+// Geometry lives in the shared GeometryArena, copies of a mesh refer to the same allocation
 class Mesh
 {
 public:
 	std::vector<Vertex> vertices;
 	std::vector<unsigned int> indices;
 
-	Mesh(std::vector<Vertex> inVertices, std::vector<unsigned int> inIndices, bool instanced = false);
-	void Render();
-	void RenderInstanced(uint32_t count);
+	Mesh(std::vector<Vertex> inVertices, std::vector<unsigned int> inIndices, AABB bounds);
+	void Render() const;
+	// Draw without binding the vertex array, for callers which already have the arena's or one attached to it bound
+	void Draw() const;
+	void DrawInstanced(uint32_t count) const;
+	void Destroy();
 
-	inline unsigned int GetVAO() const { return VAO; }
+	// The arena's, shared by every mesh
+	inline unsigned int GetVAO() const { return m_VAO; }
+	inline GeometryHandle GetGeometry() const { return m_Geometry; }
+	// Local space, computed at import
+	inline const AABB& GetBounds() const { return m_Bounds; }
 
 private:
-	unsigned int VAO, VBO, EBO;
-
-	void SetupMesh();
-	void SetupMeshInstanced();
+	unsigned int m_VAO;
+	GeometryHandle m_Geometry;
+	AABB m_Bounds;
 };
\ No newline at end of file
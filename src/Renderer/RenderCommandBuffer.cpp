@@ -0,0 +1,90 @@
+#include "RenderCommandBuffer.h"
+
+#include <cstring>
+
+#include "Mesh.h"
+#include "Material/Material.h"
+
+uint64_t RenderCommandBuffer::MakeSortKey(RenderPass pass, uint32_t shader, uint64_t material, uint32_t mesh, float depth)
+{
+	// Positive floats keep their order when compared as integers, the top bits are enough to sort by distance
+	uint32_t depthBits;
+	depth = depth > 0.0f ? depth : 0.0f;
+	std::memcpy(&depthBits, &depth, sizeof(float));
+
+	return ((uint64_t)pass & 0xF) << 60
+		| ((uint64_t)shader & 0xFFF) << 48
+		| (material & 0xFFFF) << 32
+		| ((uint64_t)mesh & 0xFFFF) << 16
+		| (depthBits >> 16);
+}
+
+void RenderCommandBuffer::Clear()
+{
+	m_Commands.clear();
+	m_Entries.clear();
+}
+
+void RenderCommandBuffer::Add(RenderPass pass, const RenderCommand& command, const glm::vec3& position)
+{
+	float depth = glm::length(position - m_ViewPosition);
+	uint64_t key = MakeSortKey(pass, command.SourceMaterial->GetShader()->id, command.SourceMaterial->GetID(), command.VertexArray, depth);
+
+	m_Entries.push_back({ key, (uint32_t)m_Commands.size() });
+	m_Commands.push_back(command);
+}
+
+void RenderCommandBuffer::Sort()
+{
+	// Least significant digit radix sort, one byte per pass, stable so equal keys keep their recording order
+	m_SortScratch.resize(m_Entries.size());
+
+	for (uint32_t shift = 0; shift < 64; shift += 8)
+	{
+		uint32_t offsets[256] = {};
+		for (auto& entry : m_Entries)
+			offsets[(entry.SortKey >> shift) & 0xFF]++;
+
+		// Every key has the same byte here, the pass would not move anything
+		if (offsets[(m_Entries.empty() ? 0 : m_Entries[0].SortKey >> shift) & 0xFF] == m_Entries.size())
+			continue;
+
+		uint32_t sum = 0;
+		for (auto& offset : offsets)
+		{
+			uint32_t count = offset;
+			offset = sum;
+			sum += count;
+		}
+
+		for (auto& entry : m_Entries)
+			m_SortScratch[offsets[(entry.SortKey >> shift) & 0xFF]++] = entry;
+
+		m_Entries.swap(m_SortScratch);
+	}
+}
+
+void RenderCommandBuffer::BuildBatches(std::vector<DrawBatch>& batches) const
+{
+	batches.clear();
+	uint32_t indirectCommandsCount = 0;
+
+	for (uint32_t i = 0; i < m_Entries.size(); i++)
+	{
+		const RenderCommand& command = m_Commands[m_Entries[i].Index];
+		bool multiDraw = command.InstancesCount == 0;
+
+		bool merged = false;
+		if (!batches.empty() && multiDraw && batches.back().MultiDraw)
+		{
+			const RenderCommand& first = m_Commands[m_Entries[batches.back().FirstEntry].Index];
+			merged = first.SourceMaterial == command.SourceMaterial && first.VertexArray == command.VertexArray;
+		}
+
+		if (!merged)
+			batches.push_back({ i, 0, indirectCommandsCount, multiDraw });
+
+		batches.back().EntriesCount++;
+		indirectCommandsCount += multiDraw;
+	}
+}
\ No newline at end of file
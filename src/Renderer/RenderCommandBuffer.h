@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Core/Span.h"
+
+class Mesh;
+class Material;
+
+// Highest bits of the sort key, passes are submitted in this order
+enum class RenderPass : uint8_t
+{
+	OPAQUE
+};
+
+struct RenderCommand
+{
+	const Mesh* SourceMesh;
+	Material* SourceMaterial;
+	const glm::mat4* ModelMatrix;
+	// The mesh's for regular draws, instanced draws read their instance attributes through their own
+	uint32_t VertexArray = 0;
+	// Zero for regular draws
+	uint32_t InstancesCount = 0;
+};
+
+// Layout glMultiDrawElementsIndirect reads its commands in
+struct DrawIndirectCommand
+{
+	uint32_t Count;
+	uint32_t InstanceCount;
+	uint32_t FirstIndex;
+	int32_t BaseVertex;
+	uint32_t BaseInstance;
+};
+
+// Sorted commands submitted together, regular ones sharing program, material and vertex array go in one multi-draw
+struct DrawBatch
+{
+	uint32_t FirstEntry;
+	uint32_t EntriesCount;
+	// Into the frame's indirect commands, only for multi-draws
+	uint32_t FirstIndirectCommand;
+	bool MultiDraw;
+};
+
+struct RenderCommandEntry
+{
+	uint64_t SortKey;
+	uint32_t Index;
+};
+
+struct RenderCommandStats
+{
+	uint32_t Commands = 0;
+	// State changes actually made, every command would otherwise make one of each
+	uint32_t ProgramChanges = 0;
+	uint32_t MaterialChanges = 0;
+	uint32_t VertexArrayChanges = 0;
+	uint32_t ModelChanges = 0;
+	// Draw calls made, regular commands are merged into multi-draws
+	uint32_t DrawCalls = 0;
+};
+
+// Draws of one frame, recorded by the renderer and render components and sorted by a 64 bit key so
+// that submission only changes program, material, vertex array and model uniform when they differ.
+// Key layout from the highest bits: pass (4), shader (12), material (16), mesh (16), depth (16).
+class RenderCommandBuffer
+{
+private:
+	std::vector<RenderCommand> m_Commands;
+	std::vector<RenderCommandEntry> m_Entries;
+	std::vector<RenderCommandEntry> m_SortScratch;
+
+	glm::vec3 m_ViewPosition = glm::vec3(0.0f);
+
+public:
+	static uint64_t MakeSortKey(RenderPass pass, uint32_t shader, uint64_t material, uint32_t mesh, float depth);
+
+	void Clear();
+	// Depth sorts front to back from the view position, commands are drawn in this order within a material and mesh
+	void Add(RenderPass pass, const RenderCommand& command, const glm::vec3& position);
+	void Sort();
+	// Splits the sorted commands into batches. Regular commands sharing material and vertex array are merged,
+	// compared on the commands themselves since the key only keeps the low bits of the shader and material ids.
+	void BuildBatches(std::vector<DrawBatch>& batches) const;
+
+	inline void SetViewPosition(const glm::vec3& position) { m_ViewPosition = position; }
+
+	inline size_t Size() const { return m_Entries.size(); }
+	// Sorted after Sort(), in recording order before
+	inline Span<const RenderCommandEntry> GetEntries() const { return m_Entries; }
+	inline const RenderCommand& GetCommand(const RenderCommandEntry& entry) const { return m_Commands[entry.Index]; }
+};
\ No newline at end of file
@@ -1,20 +1,48 @@
 #include "Renderer.h"
 #include "Framebuffer.h"
+#include "FrameBindings.h"
 #include "Scene/Scene.h"
 #include "Scene/Component/Light/DirectionalLight.h"
 #include "Scene/Component/StaticMeshComponent.h"
 #include "Scene/Component/InstanceRenderedMeshComponent.h"
 #include "Mesh.h"
+#include "GeometryArena.h"
 #include "Scene/Component/Light/Light.h"
 #include "Scene/Component/Light/PointLight.h"
 #include "Scene/Component/Light/SpotLight.h"
 #include "Scene/Component/Light/SkyLight.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 
 Ref<Renderer> Renderer::s_Instance{};
 std::mutex Renderer::s_Mutex;
 
+// Uniforms set per program and per draw, interned once so setting them only indexes the shader's uniform table
+struct RendererUniforms
+{
+	UniformID Model = UniformName::Get("u_Model");
+	UniformID LightSpace = UniformName::Get("u_LightSpace");
+	UniformID FarPlane = UniformName::Get("u_FarPlane");
+	UniformID LightPos = UniformName::Get("u_LightPos");
+	std::array<UniformID, 6> ShadowMatrices;
+
+	UniformID IsSkyLight = UniformName::Get("u_IsSkyLight");
+	UniformID SkyLightIntensity = UniformName::Get("u_SkyLightIntensity");
+
+	RendererUniforms()
+	{
+		for (uint32_t i = 0; i < ShadowMatrices.size(); i++)
+			ShadowMatrices[i] = UniformName::Get("u_ShadowMatrices", i);
+	}
+};
+
+static const RendererUniforms& GetRendererUniforms()
+{
+	static const RendererUniforms uniforms;
+	return uniforms;
+}
+
 Renderer::Renderer()
 {
 	m_Gamma = 2.2f;
@@ -41,16 +69,19 @@ Ref<Renderer> Renderer::GetInstance()
 
 void Renderer::Initialize()
 {
-	glEnable(GL_DEPTH_TEST);
-	glDepthFunc(GL_LESS);
+	RenderDevice::Get().Enable(GL_DEPTH_TEST);
+	RenderDevice::Get().DepthFunc(GL_LESS);
 
-	glEnable(GL_CULL_FACE);
-	glCullFace(GL_BACK);
+	RenderDevice::Get().Enable(GL_CULL_FACE);
+	RenderDevice::Get().CullFace(GL_BACK);
 
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	RenderDevice::Get().Enable(GL_BLEND);
+	RenderDevice::Get().BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-	glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+	RenderDevice::Get().Enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+	RenderDevice::Get().GenBuffers(1, &m_IndirectBuffer);
+	RenderDevice::Get().GenBuffers(1, &m_DrawDataBuffer);
 }
 
 void Renderer::InitializeMainSceneFramebuffer()
@@ -165,20 +196,21 @@ void Renderer::InitializeShadowMapFramebuffers()
 	config.Textures.push_back(textureConfig);
 
 	m_DirectionalLightShadowMapFramebuffer = Framebuffer::Create(config);
+	m_DirectionalLightStaticShadowMapFramebuffer = Framebuffer::Create(config);
 
 	// POINT LIGHT
-	glGenFramebuffers(1, &m_PointLightShadowMapFramebufferObject);
-	glBindFramebuffer(GL_FRAMEBUFFER, m_PointLightShadowMapFramebufferObject);
-	glDrawBuffer(GL_NONE);
-	glReadBuffer(GL_NONE);
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderDevice::Get().GenFramebuffers(1, &m_PointLightShadowMapFramebufferObject);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_PointLightShadowMapFramebufferObject);
+	RenderDevice::Get().DrawBuffer(GL_NONE);
+	RenderDevice::Get().ReadBuffer(GL_NONE);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 	// SPOT LIGHT
-	glGenFramebuffers(1, &m_SpotLightShadowMapFramebufferObject);
-	glBindFramebuffer(GL_FRAMEBUFFER, m_SpotLightShadowMapFramebufferObject);
-	glDrawBuffer(GL_NONE);
-	glReadBuffer(GL_NONE);
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderDevice::Get().GenFramebuffers(1, &m_SpotLightShadowMapFramebufferObject);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_SpotLightShadowMapFramebufferObject);
+	RenderDevice::Get().DrawBuffer(GL_NONE);
+	RenderDevice::Get().ReadBuffer(GL_NONE);
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 	CreateShadowMapsPlaceholders();
 }
@@ -196,68 +228,251 @@ void Renderer::InitializePostProcessing()
 		 1.0f,  1.0f,    1.0f, 1.0f,
 	};
 
-	glGenVertexArrays(1, &m_PostProcessingVAO);
-	glBindVertexArray(m_PostProcessingVAO);
+	RenderDevice::Get().GenVertexArrays(1, &m_PostProcessingVAO);
+	RenderDevice::Get().BindVertexArray(m_PostProcessingVAO);
 
-	glGenBuffers(1, &m_PostProcessingVBO);
-	glBindBuffer(GL_ARRAY_BUFFER, m_PostProcessingVBO);
+	RenderDevice::Get().GenBuffers(1, &m_PostProcessingVBO);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, m_PostProcessingVBO);
 
-	glBufferData(GL_ARRAY_BUFFER, sizeof(viewportVertices), viewportVertices, GL_STATIC_DRAW);
+	RenderDevice::Get().BufferData(GL_ARRAY_BUFFER, sizeof(viewportVertices), viewportVertices, GL_STATIC_DRAW);
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+	RenderDevice::Get().EnableVertexAttribArray(0);
+	RenderDevice::Get().VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
 
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+	RenderDevice::Get().EnableVertexAttribArray(1);
+	RenderDevice::Get().VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
 
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
+	RenderDevice::Get().BindVertexArray(0);
 }
 
 void Renderer::RenderScene(Ref<Scene> scene)
 {
+	// Shadow maps are rendered during PreRender and add to the stats
+	m_CullingStats = CullingStats();
+	m_ShadowMapStats = ShadowMapStats();
+
 	scene->PreRender();
+	CullDrawItems(scene.get());
 
 	m_MainSceneFramebuffer->Bind();
 
 	
 
-	glClearColor(scene->GetBackgroundColor()->x, scene->GetBackgroundColor()->y, scene->GetBackgroundColor()->z, scene->GetBackgroundColor()->w);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	RenderDevice::Get().ClearColor(scene->GetBackgroundColor()->x, scene->GetBackgroundColor()->y, scene->GetBackgroundColor()->z, scene->GetBackgroundColor()->w);
+	RenderDevice::Get().Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 	scene->Render();
+	RenderDrawItems(scene.get());
 
 	m_MainSceneFramebuffer->Unbind();
 }
 
+void Renderer::RenderDrawItems(Scene* scene)
+{
+	const RenderList& renderList = scene->GetRenderList();
+
+	RecordCommands(scene);
+	SubmitCommands(scene->GetFrameLights());
+
+	for (auto rc : renderList.Components)
+	{
+		rc->Render();
+	}
+}
+
+void Renderer::RecordCommands(Scene* scene)
+{
+	const RenderList& renderList = scene->GetRenderList();
+
+	m_Commands.Clear();
+	m_Commands.SetViewPosition(scene->GetCamera()->Position);
+
+	for (size_t i = 0; i < renderList.Items.size(); i++)
+	{
+		if (!m_DrawItemsVisibility[i])
+			continue;
+
+		const DrawItem& item = renderList.Items[i];
+
+		// Empty or released meshes have no geometry in the arena, Mesh::Draw skips them the same way
+		if (item.SourceMesh->GetGeometry() == INVALID_GEOMETRY_HANDLE)
+			continue;
+
+		RenderCommand command;
+		command.SourceMesh = item.SourceMesh;
+		command.SourceMaterial = item.SourceMaterial;
+		command.ModelMatrix = &item.ModelMatrix;
+		command.VertexArray = item.SourceMesh->GetVAO();
+		m_Commands.Add(RenderPass::OPAQUE, command, glm::vec3(item.ModelMatrix[3]));
+	}
+
+	for (auto rc : renderList.Components)
+	{
+		rc->EmitCommands(m_Commands);
+	}
+
+	m_Commands.Sort();
+}
+
+void Renderer::BuildDrawBatches()
+{
+	Ref<GeometryArena> arena = GeometryArena::GetInstance();
+	Span<const RenderCommandEntry> entries = m_Commands.GetEntries();
+
+	m_Commands.BuildBatches(m_DrawBatches);
+	m_IndirectCommands.clear();
+	m_DrawModels.clear();
+
+	for (const DrawBatch& batch : m_DrawBatches)
+	{
+		if (!batch.MultiDraw)
+			continue;
+
+		for (uint32_t i = batch.FirstEntry; i < batch.FirstEntry + batch.EntriesCount; i++)
+		{
+			const RenderCommand& command = m_Commands.GetCommand(entries[i]);
+
+			// The base instance doubles as the draw's index, the draw index attribute is read there
+			const GeometryAllocation& allocation = arena->Get(command.SourceMesh->GetGeometry());
+			DrawIndirectCommand indirect;
+			indirect.Count = allocation.IndicesCount;
+			indirect.InstanceCount = 1;
+			indirect.FirstIndex = allocation.FirstIndex;
+			indirect.BaseVertex = allocation.FirstVertex;
+			indirect.BaseInstance = m_DrawModels.size();
+			m_IndirectCommands.push_back(indirect);
+			m_DrawModels.push_back(*command.ModelMatrix);
+		}
+	}
+
+	if (m_IndirectCommands.empty())
+		return;
+
+	arena->ReserveDrawIndices(m_DrawModels.size());
+
+	// Respecified every frame so the driver can hand out fresh storage instead of waiting for last frame's draws
+	RenderDevice::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, m_DrawDataBuffer);
+	RenderDevice::Get().BufferData(GL_SHADER_STORAGE_BUFFER, m_DrawModels.size() * sizeof(glm::mat4), m_DrawModels.data(), GL_STREAM_DRAW);
+	RenderDevice::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	RenderDevice::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_DATA_BINDING, m_DrawDataBuffer);
+
+	RenderDevice::Get().BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_IndirectBuffer);
+	RenderDevice::Get().BufferData(GL_DRAW_INDIRECT_BUFFER, m_IndirectCommands.size() * sizeof(DrawIndirectCommand), m_IndirectCommands.data(), GL_STREAM_DRAW);
+}
+
+void Renderer::SubmitCommands(const FrameLights& lights)
+{
+	m_CommandStats = RenderCommandStats();
+	m_CommandStats.Commands = m_Commands.Size();
+
+	// Shared by every command, the units are reserved so nothing rebinds them during the pass
+	FrameBindings::BindTextures(lights, m_DirectionalLightShadowMapFramebuffer->GetDepthAttachment());
+
+	// Leaves the indirect buffer bound for the multi-draws
+	BuildDrawBatches();
+
+	Shader* currentShader = nullptr;
+	Material* currentMaterial = nullptr;
+	uint32_t currentVertexArray = 0;
+	const glm::mat4* currentModel = nullptr;
+
+	for (const DrawBatch& batch : m_DrawBatches)
+	{
+		const RenderCommand& command = m_Commands.GetCommand(m_Commands.GetEntries()[batch.FirstEntry]);
+
+		Shader* shader = command.SourceMaterial->GetShader().get();
+		if (shader != currentShader)
+		{
+			shader->Use();
+			SetFrameUniforms(shader, lights);
+
+			// Material parameters and the model matrix are per program state
+			currentShader = shader;
+			currentMaterial = nullptr;
+			currentModel = nullptr;
+			m_CommandStats.ProgramChanges++;
+		}
+
+		if (command.SourceMaterial != currentMaterial)
+		{
+			currentMaterial = command.SourceMaterial;
+			currentMaterial->ApplyParameters();
+			m_CommandStats.MaterialChanges++;
+		}
+
+		if (command.VertexArray != currentVertexArray)
+		{
+			currentVertexArray = command.VertexArray;
+			RenderDevice::Get().BindVertexArray(currentVertexArray);
+			m_CommandStats.VertexArrayChanges++;
+		}
+
+		m_CommandStats.DrawCalls++;
+
+		if (batch.MultiDraw)
+		{
+			RenderDevice::Get().MultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+				(void*)(batch.FirstIndirectCommand * sizeof(DrawIndirectCommand)), batch.EntriesCount, 0);
+			continue;
+		}
+
+		// Instanced commands are never merged, their batches hold a single one
+		if (!currentModel || *command.ModelMatrix != *currentModel)
+		{
+			currentModel = command.ModelMatrix;
+			shader->SetMat4(GetRendererUniforms().Model, *currentModel);
+			m_CommandStats.ModelChanges++;
+		}
+
+		command.SourceMesh->DrawInstanced(command.InstancesCount);
+	}
+
+	RenderDevice::Get().BindVertexArray(0);
+	RenderDevice::Get().BindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void Renderer::CullDrawItems(Scene* scene)
+{
+	const RenderList& renderList = scene->GetRenderList();
+	Frustum frustum = Frustum::FromMatrix(scene->GetCamera()->GetViewProjectionMatrix());
+
+	m_DrawItemsVisibility.resize(renderList.Items.size());
+	uint32_t visible = Culling::FrustumCull(frustum, renderList.Bounds, m_DrawItemsVisibility.data());
+
+	m_CullingStats.Tested = renderList.Items.size();
+	m_CullingStats.Drawn = visible;
+	m_CullingStats.Culled = m_CullingStats.Tested - visible;
+}
+
 void Renderer::AddPostProcessingEffects()
 {
 	if (m_Bloom)
 	{
 		m_ThresholdFramebuffer->Bind();
-		glDisable(GL_CULL_FACE);
-		glDisable(GL_DEPTH_TEST);
+		RenderDevice::Get().Disable(GL_CULL_FACE);
+		RenderDevice::Get().Disable(GL_DEPTH_TEST);
 
 		auto thresholdShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::POST_PROCESSING, "Threshold");
 		thresholdShader->Use();
 		thresholdShader->SetInt("u_Screen", 0);
 		thresholdShader->SetFloat("u_Threshold", m_BloomThreshold);
 
-		glBindVertexArray(m_PostProcessingVAO);
-		glDisable(GL_DEPTH_TEST);
+		RenderDevice::Get().BindVertexArray(m_PostProcessingVAO);
+		RenderDevice::Get().Disable(GL_DEPTH_TEST);
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, m_MainSceneFramebuffer->GetColorAttachment());
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_MainSceneFramebuffer->GetColorAttachment());
 
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 6);
 		m_ThresholdFramebuffer->Unbind();
 
 		m_HalfResolutionFramebuffer->Bind();
-		glDisable(GL_CULL_FACE);
-		glDisable(GL_DEPTH_TEST);
+		RenderDevice::Get().Disable(GL_CULL_FACE);
+		RenderDevice::Get().Disable(GL_DEPTH_TEST);
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, m_ThresholdFramebuffer->GetColorAttachment());
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_ThresholdFramebuffer->GetColorAttachment());
 
 		auto downfilterShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::POST_PROCESSING, "Downfilter");
 		downfilterShader->Use();
@@ -265,52 +480,52 @@ void Renderer::AddPostProcessingEffects()
 		downfilterShader->SetVec2("u_TexelOffset", glm::vec2(1.0f / (float)m_HalfResolutionFramebuffer->GetConfiguration().Width,
 			1.0f / (float)m_HalfResolutionFramebuffer->GetConfiguration().Height));
 
-		glBindVertexArray(m_PostProcessingVAO);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		RenderDevice::Get().BindVertexArray(m_PostProcessingVAO);
+		RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 6);
 		m_HalfResolutionFramebuffer->Unbind();
 
 		m_BlurFramebuffer->Bind();
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, m_HalfResolutionFramebuffer->GetColorAttachment());
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_HalfResolutionFramebuffer->GetColorAttachment());
 
 		auto blurShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::POST_PROCESSING, "Blur");
 		blurShader->Use();
 		blurShader->SetInt("u_SourceTexture", 0);
 		blurShader->SetVec2("u_TexelOffset", glm::vec2(m_BlurWidth / (float)m_HalfResolutionFramebuffer->GetConfiguration().Width, 0.0f));
 
-		glBindVertexArray(m_PostProcessingVAO);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		RenderDevice::Get().BindVertexArray(m_PostProcessingVAO);
+		RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 6);
 		m_BlurFramebuffer->Unbind();
 
 		m_HalfResolutionFramebuffer->Bind();
-		glDisable(GL_CULL_FACE);
-		glDisable(GL_DEPTH_TEST);
+		RenderDevice::Get().Disable(GL_CULL_FACE);
+		RenderDevice::Get().Disable(GL_DEPTH_TEST);
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, m_BlurFramebuffer->GetColorAttachment());
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_BlurFramebuffer->GetColorAttachment());
 
 		blurShader->Use();
 		blurShader->SetInt("u_SourceTexture", 0);
 		blurShader->SetVec2("u_TexelOffset", glm::vec2(0.0f, m_BlurWidth / (float)m_HalfResolutionFramebuffer->GetConfiguration().Height));
 
-		glBindVertexArray(m_PostProcessingVAO);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		RenderDevice::Get().BindVertexArray(m_PostProcessingVAO);
+		RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 6);
 		m_HalfResolutionFramebuffer->Unbind();
 	}
 
 	m_PostProcessingFramebuffer->Bind();
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_CULL_FACE);
+	RenderDevice::Get().Disable(GL_DEPTH_TEST);
+	RenderDevice::Get().Disable(GL_CULL_FACE);
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, m_MainSceneFramebuffer->GetColorAttachment());
+	RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_MainSceneFramebuffer->GetColorAttachment());
 
 	if (m_Bloom)
 	{
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, m_HalfResolutionFramebuffer->GetColorAttachment());
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		RenderDevice::Get().ActiveTexture(GL_TEXTURE1);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_HalfResolutionFramebuffer->GetColorAttachment());
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	}
 
 	auto postProcessingShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::POST_PROCESSING, "PostProcessing");
@@ -324,139 +539,202 @@ void Renderer::AddPostProcessingEffects()
 	postProcessingShader->SetFloat("u_Gamma", m_Gamma);
 	postProcessingShader->SetFloat("u_Exposure", m_Exposure);
 
-	glBindVertexArray(m_PostProcessingVAO);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	RenderDevice::Get().BindVertexArray(m_PostProcessingVAO);
+	RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 6);
 
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_CULL_FACE);
-	glBindVertexArray(0);
+	RenderDevice::Get().Enable(GL_DEPTH_TEST);
+	RenderDevice::Get().Enable(GL_CULL_FACE);
+	RenderDevice::Get().BindVertexArray(0);
 	m_PostProcessingFramebuffer->Unbind();
 }
 
-void Renderer::RenderShadowMap(Scene* scene, DirectionalLight* source)
+void Renderer::RenderShadowMap(Scene* scene, DirectionalLight* source, bool updateStaticLayer)
 {
-	m_DirectionalLightShadowMapFramebuffer->Bind();
+	m_ShadowMapStats.Rendered++;
+
+	CullShadowCasters(scene, Frustum::FromMatrix(source->GetLightSpace()));
 
 	auto depthShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepth");
 	depthShader->Use();
-	depthShader->SetMat4("u_LightSpace", source->GetLightSpace());
-
-	glClear(GL_DEPTH_BUFFER_BIT);
-	glCullFace(GL_FRONT);
+	depthShader->SetMat4(GetRendererUniforms().LightSpace, source->GetLightSpace());
 
-	for (auto e : scene->GetEntities())
-	{
-		if (auto smc = e->GetComponent<StaticMeshComponent>())
-		{
-			depthShader->SetMat4("u_Model", e->GetTransform().ModelMatrix);
+	auto depthIstancedShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthInstanced");
+	depthIstancedShader->Use();
+	depthIstancedShader->SetMat4(GetRendererUniforms().LightSpace, source->GetLightSpace());
 
-			for (auto mesh : smc->GetMeshes())
-				mesh.Render();
-		}
+	RenderDevice::Get().CullFace(GL_FRONT);
 
+	if (updateStaticLayer)
+	{
+		m_ShadowMapStats.StaticLayersRendered++;
 
+		m_DirectionalLightStaticShadowMapFramebuffer->Bind();
+		RenderDevice::Get().Clear(GL_DEPTH_BUFFER_BIT);
+		RenderShadowCasters(scene, depthShader, depthIstancedShader, Mobility::STATIC);
 	}
 
-	auto depthIstancedShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthInstanced");
-	depthIstancedShader->Use();
-	depthIstancedShader->SetMat4("u_LightSpace", source->GetLightSpace());
-	for (auto c : scene->GetComponents<InstanceRenderedMeshComponent>())
-	{
-		auto irmc = Cast<InstanceRenderedMeshComponent>(c);
-		for (auto mesh : irmc->GetMeshes())
-			mesh.RenderInstanced(irmc->GetInstancesCount());
-	}
+	const FramebufferConfig& shadowMapConfig = m_DirectionalLightShadowMapFramebuffer->GetConfiguration();
+	CopyShadowMap(m_DirectionalLightStaticShadowMapFramebuffer->GetDepthAttachment(), m_DirectionalLightShadowMapFramebuffer->GetDepthAttachment(), GL_TEXTURE_2D, shadowMapConfig.Width, shadowMapConfig.Height, 1);
 
-	glCullFace(GL_BACK);
+	m_DirectionalLightShadowMapFramebuffer->Bind();
+	RenderShadowCasters(scene, depthShader, depthIstancedShader, Mobility::MOVABLE);
+
+	RenderDevice::Get().CullFace(GL_BACK);
 
 	m_DirectionalLightShadowMapFramebuffer->Unbind();
 }
 
-void Renderer::RenderShadowMap(Scene* scene, PointLight* source)
+void Renderer::RenderShadowMap(Scene* scene, PointLight* source, bool updateStaticLayer)
 {
-	glViewport(0, 0, 1024, 1024);
-	glBindFramebuffer(GL_FRAMEBUFFER, m_PointLightShadowMapFramebufferObject);
+	m_ShadowMapStats.Rendered++;
 
-	glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source->GetShadowMap(), 0);
+	// The six faces together cover everything within the far plane
+	BoundingSphere range;
+	range.Center = source->GetOwner()->GetWorldPosition();
+	range.Radius = source->GetFarPlane();
+	CullShadowCasters(scene, range);
 
 	auto depthShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthPoint");
 	depthShader->Use();
 	for (int i = 0; i < 6; i++)
-		depthShader->SetMat4("u_ShadowMatrices[" + std::to_string(i) + "]", source->GetLightViews().at(i));
-	depthShader->SetFloat("u_FarPlane", source->GetFarPlane());
-	depthShader->SetVec3("u_LightPos", source->GetOwner()->GetWorldPosition());
+		depthShader->SetMat4(GetRendererUniforms().ShadowMatrices[i], source->GetLightViews().at(i));
+	depthShader->SetFloat(GetRendererUniforms().FarPlane, source->GetFarPlane());
+	depthShader->SetVec3(GetRendererUniforms().LightPos, source->GetOwner()->GetWorldPosition());
 
-	glClear(GL_DEPTH_BUFFER_BIT);
-	glCullFace(GL_FRONT);
+	auto depthIstancedShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthPointInstanced");
+	depthIstancedShader->Use();
+	for (int i = 0; i < 6; i++)
+		depthIstancedShader->SetMat4(GetRendererUniforms().ShadowMatrices[i], source->GetLightViews().at(i));
+	depthIstancedShader->SetFloat(GetRendererUniforms().FarPlane, source->GetFarPlane());
+	depthIstancedShader->SetVec3(GetRendererUniforms().LightPos, source->GetOwner()->GetWorldPosition());
 
-	for (auto e : scene->GetEntities())
+	RenderDevice::Get().Viewport(0, 0, source->GetShadowMapSize(), source->GetShadowMapSize());
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_PointLightShadowMapFramebufferObject);
+	RenderDevice::Get().CullFace(GL_FRONT);
+
+	if (updateStaticLayer)
 	{
-		if (auto smc = e->GetComponent<StaticMeshComponent>())
-		{
-			depthShader->SetMat4("u_Model", e->GetTransform().ModelMatrix);
+		m_ShadowMapStats.StaticLayersRendered++;
 
-			for (auto mesh : smc->GetMeshes())
-				mesh.Render();
-		}
+		RenderDevice::Get().FramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source->GetStaticShadowMap(), 0);
+		RenderDevice::Get().Clear(GL_DEPTH_BUFFER_BIT);
+		RenderShadowCasters(scene, depthShader, depthIstancedShader, Mobility::STATIC);
 	}
 
-	auto depthIstancedShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthPointInstanced");
+	CopyShadowMap(source->GetStaticShadowMap(), source->GetShadowMap(), GL_TEXTURE_CUBE_MAP, source->GetShadowMapSize(), source->GetShadowMapSize(), 6);
+
+	RenderDevice::Get().FramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source->GetShadowMap(), 0);
+	RenderShadowCasters(scene, depthShader, depthIstancedShader, Mobility::MOVABLE);
+
+	RenderDevice::Get().CullFace(GL_BACK);
+
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void Renderer::RenderShadowMap(Scene* scene, SpotLight* source, bool updateStaticLayer)
+{
+	m_ShadowMapStats.Rendered++;
+
+	CullShadowCasters(scene, Frustum::FromMatrix(source->GetLightSpace()));
+
+	auto depthShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepth");
+	depthShader->Use();
+	depthShader->SetMat4(GetRendererUniforms().LightSpace, source->GetLightSpace());
+
+	auto depthIstancedShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthInstanced");
 	depthIstancedShader->Use();
-	for (int i = 0; i < 6; i++)
-		depthIstancedShader->SetMat4("u_ShadowMatrices[" + std::to_string(i) + "]", source->GetLightViews().at(i));
-	depthIstancedShader->SetFloat("u_FarPlane", source->GetFarPlane());
-	depthIstancedShader->SetVec3("u_LightPos", source->GetOwner()->GetWorldPosition());
-	
-	for (auto c : scene->GetComponents<InstanceRenderedMeshComponent>())
+	depthIstancedShader->SetMat4(GetRendererUniforms().LightSpace, source->GetLightSpace());
+
+	RenderDevice::Get().Viewport(0, 0, source->GetShadowMapSize(), source->GetShadowMapSize());
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_SpotLightShadowMapFramebufferObject);
+	RenderDevice::Get().CullFace(GL_FRONT);
+
+	if (updateStaticLayer)
 	{
-		auto irmc = Cast<InstanceRenderedMeshComponent>(c);
-		for (auto mesh : irmc->GetMeshes())
-			mesh.RenderInstanced(irmc->GetInstancesCount());
+		m_ShadowMapStats.StaticLayersRendered++;
+
+		RenderDevice::Get().FramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source->GetStaticShadowMap(), 0);
+		RenderDevice::Get().Clear(GL_DEPTH_BUFFER_BIT);
+		RenderShadowCasters(scene, depthShader, depthIstancedShader, Mobility::STATIC);
 	}
 
-	glCullFace(GL_BACK);
+	CopyShadowMap(source->GetStaticShadowMap(), source->GetShadowMap(), GL_TEXTURE_2D, source->GetShadowMapSize(), source->GetShadowMapSize(), 1);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderDevice::Get().FramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source->GetShadowMap(), 0);
+	RenderShadowCasters(scene, depthShader, depthIstancedShader, Mobility::MOVABLE);
+
+	RenderDevice::Get().CullFace(GL_BACK);
+
+	RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-void Renderer::RenderShadowMap(Scene* scene, SpotLight* source)
+void Renderer::CullShadowCasters(Scene* scene, const Frustum& frustum)
 {
-	glViewport(0, 0, 1024, 1024);
-	glBindFramebuffer(GL_FRAMEBUFFER, m_SpotLightShadowMapFramebufferObject);
+	const RenderList& renderList = scene->GetRenderList();
 
-	glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source->GetShadowMap(), 0);
+	m_ShadowCastersVisibility.resize(renderList.ShadowCasters.size());
+	m_InstancedShadowCastersVisibility.resize(renderList.InstancedShadowCasters.size());
 
-	auto depthShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepth");
-	depthShader->Use();
-	depthShader->SetMat4("u_LightSpace", source->GetLightSpace());
+	m_CullingStats.ShadowCastersTested += renderList.ShadowCasters.size() + renderList.InstancedShadowCasters.size();
+	m_CullingStats.ShadowCastersDrawn += Culling::FrustumCull(frustum, renderList.ShadowCastersBounds, m_ShadowCastersVisibility.data());
+	m_CullingStats.ShadowCastersDrawn += Culling::FrustumCull(frustum, renderList.InstancedShadowCastersBounds, m_InstancedShadowCastersVisibility.data());
+}
+
+void Renderer::CullShadowCasters(Scene* scene, const BoundingSphere& sphere)
+{
+	const RenderList& renderList = scene->GetRenderList();
 
-	glClear(GL_DEPTH_BUFFER_BIT);
-	glCullFace(GL_FRONT);
+	m_ShadowCastersVisibility.resize(renderList.ShadowCasters.size());
+	m_InstancedShadowCastersVisibility.resize(renderList.InstancedShadowCasters.size());
+
+	m_CullingStats.ShadowCastersTested += renderList.ShadowCasters.size() + renderList.InstancedShadowCasters.size();
+	m_CullingStats.ShadowCastersDrawn += Culling::SphereCull(sphere, renderList.ShadowCastersBounds, m_ShadowCastersVisibility.data());
+	m_CullingStats.ShadowCastersDrawn += Culling::SphereCull(sphere, renderList.InstancedShadowCastersBounds, m_InstancedShadowCastersVisibility.data());
+}
 
-	for (auto e : scene->GetEntities())
+void Renderer::RenderShadowCasters(Scene* scene, const Ref<Shader>& depthShader, const Ref<Shader>& depthInstancedShader, Mobility mobility)
+{
+	const RenderList& renderList = scene->GetRenderList();
+
+	depthShader->Use();
+	for (size_t i = 0; i < renderList.ShadowCasters.size(); i++)
 	{
-		if (auto smc = e->GetComponent<StaticMeshComponent>())
-		{
-			depthShader->SetMat4("u_Model", e->GetTransform().ModelMatrix);
+		if (!m_ShadowCastersVisibility[i] || renderList.ShadowCastersMobility[i] != mobility)
+			continue;
 
-			for (auto mesh : smc->GetMeshes())
-				mesh.Render();
-		}
+		const DrawItem& item = renderList.Items[renderList.ShadowCasters[i]];
+		depthShader->SetMat4(GetRendererUniforms().Model, item.ModelMatrix);
+		item.SourceMesh->Render();
 	}
 
-	auto depthIstancedShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "SceneDepthInstanced");
-	depthIstancedShader->Use();
-	depthIstancedShader->SetMat4("u_LightSpace", source->GetLightSpace());
-	for (auto c : scene->GetComponents<InstanceRenderedMeshComponent>())
+	depthInstancedShader->Use();
+	for (size_t i = 0; i < renderList.InstancedShadowCasters.size(); i++)
 	{
-		auto irmc = Cast<InstanceRenderedMeshComponent>(c);
-		for (auto mesh : irmc->GetMeshes())
-			mesh.RenderInstanced(irmc->GetInstancesCount());
+		if (!m_InstancedShadowCastersVisibility[i] || renderList.InstancedShadowCastersMobility[i] != mobility)
+			continue;
+
+		auto irmc = renderList.InstancedShadowCasters[i];
+		RenderDevice::Get().BindVertexArray(irmc->GetVertexArray());
+		for (auto& mesh : irmc->GetMeshes())
+			mesh.DrawInstanced(irmc->GetInstancesCount());
+		RenderDevice::Get().BindVertexArray(0);
 	}
+}
 
-	glCullFace(GL_BACK);
+void Renderer::CopyShadowMap(uint32_t source, uint32_t destination, uint32_t target, uint32_t width, uint32_t height, int layers)
+{
+	RenderDevice::Get().CopyImageSubData(source, target, 0, 0, 0, 0, destination, target, 0, 0, 0, 0, width, height, layers);
+}
+
+void Renderer::SetFrameUniforms(Shader* shader, const FrameLights& lights)
+{
+	const RendererUniforms& uniforms = GetRendererUniforms();
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	// Unchanged values are skipped by the shader, after the first frame only the sky light ones may be sent.
+	// The frame samplers were pointed at their units when the program was loaded.
+	shader->SetBool(uniforms.IsSkyLight, lights.IsSkyLight);
+	if (lights.IsSkyLight)
+		shader->SetFloat(uniforms.SkyLightIntensity, lights.SkyLightIntensity);
 }
 
 void Renderer::RenderQuad()
@@ -473,24 +751,24 @@ void Renderer::RenderQuad()
 	};
 
 	unsigned int vao, vbo;
-	glGenVertexArrays(1, &vao);
-	glGenBuffers(1, &vbo);
-	glBindVertexArray(vao);
-	glBindBuffer(GL_ARRAY_BUFFER, vbo);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+	RenderDevice::Get().GenVertexArrays(1, &vao);
+	RenderDevice::Get().GenBuffers(1, &vbo);
+	RenderDevice::Get().BindVertexArray(vao);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, vbo);
+	RenderDevice::Get().BufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
 
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+	RenderDevice::Get().EnableVertexAttribArray(0);
+	RenderDevice::Get().VertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
 
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+	RenderDevice::Get().EnableVertexAttribArray(1);
+	RenderDevice::Get().VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
 
-	glBindVertexArray(vao);
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-	glBindVertexArray(0);
+	RenderDevice::Get().BindVertexArray(vao);
+	RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 6);
+	RenderDevice::Get().BindVertexArray(0);
 
-	glDeleteVertexArrays(1, &vao);
-	glDeleteBuffers(1, &vbo);
+	RenderDevice::Get().DeleteVertexArrays(1, &vao);
+	RenderDevice::Get().DeleteBuffers(1, &vbo);
 }
 
 void Renderer::CreateShadowMapsPlaceholders()
@@ -499,26 +777,26 @@ void Renderer::CreateShadowMapsPlaceholders()
 
 	for (int i = 0; i < 16; i++)
 	{
-		glGenTextures(1, &m_PointLightShadowMapsPlaceholders[i]);
-		glBindTexture(GL_TEXTURE_CUBE_MAP, m_PointLightShadowMapsPlaceholders[i]);
+		RenderDevice::Get().GenTextures(1, &m_PointLightShadowMapsPlaceholders[i]);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_PointLightShadowMapsPlaceholders[i]);
 		for (int i = 0; i < 6; i++)
-			glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+			RenderDevice::Get().TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
 
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 
 
-		glGenTextures(1, &m_SpotLightShadowMapsPlaceholders[i]);
-		glBindTexture(GL_TEXTURE_2D, m_SpotLightShadowMapsPlaceholders[i]);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+		RenderDevice::Get().GenTextures(1, &m_SpotLightShadowMapsPlaceholders[i]);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_SpotLightShadowMapsPlaceholders[i]);
+		RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	}
 
 
@@ -4,16 +4,35 @@
 #include <glm/glm.hpp>
 #include <iostream>
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 
-#define CHECK_OPENGL_ERRORS()	while (GLenum error = glGetError()) \
+#include "Culling.h"
+#include "RenderCommandBuffer.h"
+#include "Scene/Mobility.h"
+
+#define CHECK_OPENGL_ERRORS()	while (GLenum error = RenderDevice::Get().GetError()) \
 								{ std::cout << "OpenGL Error: " << error << std::endl; __debugbreak(); }
 									
 
+// Shader storage binding of the main pass's per-draw data
+#define DRAW_DATA_BINDING 3
+
 class Framebuffer;
 class Scene;
 class DirectionalLight;
 class PointLight;
 class SpotLight;
+class Material;
+class Shader;
+struct FrameLights;
+
+struct ShadowMapStats
+{
+	uint32_t Rendered = 0;
+	uint32_t Reused = 0;
+	// Rendered shadow maps which also had to redraw their static casters
+	uint32_t StaticLayersRendered = 0;
+};
 
 class Renderer
 {
@@ -31,6 +50,7 @@ private:
 	Ref<Framebuffer> m_BlurFramebuffer;
 
 	Ref<Framebuffer> m_DirectionalLightShadowMapFramebuffer;
+	Ref<Framebuffer> m_DirectionalLightStaticShadowMapFramebuffer;
 	Ref<Framebuffer> m_PointLightShadowMapFramebuffer;
 	Ref<Framebuffer> m_SpotLightShadowMapFramebuffer;
 
@@ -53,6 +73,25 @@ private:
 	float m_Gamma;
 	float m_Exposure;
 
+	// Camera visibility of the scene's draw items this frame
+	std::vector<uint8_t> m_DrawItemsVisibility;
+	// Visibility of the scene's shadow casters from the light being rendered
+	std::vector<uint8_t> m_ShadowCastersVisibility;
+	std::vector<uint8_t> m_InstancedShadowCastersVisibility;
+	CullingStats m_CullingStats;
+
+	// Main pass draws of this frame
+	RenderCommandBuffer m_Commands;
+	RenderCommandStats m_CommandStats;
+
+	// Multi-draw submission of the main pass, model matrices are read by draw index from the draw data buffer
+	std::vector<DrawBatch> m_DrawBatches;
+	std::vector<DrawIndirectCommand> m_IndirectCommands;
+	std::vector<glm::mat4> m_DrawModels;
+	uint32_t m_IndirectBuffer = 0;
+	uint32_t m_DrawDataBuffer = 0;
+	ShadowMapStats m_ShadowMapStats;
+
 public:
 	Renderer();
 	~Renderer();
@@ -71,11 +110,12 @@ public:
 	void InitializePostProcessing();
 
 	void RenderScene(Ref<Scene> scene);
+	void RenderDrawItems(Scene* scene);
 	void AddPostProcessingEffects();
 
-	void RenderShadowMap(Scene* scene, DirectionalLight* source);
-	void RenderShadowMap(Scene* scene, PointLight* source);
-	void RenderShadowMap(Scene* scene, SpotLight* source);
+	void RenderShadowMap(Scene* scene, DirectionalLight* source, bool updateStaticLayer);
+	void RenderShadowMap(Scene* scene, PointLight* source, bool updateStaticLayer);
+	void RenderShadowMap(Scene* scene, SpotLight* source, bool updateStaticLayer);
 
 	void RenderQuad();
 
@@ -89,9 +129,24 @@ public:
 	inline uint32_t GetSpotLightShadowMapPlaceholder(int index) const { return m_SpotLightShadowMapsPlaceholders[index]; }
 
 	inline bool IsPostProcessing() const { return m_PostProcessing; }
+	inline const CullingStats& GetCullingStats() const { return m_CullingStats; }
+	inline const ShadowMapStats& GetShadowMapStats() const { return m_ShadowMapStats; }
+	inline const RenderCommandStats& GetCommandStats() const { return m_CommandStats; }
+
+	// Called by lights keeping last frame's shadow map
+	inline void CountReusedShadowMap() { m_ShadowMapStats.Reused++; }
 
 private:
 	void CreateShadowMapsPlaceholders();
+	void CullDrawItems(Scene* scene);
+	void CullShadowCasters(Scene* scene, const Frustum& frustum);
+	void CullShadowCasters(Scene* scene, const BoundingSphere& sphere);
+	void RenderShadowCasters(Scene* scene, const Ref<Shader>& depthShader, const Ref<Shader>& depthInstancedShader, Mobility mobility);
+	void CopyShadowMap(uint32_t source, uint32_t destination, uint32_t target, uint32_t width, uint32_t height, int layers);
+	void RecordCommands(Scene* scene);
+	void BuildDrawBatches();
+	void SubmitCommands(const FrameLights& lights);
+	void SetFrameUniforms(Shader* shader, const FrameLights& lights);
 
 	friend class RendererSettingsPanel;
 };
\ No newline at end of file
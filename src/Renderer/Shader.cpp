@@ -1,6 +1,7 @@
 #include "Shader.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 
 Shader::Shader(std::string name, const char* vertexPath, const char* fragmentPath, const char* geometryPath)
     : m_Name(name), m_Uniforms(std::vector<ShaderUniform>())
@@ -47,147 +48,193 @@ Shader::Shader(std::string name, const char* vertexPath, const char* fragmentPat
     if (geometryPath)
         geometryShader = CompileShader(GL_GEOMETRY_SHADER, geometrySource.c_str());
 
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
+    unsigned int shaderProgram = RenderDevice::Get().CreateProgram();
+    RenderDevice::Get().AttachShader(shaderProgram, vertexShader);
+    RenderDevice::Get().AttachShader(shaderProgram, fragmentShader);
     if (geometryPath)
-        glAttachShader(shaderProgram, geometryShader);
+        RenderDevice::Get().AttachShader(shaderProgram, geometryShader);
 
-    glLinkProgram(shaderProgram);
+    RenderDevice::Get().LinkProgram(shaderProgram);
 
     int result;
     char infoLog[512];
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &result);
+    RenderDevice::Get().GetProgramiv(shaderProgram, GL_LINK_STATUS, &result);
     if (!result)
     {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+        RenderDevice::Get().GetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
         std::cout << "Shader program linking failed: " << infoLog << std::endl;
     }
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    RenderDevice::Get().DeleteShader(vertexShader);
+    RenderDevice::Get().DeleteShader(fragmentShader);
     if (geometryPath)
-        glDeleteShader(geometryShader);
+        RenderDevice::Get().DeleteShader(geometryShader);
 
     id = shaderProgram;
 
-    LoadUniforms();
+    m_UniformTable.Load(id, m_Uniforms);
 }
 
 Shader::~Shader()
 {
-    glDeleteProgram(id);
+    RenderDevice::Get().DeleteProgram(id);
 }
 
 void Shader::Use() const
 {
-    glUseProgram(id);
+    RenderDevice::Get().UseProgram(id);
+}
+
+int32_t Shader::GetUniformBlockIndex(const char* name) const
+{
+    uint32_t index = RenderDevice::Get().GetUniformBlockIndex(id, name);
+    return index == GL_INVALID_INDEX ? -1 : (int32_t)index;
+}
+
+uint32_t Shader::GetUniformBlockSize(int32_t blockIndex) const
+{
+    int32_t size = 0;
+    RenderDevice::Get().GetActiveUniformBlockiv(id, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+    return size;
+}
+
+void Shader::SetBool(UniformID uniform, bool value) const
+{
+    int intValue = value;
+    int32_t location = m_UniformTable.Update(uniform, &intValue, sizeof(intValue));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1i(location, intValue);
 }
 
 void Shader::SetBool(const std::string& name, bool value) const
 {
-    glUniform1i(glGetUniformLocation(id, name.c_str()), (int)value);
+    SetBool(UniformName::Get(name), value);
+}
+
+void Shader::SetBool(const char* name, bool value) const
+{
+    SetBool(UniformName::Get(name), value);
+}
+
+void Shader::SetInt(UniformID uniform, int value) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &value, sizeof(value));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1i(location, value);
 }
 
 void Shader::SetInt(const std::string& name, int value) const
 {
-    glUniform1i(glGetUniformLocation(id, name.c_str()), value);
+    SetInt(UniformName::Get(name), value);
+}
+
+void Shader::SetInt(const char* name, int value) const
+{
+    SetInt(UniformName::Get(name), value);
+}
+
+void Shader::SetFloat(UniformID uniform, float value) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &value, sizeof(value));
+    if (location >= 0)
+        RenderDevice::Get().Uniform1f(location, value);
 }
 
 void Shader::SetFloat(const std::string& name, float value) const
 {
-    glUniform1f(glGetUniformLocation(id, name.c_str()), value);
+    SetFloat(UniformName::Get(name), value);
+}
+
+void Shader::SetFloat(const char* name, float value) const
+{
+    SetFloat(UniformName::Get(name), value);
+}
+
+void Shader::SetVec2(UniformID uniform, const glm::vec2& vec) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &vec, sizeof(vec));
+    if (location >= 0)
+        RenderDevice::Get().Uniform2f(location, vec.x, vec.y);
+}
+
+void Shader::SetVec2(const std::string& name, const glm::vec2& vec) const
+{
+    SetVec2(UniformName::Get(name), vec);
 }
 
-void Shader::SetVec2(const std::string& name, glm::vec2& vec) const
+void Shader::SetVec2(const char* name, const glm::vec2& vec) const
 {
-    glUniform2f(glGetUniformLocation(id, name.c_str()), vec.x, vec.y);
+    SetVec2(UniformName::Get(name), vec);
 }
 
-void Shader::SetVec3(const std::string& name, glm::vec3& vec) const
+void Shader::SetVec3(UniformID uniform, const glm::vec3& vec) const
 {
-    glUniform3f(glGetUniformLocation(id, name.c_str()), vec.x, vec.y, vec.z);
+    int32_t location = m_UniformTable.Update(uniform, &vec, sizeof(vec));
+    if (location >= 0)
+        RenderDevice::Get().Uniform3f(location, vec.x, vec.y, vec.z);
 }
 
-void Shader::SetVec4(const std::string& name, glm::vec4& vec) const
+void Shader::SetVec3(const std::string& name, const glm::vec3& vec) const
 {
-    glUniform4f(glGetUniformLocation(id, name.c_str()), vec.x, vec.y, vec.z, vec.w);
+    SetVec3(UniformName::Get(name), vec);
 }
 
-void Shader::SetMat4(const std::string& name, glm::mat4& mat) const
+void Shader::SetVec3(const char* name, const glm::vec3& vec) const
 {
-    glUniformMatrix4fv(glGetUniformLocation(id, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    SetVec3(UniformName::Get(name), vec);
+}
+
+void Shader::SetVec4(UniformID uniform, const glm::vec4& vec) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &vec, sizeof(vec));
+    if (location >= 0)
+        RenderDevice::Get().Uniform4f(location, vec.x, vec.y, vec.z, vec.w);
+}
+
+void Shader::SetVec4(const std::string& name, const glm::vec4& vec) const
+{
+    SetVec4(UniformName::Get(name), vec);
+}
+
+void Shader::SetVec4(const char* name, const glm::vec4& vec) const
+{
+    SetVec4(UniformName::Get(name), vec);
+}
+
+void Shader::SetMat4(UniformID uniform, const glm::mat4& mat) const
+{
+    int32_t location = m_UniformTable.Update(uniform, &mat, sizeof(mat));
+    if (location >= 0)
+        RenderDevice::Get().UniformMatrix4fv(location, 1, GL_FALSE, &mat[0][0]);
+}
+
+void Shader::SetMat4(const std::string& name, const glm::mat4& mat) const
+{
+    SetMat4(UniformName::Get(name), mat);
+}
+
+void Shader::SetMat4(const char* name, const glm::mat4& mat) const
+{
+    SetMat4(UniformName::Get(name), mat);
 }
 
 unsigned int Shader::CompileShader(unsigned int type, const char* source)
 {
-    unsigned int shader = glCreateShader(type);
-    glShaderSource(shader, 1, &source, nullptr);
-    glCompileShader(shader);
+    unsigned int shader = RenderDevice::Get().CreateShader(type);
+    RenderDevice::Get().ShaderSource(shader, 1, &source, nullptr);
+    RenderDevice::Get().CompileShader(shader);
 
     int result;
     char infoLog[512];
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &result);
+    RenderDevice::Get().GetShaderiv(shader, GL_COMPILE_STATUS, &result);
     if (result == GL_FALSE)
     {
-        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        RenderDevice::Get().GetShaderInfoLog(shader, 512, NULL, infoLog);
         std::cout << ((type == GL_VERTEX_SHADER) ? "Vertex" : (type == GL_FRAGMENT_SHADER) ? "Fragment" : "Geometry") << " Shader compilation failed: ";
         std::cout << infoLog << std::endl;
-        glDeleteShader(shader);
+        RenderDevice::Get().DeleteShader(shader);
         return 0;
     }
 
     return shader;
-}
-
-void Shader::LoadUniforms()
-{
-    m_Uniforms.clear();
-
-    GLint uniformsCount;
-    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformsCount);
-
-    GLsizei length;
-    GLint size;
-    GLenum type;
-    GLchar uniformName[32];
-    for (GLuint i = 0; i < uniformsCount; i++)
-    {
-        glGetActiveUniform(id, i, 32, &length, &size, &type, uniformName);
-
-        ShaderUniform uniform;
-        uniform.name = uniformName;
-        switch (type)
-        {
-        case GL_BOOL:
-            uniform.type = ShaderUniformType::BOOL;
-            break;
-        case GL_INT:
-            uniform.type = ShaderUniformType::INT;
-            break;
-        case GL_FLOAT:
-            uniform.type = ShaderUniformType::FLOAT;
-            break;
-        case GL_FLOAT_VEC3:
-            uniform.type = ShaderUniformType::VEC3;
-            break;
-        case GL_FLOAT_VEC4:
-            uniform.type = ShaderUniformType::VEC4;
-            break;
-        case GL_FLOAT_MAT3:
-            uniform.type = ShaderUniformType::MAT3;
-            break;
-        case GL_FLOAT_MAT4:
-            uniform.type = ShaderUniformType::MAT4;
-            break;
-        case GL_SAMPLER_2D:
-            uniform.type = ShaderUniformType::SAMPLER_2D;
-            break;
-        case GL_SAMPLER_CUBE:
-            uniform.type = ShaderUniformType::SAMPLER_CUBE;
-            break;
-        }
-
-        m_Uniforms.push_back(uniform);
-    }
-}
+}
\ No newline at end of file
@@ -2,17 +2,7 @@
 
 #include <glm/glm.hpp>
 
-enum class ShaderUniformType
-{
-	BOOL, INT, FLOAT, VEC3, VEC4, MAT3, MAT4, SAMPLER_2D, SAMPLER_CUBE
-};
-
-struct ShaderUniform
-{
-public:
-	std::string name;
-	ShaderUniformType type;
-};
+#include "UniformTable.h"
 
 class Shader
 {
@@ -22,25 +12,46 @@ public:
 private:
 	std::string m_Name;
 	std::vector<ShaderUniform> m_Uniforms;
+	mutable UniformTable m_UniformTable;
 
 public:
 	Shader(std::string name, const char* vertexPath, const char* fragmentPath, const char* geometryPath = nullptr);
 	~Shader();
 	void Use() const;
 
-	inline std::string GetName() const { return m_Name; }
-	inline std::vector<ShaderUniform> GetUniforms() const { return m_Uniforms; }
+	inline const std::string& GetName() const { return m_Name; }
+	inline const std::vector<ShaderUniform>& GetUniforms() const { return m_Uniforms; }
+
+	// -1 when the program has no active uniform block with this name
+	int32_t GetUniformBlockIndex(const char* name) const;
+	uint32_t GetUniformBlockSize(int32_t blockIndex) const;
 
 	// uniforms
+	void SetBool(UniformID uniform, bool value) const;
+	void SetInt(UniformID uniform, int value) const;
+	void SetFloat(UniformID uniform, float value) const;
+	void SetVec2(UniformID uniform, const glm::vec2& vec) const;
+	void SetVec3(UniformID uniform, const glm::vec3& vec) const;
+	void SetVec4(UniformID uniform, const glm::vec4& vec) const;
+	void SetMat4(UniformID uniform, const glm::mat4& mat) const;
+
+	// Interns the name on every call, per draw paths should keep the UniformID instead
 	void SetBool(const std::string& name, bool value) const;
 	void SetInt(const std::string& name, int value) const;
 	void SetFloat(const std::string& name, float value) const;
-	void SetVec2(const std::string& name, glm::vec2& vec) const;
-	void SetVec3(const std::string& name, glm::vec3& vec) const;
-	void SetVec4(const std::string& name, glm::vec4& vec) const;
-	void SetMat4(const std::string& name, glm::mat4& mat) const;
+	void SetVec2(const std::string& name, const glm::vec2& vec) const;
+	void SetVec3(const std::string& name, const glm::vec3& vec) const;
+	void SetVec4(const std::string& name, const glm::vec4& vec) const;
+	void SetMat4(const std::string& name, const glm::mat4& mat) const;
+
+	void SetBool(const char* name, bool value) const;
+	void SetInt(const char* name, int value) const;
+	void SetFloat(const char* name, float value) const;
+	void SetVec2(const char* name, const glm::vec2& vec) const;
+	void SetVec3(const char* name, const glm::vec3& vec) const;
+	void SetVec4(const char* name, const glm::vec4& vec) const;
+	void SetMat4(const char* name, const glm::mat4& mat) const;
 	
 private:
 	unsigned int CompileShader(unsigned int type, const char* source);
-	void LoadUniforms();
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "typedefs.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 
 template <class T>
 class ShaderStorageBuffer
@@ -10,35 +11,35 @@ class ShaderStorageBuffer
 public:
 	ShaderStorageBuffer(uint32_t size) : m_Size(size)
 	{
-		glGenBuffers(1, &m_ID);
-		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
-		glBufferData(GL_SHADER_STORAGE_BUFFER, size * sizeof(T), NULL, GL_STATIC_DRAW);
-		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		RenderDevice::Get().GenBuffers(1, &m_ID);
+		RenderDevice::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+		RenderDevice::Get().BufferData(GL_SHADER_STORAGE_BUFFER, size * sizeof(T), NULL, GL_STATIC_DRAW);
+		RenderDevice::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 	}
 
 	~ShaderStorageBuffer()
 	{
-		glDeleteBuffers(1, &m_ID);
+		RenderDevice::Get().DeleteBuffers(1, &m_ID);
 	}
 
 	void Bind()
 	{
-		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+		RenderDevice::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
 	}
 
 	void Unbind()
 	{
-		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		RenderDevice::Get().BindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 	}
 
 	T* Map(int32_t access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)
 	{
-		return (T*)glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, m_Size * sizeof(T), access);
+		return (T*)RenderDevice::Get().MapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, m_Size * sizeof(T), access);
 	}
 
 	void Unmap()
 	{
-		glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+		RenderDevice::Get().UnmapBuffer(GL_SHADER_STORAGE_BUFFER);
 	}
 
 	inline uint32_t GetID() const { return m_ID; }
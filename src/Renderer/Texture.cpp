@@ -1,6 +1,7 @@
 #include "Texture.h"
 
 #include <glad/glad.h>
+#include "Device/RenderDevice.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
@@ -24,7 +25,7 @@ Texture::Texture(std::string path, TextureRange range)
 
 Texture::~Texture()
 {
-	glDeleteTextures(1, &m_ID);
+	RenderDevice::Get().DeleteTextures(1, &m_ID);
 }
 
 Ref<Texture> Texture::Create(std::string path, TextureRange range)
@@ -38,7 +39,7 @@ void Texture::Load(std::string path)
 
 	if (m_ID)
 	{
-		glDeleteTextures(1, &m_ID);
+		RenderDevice::Get().DeleteTextures(1, &m_ID);
 	}
 
 	stbi_set_flip_vertically_on_load(true);
@@ -46,22 +47,22 @@ void Texture::Load(std::string path)
 	unsigned char* data = stbi_load(path.c_str(), &width, &height, &nrComponents, 0);
 	if (data)
 	{
-		glGenTextures(1, &m_ID);
-		glBindTexture(GL_TEXTURE_2D, m_ID);
+		RenderDevice::Get().GenTextures(1, &m_ID);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_ID);
 
 		if (nrComponents == 1)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, data);
+			RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_SRGB, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, data);
 		else if (nrComponents == 3)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+			RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_SRGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
 		else if (nrComponents == 4)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB_ALPHA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+			RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_SRGB_ALPHA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
 
-		glGenerateMipmap(GL_TEXTURE_2D);
+		RenderDevice::Get().GenerateMipmap(GL_TEXTURE_2D);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 	}
 	else
 	{
@@ -77,7 +78,7 @@ void Texture::LoadHDR(std::string path)
 
 	if (m_ID)
 	{
-		glDeleteTextures(1, &m_ID);
+		RenderDevice::Get().DeleteTextures(1, &m_ID);
 	}
 
 	stbi_set_flip_vertically_on_load(true);
@@ -85,14 +86,14 @@ void Texture::LoadHDR(std::string path)
 	float* data = stbi_loadf(path.c_str(), &width, &height, &nrComponents, 0);
 	if (data)
 	{
-		glGenTextures(1, &m_ID);
-		glBindTexture(GL_TEXTURE_2D, m_ID);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, data);
-
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		RenderDevice::Get().GenTextures(1, &m_ID);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_ID);
+		RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, data);
+
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	}
 	else
 	{
@@ -102,11 +103,11 @@ void Texture::LoadHDR(std::string path)
 
 void Texture::Bind(uint32_t index)
 {
-	glActiveTexture(GL_TEXTURE0 + index);
-	glBindTexture(GL_TEXTURE_2D, m_ID);
+	RenderDevice::Get().ActiveTexture(GL_TEXTURE0 + index);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_ID);
 }
 
 void Texture::Unbind()
 {
-	glBindTexture(GL_TEXTURE_2D, 0);
+	RenderDevice::Get().BindTexture(GL_TEXTURE_2D, 0);
 }
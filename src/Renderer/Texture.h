@@ -19,7 +19,7 @@ public:
 	void Bind(uint32_t index);
 	void Unbind();
 
-	inline std::string GetPath() const { return m_Path; }
+	inline const std::string& GetPath() const { return m_Path; }
 
 private:
 	uint32_t m_ID;
@@ -0,0 +1,91 @@
+#include "UniformBufferArena.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <glad/glad.h>
+#include "Device/RenderDevice.h"
+
+static uint32_t AlignBlockSize(uint32_t size)
+{
+	return (size + UniformBufferArena::BLOCK_ALIGNMENT - 1) / UniformBufferArena::BLOCK_ALIGNMENT * UniformBufferArena::BLOCK_ALIGNMENT;
+}
+
+UniformBufferArena::UniformBufferArena(uint32_t binding, uint32_t capacity)
+	: m_Binding(binding), m_Capacity(AlignBlockSize(std::max(capacity, 1u)))
+{
+	m_Data.resize(m_Capacity, 0);
+
+	RenderDevice::Get().GenBuffers(1, &m_ID);
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, m_ID);
+	RenderDevice::Get().BufferData(GL_UNIFORM_BUFFER, m_Capacity, m_Data.data(), GL_DYNAMIC_DRAW);
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+UniformBufferArena::~UniformBufferArena()
+{
+	RenderDevice::Get().DeleteBuffers(1, &m_ID);
+}
+
+UniformBufferBlock UniformBufferArena::Allocate(uint32_t size)
+{
+	UniformBufferBlock block;
+	block.Size = AlignBlockSize(size);
+
+	auto it = std::find_if(m_FreeBlocks.begin(), m_FreeBlocks.end(), [&](const UniformBufferBlock& free) { return free.Size == block.Size; });
+	if (it != m_FreeBlocks.end())
+	{
+		block.Offset = it->Offset;
+		m_FreeBlocks.erase(it);
+	}
+	else
+	{
+		if (m_Size + block.Size > m_Capacity)
+			Grow(m_Size + block.Size);
+
+		block.Offset = m_Size;
+		m_Size += block.Size;
+	}
+
+	std::fill(m_Data.begin() + block.Offset, m_Data.begin() + block.Offset + block.Size, 0);
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, m_ID);
+	RenderDevice::Get().BufferSubData(GL_UNIFORM_BUFFER, block.Offset, block.Size, m_Data.data() + block.Offset);
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	return block;
+}
+
+void UniformBufferArena::Free(UniformBufferBlock block)
+{
+	if (block.IsValid())
+		m_FreeBlocks.push_back(block);
+}
+
+void UniformBufferArena::Update(const UniformBufferBlock& block, uint32_t offset, uint32_t size, const void* data)
+{
+	uint8_t* destination = m_Data.data() + block.Offset + offset;
+	if (memcmp(destination, data, size) == 0)
+		return;
+
+	memcpy(destination, data, size);
+
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, m_ID);
+	RenderDevice::Get().BufferSubData(GL_UNIFORM_BUFFER, block.Offset + offset, size, data);
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void UniformBufferArena::Bind(const UniformBufferBlock& block) const
+{
+	RenderDevice::Get().BindBufferRange(GL_UNIFORM_BUFFER, m_Binding, m_ID, block.Offset, block.Size);
+}
+
+void UniformBufferArena::Grow(uint32_t minimumCapacity)
+{
+	m_Capacity = AlignBlockSize(std::max(minimumCapacity, m_Capacity * 2));
+	m_Data.resize(m_Capacity, 0);
+
+	// Same buffer name, so blocks bound later keep pointing at it
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, m_ID);
+	RenderDevice::Get().BufferData(GL_UNIFORM_BUFFER, m_Capacity, m_Data.data(), GL_DYNAMIC_DRAW);
+	RenderDevice::Get().BindBuffer(GL_UNIFORM_BUFFER, 0);
+}
\ No newline at end of file
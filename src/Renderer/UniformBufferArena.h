@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+#include "typedefs.h"
+
+struct UniformBufferBlock
+{
+	uint32_t Offset = 0;
+	uint32_t Size = 0;
+
+	inline bool IsValid() const { return Size > 0; }
+};
+
+// One uniform buffer shared by many small blocks (e.g. the parameters of every material).
+// Using a block binds its range with a single glBindBufferRange, updates only upload the bytes which changed.
+// A copy of the contents is kept on the CPU so the buffer can grow without reading it back.
+class UniformBufferArena
+{
+public:
+	// Largest uniform buffer offset alignment OpenGL allows, so any driver accepts every block offset
+	static constexpr uint32_t BLOCK_ALIGNMENT = 256;
+
+private:
+	uint32_t m_ID;
+	uint32_t m_Binding;
+	uint32_t m_Capacity;
+	uint32_t m_Size = 0;
+
+	std::vector<uint8_t> m_Data;
+	// Freed blocks, reused by allocations of the same aligned size
+	std::vector<UniformBufferBlock> m_FreeBlocks;
+
+public:
+	UniformBufferArena(uint32_t binding, uint32_t capacity);
+	~UniformBufferArena();
+
+	UniformBufferArena(const UniformBufferArena&) = delete;
+	UniformBufferArena& operator=(const UniformBufferArena&) = delete;
+
+	// Contents start zeroed
+	UniformBufferBlock Allocate(uint32_t size);
+	void Free(UniformBufferBlock block);
+
+	// Offset is relative to the block
+	void Update(const UniformBufferBlock& block, uint32_t offset, uint32_t size, const void* data);
+	void Bind(const UniformBufferBlock& block) const;
+
+	inline uint32_t GetBinding() const { return m_Binding; }
+	inline uint32_t GetSize() const { return m_Size; }
+	inline uint32_t GetCapacity() const { return m_Capacity; }
+
+private:
+	void Grow(uint32_t minimumCapacity);
+};
\ No newline at end of file
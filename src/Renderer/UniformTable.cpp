@@ -0,0 +1,198 @@
+#include "UniformTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include <glad/glad.h>
+#include "Device/RenderDevice.h"
+
+struct UniformNames
+{
+	std::mutex Mutex;
+	// Deque keeps the strings in place, the map keys view into them
+	std::deque<std::string> Names;
+	std::unordered_map<std::string_view, UniformID> IDs;
+};
+
+static UniformNames& GetUniformNames()
+{
+	static UniformNames names;
+	return names;
+}
+
+UniformID UniformName::Get(std::string_view name)
+{
+	UniformNames& names = GetUniformNames();
+	std::lock_guard<std::mutex> lock(names.Mutex);
+
+	auto it = names.IDs.find(name);
+	if (it != names.IDs.end())
+		return it->second;
+
+	UniformID id = names.Names.size();
+	names.IDs.emplace(names.Names.emplace_back(name), id);
+	return id;
+}
+
+UniformID UniformName::Get(std::string_view name, uint32_t index)
+{
+	std::string element;
+	element.reserve(name.size() + 12);
+	element.append(name).append("[").append(std::to_string(index)).append("]");
+
+	return Get(element);
+}
+
+const std::string& UniformName::GetString(UniformID id)
+{
+	UniformNames& names = GetUniformNames();
+	std::lock_guard<std::mutex> lock(names.Mutex);
+
+	return names.Names[id];
+}
+
+static ShaderUniformType ToUniformType(uint32_t type)
+{
+	switch (type)
+	{
+	case GL_BOOL:
+		return ShaderUniformType::BOOL;
+	case GL_FLOAT:
+		return ShaderUniformType::FLOAT;
+	case GL_FLOAT_VEC3:
+		return ShaderUniformType::VEC3;
+	case GL_FLOAT_VEC4:
+		return ShaderUniformType::VEC4;
+	case GL_FLOAT_MAT3:
+		return ShaderUniformType::MAT3;
+	case GL_FLOAT_MAT4:
+		return ShaderUniformType::MAT4;
+	case GL_SAMPLER_2D:
+		return ShaderUniformType::SAMPLER_2D;
+	case GL_SAMPLER_CUBE:
+		return ShaderUniformType::SAMPLER_CUBE;
+	default:
+		return ShaderUniformType::INT;
+	}
+}
+
+void UniformTable::Load(uint32_t program, std::vector<ShaderUniform>& uniforms)
+{
+	m_Program = program;
+	m_SlotIndices.clear();
+	m_Slots.assign(1, Slot());
+	m_LocationSlots.clear();
+	m_Cache.clear();
+	uniforms.clear();
+
+	int32_t uniformsCount = 0;
+	int32_t maxNameLength = 0;
+	RenderDevice::Get().GetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformsCount);
+	RenderDevice::Get().GetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+	std::vector<char> nameBuffer(std::max(maxNameLength, 1));
+	for (int32_t i = 0; i < uniformsCount; i++)
+	{
+		int32_t length = 0;
+		int32_t size = 0;
+		uint32_t type = 0;
+		RenderDevice::Get().GetActiveUniform(program, i, nameBuffer.size(), &length, &size, &type, nameBuffer.data());
+
+		std::string_view name(nameBuffer.data(), length);
+		UniformID id = UniformName::Get(name);
+		int32_t location = RenderDevice::Get().GetUniformLocation(program, nameBuffer.data());
+		SetLocation(id, location);
+
+		// Arrays are reported once as "name[0]", every element gets its own slot and the bare name shares the first one's
+		std::string_view arraySuffix = "[0]";
+		if (name.size() > arraySuffix.size() && name.substr(name.size() - arraySuffix.size()) == arraySuffix)
+		{
+			std::string_view arrayName = name.substr(0, name.size() - arraySuffix.size());
+			SetLocation(UniformName::Get(arrayName), location);
+
+			for (int32_t element = 1; element < size; element++)
+			{
+				UniformID elementID = UniformName::Get(arrayName, element);
+				SetLocation(elementID, RenderDevice::Get().GetUniformLocation(program, UniformName::GetString(elementID).c_str()));
+			}
+		}
+
+		uniforms.push_back({ std::string(name), ToUniformType(type), id });
+	}
+
+	if (uniformsCount == 0)
+		return;
+
+	std::vector<uint32_t> indices(uniformsCount);
+	std::vector<int32_t> blockIndices(uniformsCount);
+	std::vector<int32_t> blockOffsets(uniformsCount);
+	for (int32_t i = 0; i < uniformsCount; i++)
+		indices[i] = i;
+
+	RenderDevice::Get().GetActiveUniformsiv(program, uniformsCount, indices.data(), GL_UNIFORM_BLOCK_INDEX, blockIndices.data());
+	RenderDevice::Get().GetActiveUniformsiv(program, uniformsCount, indices.data(), GL_UNIFORM_OFFSET, blockOffsets.data());
+
+	for (int32_t i = 0; i < uniformsCount; i++)
+	{
+		uniforms[i].blockIndex = blockIndices[i];
+		uniforms[i].blockOffset = blockOffsets[i];
+	}
+}
+
+int32_t UniformTable::Update(UniformID id, const void* value, uint32_t size)
+{
+	Slot& slot = Resolve(id);
+	if (slot.Location < 0)
+		return -1;
+
+	if (slot.CacheSize == 0)
+	{
+		slot.CacheOffset = m_Cache.size();
+		slot.CacheSize = size;
+		m_Cache.insert(m_Cache.end(), (const uint8_t*)value, (const uint8_t*)value + size);
+		return slot.Location;
+	}
+
+	// Set through setters of different types, not worth caching
+	if (slot.CacheSize != size)
+		return slot.Location;
+
+	uint8_t* cached = m_Cache.data() + slot.CacheOffset;
+	if (memcmp(cached, value, size) == 0)
+		return -1;
+
+	memcpy(cached, value, size);
+	return slot.Location;
+}
+
+UniformTable::Slot& UniformTable::Resolve(UniformID id)
+{
+	if (id >= m_SlotIndices.size() || m_SlotIndices[id] == UNRESOLVED_SLOT)
+		SetLocation(id, RenderDevice::Get().GetUniformLocation(m_Program, UniformName::GetString(id).c_str()));
+
+	return m_Slots[m_SlotIndices[id]];
+}
+
+void UniformTable::SetLocation(UniformID id, int32_t location)
+{
+	if (id >= m_SlotIndices.size())
+		m_SlotIndices.resize(id + 1, UNRESOLVED_SLOT);
+
+	if (location < 0)
+	{
+		m_SlotIndices[id] = 0;
+		return;
+	}
+
+	auto it = m_LocationSlots.find(location);
+	if (it == m_LocationSlots.end())
+	{
+		it = m_LocationSlots.emplace(location, m_Slots.size()).first;
+		m_Slots.push_back({ location });
+	}
+
+	m_SlotIndices[id] = it->second;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "typedefs.h"
+
+using UniformID = uint32_t;
+
+enum class ShaderUniformType
+{
+	BOOL, INT, FLOAT, VEC3, VEC4, MAT3, MAT4, SAMPLER_2D, SAMPLER_CUBE
+};
+
+struct ShaderUniform
+{
+public:
+	std::string name;
+	ShaderUniformType type;
+	UniformID id;
+	// Members of uniform blocks have no location, they are found at an offset of their block instead
+	int32_t blockIndex = -1;
+	int32_t blockOffset = -1;
+};
+
+// Uniform names interned to dense IDs shared by every shader.
+// Hot paths intern their names once and keep the ID, array elements are interned as "name[index]".
+class UniformName
+{
+public:
+	static UniformID Get(std::string_view name);
+	static UniformID Get(std::string_view name, uint32_t index);
+	static const std::string& GetString(UniformID id);
+};
+
+// Locations of a program's uniforms indexed by UniformID, and the last value uploaded to each of them.
+// Uniform values are program state, so a value equal to the cached one does not need to be sent again.
+// Names of the same location ("name" and "name[0]") share one slot, so neither can keep a stale value.
+class UniformTable
+{
+private:
+	struct Slot
+	{
+		int32_t Location = -1;
+		uint32_t CacheOffset = 0;
+		uint32_t CacheSize = 0;
+	};
+
+	static constexpr uint32_t UNRESOLVED_SLOT = 0xFFFFFFFF;
+
+	uint32_t m_Program = 0;
+	// Per UniformID, index of its slot. Slot 0 is shared by every inactive name.
+	std::vector<uint32_t> m_SlotIndices;
+	std::vector<Slot> m_Slots;
+	std::unordered_map<int32_t, uint32_t> m_LocationSlots;
+	std::vector<uint8_t> m_Cache;
+
+public:
+	// Reflects the active uniforms of a linked program and resolves all their locations up front
+	void Load(uint32_t program, std::vector<ShaderUniform>& uniforms);
+
+	// Location to upload the value to, or -1 when the uniform is not active or already holds this value
+	int32_t Update(UniformID id, const void* value, uint32_t size);
+
+private:
+	// Names which were not reflected (inactive or set before linking) are looked up once
+	Slot& Resolve(UniformID id);
+	void SetLocation(UniformID id, int32_t location);
+};
\ No newline at end of file
@@ -0,0 +1,399 @@
+#include "BVH.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "Core/Jobs/JobSystem.h"
+
+int32_t BVH::CreateProxy(const AABB& bounds, void* userData)
+{
+	int32_t leaf = AllocateNode();
+	m_Nodes[leaf].Bounds = bounds;
+	m_Nodes[leaf].UserData = userData;
+
+	InsertLeaf(leaf);
+	m_LeavesCount++;
+
+	return leaf;
+}
+
+void BVH::DestroyProxy(int32_t proxy)
+{
+	RemoveLeaf(proxy);
+	FreeNode(proxy);
+	m_LeavesCount--;
+}
+
+void BVH::UpdateProxy(int32_t proxy, const AABB& bounds)
+{
+	if (m_Nodes[proxy].Bounds == bounds)
+		return;
+
+	m_Nodes[proxy].Bounds = bounds;
+	RefitAncestors(m_Nodes[proxy].Parent);
+}
+
+void BVH::Rebuild()
+{
+	if (m_Root < 0)
+		return;
+
+	// Leaves keep their indices, only internal nodes are recreated
+	std::vector<int32_t> leaves;
+	leaves.reserve(m_LeavesCount);
+
+	FrameVector<int32_t> stack;
+	stack.push_back(m_Root);
+	while (!stack.empty())
+	{
+		int32_t index = stack.back();
+		stack.pop_back();
+
+		if (m_Nodes[index].IsLeaf())
+		{
+			leaves.push_back(index);
+			continue;
+		}
+
+		stack.push_back(m_Nodes[index].Left);
+		stack.push_back(m_Nodes[index].Right);
+		FreeNode(index);
+	}
+
+	m_Cost = 0.0f;
+	m_Root = Build(leaves, 0, leaves.size());
+	m_Nodes[m_Root].Parent = -1;
+
+	m_BuildCost = GetNormalizedCost();
+}
+
+bool BVH::NeedsRebuild() const
+{
+	return m_LeavesCount > 2 && GetNormalizedCost() > m_BuildCost * REBUILD_THRESHOLD;
+}
+
+void BVH::Clear()
+{
+	m_Nodes.clear();
+	m_Root = -1;
+	m_FreeNodes = -1;
+	m_LeavesCount = 0;
+	m_Cost = 0.0f;
+	m_BuildCost = 0.0f;
+}
+
+void BVH::QueryBatch(Span<const Frustum> frustums, std::vector<std::vector<void*>>& results) const
+{
+	QueryBatchImpl(frustums, results);
+}
+
+void BVH::QueryBatch(Span<const AABB> aabbs, std::vector<std::vector<void*>>& results) const
+{
+	QueryBatchImpl(aabbs, results);
+}
+
+void BVH::QueryBatch(Span<const BoundingSphere> spheres, std::vector<std::vector<void*>>& results) const
+{
+	QueryBatchImpl(spheres, results);
+}
+
+void BVH::RaycastBatch(Span<const Ray> rays, float maxDistance, std::vector<RaycastHit>& hits) const
+{
+	hits.resize(rays.size());
+
+	JobSystem::GetInstance()->ParallelFor(rays.size(), [&](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			RaycastHit& hit = hits[i];
+			hit = RaycastHit();
+
+			Raycast(rays[i], maxDistance, [&](void* userData, float distance)
+			{
+				hit.UserData = userData;
+				hit.Distance = distance;
+				return distance;
+			});
+		}
+	}, 1);
+}
+
+uint32_t BVH::GetHeight() const
+{
+	if (m_Root < 0)
+		return 0;
+
+	uint32_t height = 0;
+	FrameVector<std::pair<int32_t, uint32_t>> stack;
+	stack.push_back({ m_Root, 1 });
+	while (!stack.empty())
+	{
+		auto [index, depth] = stack.back();
+		stack.pop_back();
+
+		height = std::max(height, depth);
+		if (!m_Nodes[index].IsLeaf())
+		{
+			stack.push_back({ m_Nodes[index].Left, depth + 1 });
+			stack.push_back({ m_Nodes[index].Right, depth + 1 });
+		}
+	}
+
+	return height;
+}
+
+template<typename Shape>
+void BVH::QueryBatchImpl(Span<const Shape> shapes, std::vector<std::vector<void*>>& results) const
+{
+	results.resize(shapes.size());
+
+	JobSystem::GetInstance()->ParallelFor(shapes.size(), [&](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			auto& result = results[i];
+			result.clear();
+			Query(shapes[i], [&](void* userData) { result.push_back(userData); });
+		}
+	}, 1);
+}
+
+int32_t BVH::AllocateNode()
+{
+	if (m_FreeNodes < 0)
+	{
+		m_Nodes.emplace_back();
+		return m_Nodes.size() - 1;
+	}
+
+	int32_t index = m_FreeNodes;
+	m_FreeNodes = m_Nodes[index].Parent;
+	m_Nodes[index] = BVHNode();
+
+	return index;
+}
+
+void BVH::FreeNode(int32_t index)
+{
+	m_Nodes[index] = BVHNode();
+	m_Nodes[index].Parent = m_FreeNodes;
+	m_FreeNodes = index;
+}
+
+void BVH::SetBounds(int32_t index, const AABB& bounds)
+{
+	m_Cost += bounds.GetSurfaceArea() - m_Nodes[index].Bounds.GetSurfaceArea();
+	m_Nodes[index].Bounds = bounds;
+}
+
+void BVH::InsertLeaf(int32_t leaf)
+{
+	if (m_Root < 0)
+	{
+		m_Root = leaf;
+		m_Nodes[leaf].Parent = -1;
+		return;
+	}
+
+	// Walk down to the cheapest sibling, a node's cost is the area it adds to the tree
+	// plus the growth its ancestors already had to take
+	AABB leafBounds = m_Nodes[leaf].Bounds;
+	int32_t sibling = m_Root;
+	while (!m_Nodes[sibling].IsLeaf())
+	{
+		const BVHNode& node = m_Nodes[sibling];
+		float area = node.Bounds.GetSurfaceArea();
+		float combinedArea = AABB::Merge(node.Bounds, leafBounds).GetSurfaceArea();
+
+		float cost = 2.0f * combinedArea;
+		float inheritedCost = 2.0f * (combinedArea - area);
+
+		auto childCost = [&](int32_t index)
+		{
+			const BVHNode& child = m_Nodes[index];
+			float mergedArea = AABB::Merge(child.Bounds, leafBounds).GetSurfaceArea();
+			return (child.IsLeaf() ? mergedArea : mergedArea - child.Bounds.GetSurfaceArea()) + inheritedCost;
+		};
+
+		float leftCost = childCost(node.Left);
+		float rightCost = childCost(node.Right);
+		if (cost < leftCost && cost < rightCost)
+			break;
+
+		sibling = leftCost < rightCost ? node.Left : node.Right;
+	}
+
+	int32_t oldParent = m_Nodes[sibling].Parent;
+	int32_t parent = AllocateNode();
+
+	AABB bounds = AABB::Merge(m_Nodes[sibling].Bounds, leafBounds);
+	m_Nodes[parent].Bounds = bounds;
+	m_Nodes[parent].Parent = oldParent;
+	m_Nodes[parent].Left = sibling;
+	m_Nodes[parent].Right = leaf;
+	m_Cost += bounds.GetSurfaceArea();
+
+	if (oldParent < 0)
+		m_Root = parent;
+	else if (m_Nodes[oldParent].Left == sibling)
+		m_Nodes[oldParent].Left = parent;
+	else
+		m_Nodes[oldParent].Right = parent;
+
+	m_Nodes[sibling].Parent = parent;
+	m_Nodes[leaf].Parent = parent;
+
+	RefitAncestors(oldParent);
+}
+
+void BVH::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == m_Root)
+	{
+		m_Root = -1;
+		return;
+	}
+
+	int32_t parent = m_Nodes[leaf].Parent;
+	int32_t grandParent = m_Nodes[parent].Parent;
+	int32_t sibling = m_Nodes[parent].Left == leaf ? m_Nodes[parent].Right : m_Nodes[parent].Left;
+
+	m_Cost -= m_Nodes[parent].Bounds.GetSurfaceArea();
+	FreeNode(parent);
+
+	m_Nodes[sibling].Parent = grandParent;
+	m_Nodes[leaf].Parent = -1;
+
+	if (grandParent < 0)
+	{
+		m_Root = sibling;
+		return;
+	}
+
+	if (m_Nodes[grandParent].Left == parent)
+		m_Nodes[grandParent].Left = sibling;
+	else
+		m_Nodes[grandParent].Right = sibling;
+
+	RefitAncestors(grandParent);
+}
+
+void BVH::RefitAncestors(int32_t index)
+{
+	while (index >= 0)
+	{
+		BVHNode& node = m_Nodes[index];
+		AABB bounds = AABB::Merge(m_Nodes[node.Left].Bounds, m_Nodes[node.Right].Bounds);
+
+		// Nothing above changes once a node keeps its bounds
+		if (bounds == node.Bounds)
+			break;
+
+		SetBounds(index, bounds);
+		index = node.Parent;
+	}
+}
+
+int32_t BVH::Build(std::vector<int32_t>& leaves, size_t begin, size_t end)
+{
+	if (end - begin == 1)
+		return leaves[begin];
+
+	AABB bounds, centroidBounds;
+	for (size_t i = begin; i < end; i++)
+	{
+		bounds.Expand(m_Nodes[leaves[i]].Bounds);
+		centroidBounds.Expand(m_Nodes[leaves[i]].Bounds.GetCenter());
+	}
+
+	glm::vec3 size = centroidBounds.Max - centroidBounds.Min;
+	int axis = size.x > size.y ? (size.x > size.z ? 0 : 2) : (size.y > size.z ? 1 : 2);
+	float axisMin = centroidBounds.Min[axis];
+	float axisSize = size[axis];
+
+	// Binned SAH, split after the bin with the lowest count * area on both sides
+	constexpr int BINS = 12;
+	auto getBin = [&](int32_t leaf)
+	{
+		int bin = (int)((m_Nodes[leaf].Bounds.GetCenter()[axis] - axisMin) / axisSize * BINS);
+		return std::min(bin, BINS - 1);
+	};
+
+	int bestSplit = -1;
+	if (axisSize > 0.0f)
+	{
+		std::array<AABB, BINS> binBounds;
+		std::array<uint32_t, BINS> binCounts = {};
+		for (size_t i = begin; i < end; i++)
+		{
+			int bin = getBin(leaves[i]);
+			binBounds[bin].Expand(m_Nodes[leaves[i]].Bounds);
+			binCounts[bin]++;
+		}
+
+		std::array<float, BINS - 1> leftCosts;
+		AABB accumulated;
+		uint32_t count = 0;
+		for (int i = 0; i < BINS - 1; i++)
+		{
+			accumulated.Expand(binBounds[i]);
+			count += binCounts[i];
+			leftCosts[i] = count ? count * accumulated.GetSurfaceArea() : 0.0f;
+		}
+
+		float bestCost = std::numeric_limits<float>::max();
+		accumulated = AABB();
+		count = 0;
+		for (int i = BINS - 1; i > 0; i--)
+		{
+			accumulated.Expand(binBounds[i]);
+			count += binCounts[i];
+
+			uint32_t leftCount = (end - begin) - count;
+			if (count == 0 || leftCount == 0)
+				continue;
+
+			float cost = leftCosts[i - 1] + count * accumulated.GetSurfaceArea();
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestSplit = i - 1;
+			}
+		}
+	}
+
+	size_t middle;
+	if (bestSplit >= 0)
+	{
+		middle = std::partition(leaves.begin() + begin, leaves.begin() + end,
+			[&](int32_t leaf) { return getBin(leaf) <= bestSplit; }) - leaves.begin();
+	}
+	else
+	{
+		// All centroids in one spot, any balanced split is as good as another
+		middle = (begin + end) / 2;
+	}
+
+	int32_t node = AllocateNode();
+	int32_t left = Build(leaves, begin, middle);
+	int32_t right = Build(leaves, middle, end);
+
+	m_Nodes[node].Bounds = bounds;
+	m_Nodes[node].Left = left;
+	m_Nodes[node].Right = right;
+	m_Nodes[left].Parent = node;
+	m_Nodes[right].Parent = node;
+	m_Cost += bounds.GetSurfaceArea();
+
+	return node;
+}
+
+float BVH::GetNormalizedCost() const
+{
+	if (m_Root < 0)
+		return 0.0f;
+
+	float rootArea = m_Nodes[m_Root].Bounds.GetSurfaceArea();
+	return rootArea > 0.0f ? m_Cost / rootArea : m_Cost;
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Math/Bounds.h"
+#include "Core/Span.h"
+#include "Core/Memory/FrameMemory.h"
+
+struct BVHNode
+{
+	AABB Bounds;
+	int32_t Parent = -1;
+	int32_t Left = -1;
+	int32_t Right = -1;
+	// Leaves only
+	void* UserData = nullptr;
+
+	inline bool IsLeaf() const { return Left < 0; }
+};
+
+struct RaycastHit
+{
+	void* UserData = nullptr;
+	float Distance = -1.0f;
+};
+
+// Dynamic bounding volume hierarchy. Proxies are leaves and keep their index for their whole life.
+// Moved proxies only refit their ancestors; once that made the tree noticeably worse than after
+// the last build it should be rebuilt top-down with the surface area heuristic.
+class BVH
+{
+public:
+	// Rebuild once the summed surface area of internal nodes grows this much relative to the last build
+	static constexpr float REBUILD_THRESHOLD = 1.5f;
+
+private:
+	std::vector<BVHNode> m_Nodes;
+	int32_t m_Root = -1;
+	// Free nodes are linked through their Parent index
+	int32_t m_FreeNodes = -1;
+	uint32_t m_LeavesCount = 0;
+
+	// Summed surface area of internal nodes, kept up to date on every change
+	float m_Cost = 0.0f;
+	float m_BuildCost = 0.0f;
+
+public:
+	int32_t CreateProxy(const AABB& bounds, void* userData);
+	void DestroyProxy(int32_t proxy);
+	void UpdateProxy(int32_t proxy, const AABB& bounds);
+
+	void Rebuild();
+	bool NeedsRebuild() const;
+	void Clear();
+
+	// Callbacks get the user data of every proxy overlapping the shape
+	template<typename F>
+	void Query(const Frustum& frustum, F&& callback) const
+	{
+		Traverse([&](const AABB& bounds) { return frustum.Intersects(bounds); }, callback);
+	}
+
+	template<typename F>
+	void Query(const AABB& aabb, F&& callback) const
+	{
+		Traverse([&](const AABB& bounds) { return aabb.Intersects(bounds); }, callback);
+	}
+
+	template<typename F>
+	void Query(const BoundingSphere& sphere, F&& callback) const
+	{
+		Traverse([&](const AABB& bounds) { return sphere.Intersects(bounds); }, callback);
+	}
+
+	// Callback gets the user data and entry distance of every hit proxy and returns the new max distance,
+	// returning the given distance keeps only closer proxies, returning maxDistance visits all of them
+	template<typename F>
+	void Raycast(const Ray& ray, float maxDistance, F&& callback) const
+	{
+		Traverse([&](const AABB& bounds) { return ray.Intersect(bounds, maxDistance) >= 0.0f; },
+			[&](void* userData, const AABB& bounds) { maxDistance = callback(userData, ray.Intersect(bounds, maxDistance)); });
+	}
+
+	// Batched queries run on the job system, one result list per shape
+	void QueryBatch(Span<const Frustum> frustums, std::vector<std::vector<void*>>& results) const;
+	void QueryBatch(Span<const AABB> aabbs, std::vector<std::vector<void*>>& results) const;
+	void QueryBatch(Span<const BoundingSphere> spheres, std::vector<std::vector<void*>>& results) const;
+	// Closest proxy hit by every ray
+	void RaycastBatch(Span<const Ray> rays, float maxDistance, std::vector<RaycastHit>& hits) const;
+
+	inline const AABB& GetBounds(int32_t proxy) const { return m_Nodes[proxy].Bounds; }
+	inline void* GetUserData(int32_t proxy) const { return m_Nodes[proxy].UserData; }
+	inline const std::vector<BVHNode>& GetNodes() const { return m_Nodes; }
+	inline int32_t GetRoot() const { return m_Root; }
+	inline uint32_t GetLeavesCount() const { return m_LeavesCount; }
+	uint32_t GetHeight() const;
+
+private:
+	template<typename Test, typename F>
+	void Traverse(Test&& overlaps, F&& callback) const
+	{
+		if (m_Root < 0)
+			return;
+
+		FrameVector<int32_t> stack;
+		stack.reserve(64);
+		stack.push_back(m_Root);
+
+		while (!stack.empty())
+		{
+			const BVHNode& node = m_Nodes[stack.back()];
+			stack.pop_back();
+
+			if (!overlaps(node.Bounds))
+				continue;
+
+			if (node.IsLeaf())
+			{
+				if constexpr (std::is_invocable_v<F, void*, const AABB&>)
+					callback(node.UserData, node.Bounds);
+				else
+					callback(node.UserData);
+			}
+			else
+			{
+				stack.push_back(node.Left);
+				stack.push_back(node.Right);
+			}
+		}
+	}
+
+	template<typename Shape>
+	void QueryBatchImpl(Span<const Shape> shapes, std::vector<std::vector<void*>>& results) const;
+
+	int32_t AllocateNode();
+	void FreeNode(int32_t index);
+	void SetBounds(int32_t index, const AABB& bounds);
+	void InsertLeaf(int32_t leaf);
+	void RemoveLeaf(int32_t leaf);
+	void RefitAncestors(int32_t index);
+	int32_t Build(std::vector<int32_t>& leaves, size_t begin, size_t end);
+	float GetNormalizedCost() const;
+};
\ No newline at end of file
@@ -30,8 +30,8 @@ void Camera::BeginPlay()
 
 void Camera::Tick(float deltaTime)
 {
-	auto players = m_Scene->GetEntitiesWithComponent<PlayerComponent>();
-	if (players.size() > 0)
+	const auto& players = m_Scene->GetComponentOwners<PlayerComponent>();
+	if (!players.empty())
 	{
 		glm::vec3 targetPosition = players[0]->GetWorldPosition();
 
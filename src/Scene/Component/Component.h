@@ -4,6 +4,7 @@
 #include <glm/glm.hpp>
 
 #include "typedefs.h"
+#include "ComponentType.h"
 
 class Entity;
 
@@ -16,6 +17,14 @@ public:
 	virtual void Update() = 0;
 	virtual void Destroy() = 0;
 
+	// Whether the component was registered as this type or one of its bases
+	inline bool IsOfType(ComponentTypeID type) const { return m_TypeMask.test(type); }
+
 protected:
 	Entity* m_Owner;
+
+private:
+	ComponentMask m_TypeMask;
+
+	friend class Entity;
 };
\ No newline at end of file
@@ -0,0 +1,3 @@
+#include "ComponentType.h"
+
+std::atomic<ComponentTypeID> ComponentType::s_NextID = 0;
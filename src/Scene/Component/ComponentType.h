@@ -0,0 +1,35 @@
+#pragma once
+
+#include <atomic>
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+
+#define MAX_COMPONENT_TYPES 32
+
+using ComponentTypeID = uint32_t;
+using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+// Components which should also be found through a base class (e.g. GetComponent<Light>())
+// specialize this with the base type in their header.
+template<typename T>
+struct ComponentBase
+{
+	using Type = void;
+};
+
+class ComponentType
+{
+public:
+	template<typename T>
+	static ComponentTypeID Get()
+	{
+		// Types can be registered for the first time from several threads at once
+		static const ComponentTypeID id = s_NextID.fetch_add(1, std::memory_order_relaxed);
+		assert(id < MAX_COMPONENT_TYPES && "Raise MAX_COMPONENT_TYPES, masks and pools are sized by it");
+		return id;
+	}
+
+private:
+	static std::atomic<ComponentTypeID> s_NextID;
+};
@@ -5,12 +5,12 @@
 
 #include "Scene/Entity.h"
 #include "Scene/Scene.h"
-#include "Light/PointLight.h"
-#include "Light/SpotLight.h"
-#include "Light/SkyLight.h"
+#include "Renderer/RenderCommandBuffer.h"
 
+#include <algorithm>
+#include <random>
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include "Renderer/Device/RenderDevice.h"
 
 InstanceRenderedMeshComponent::InstanceRenderedMeshComponent(Entity* owner)
 	: InstanceRenderedMeshComponent(owner, "../../res/models/defaults/default_cube.obj")
@@ -34,11 +34,11 @@ InstanceRenderedMeshComponent::InstanceRenderedMeshComponent(Entity* owner, std:
 }
 
 InstanceRenderedMeshComponent::InstanceRenderedMeshComponent(Entity* owner, std::string path, std::vector<std::string> materialsPaths)
-	: RenderComponent(owner), m_Path(path), m_MaterialsPaths(materialsPaths)
+	: RenderComponent(owner), m_Path(path), m_MaterialsPaths(std::move(materialsPaths))
 {
 	LoadMesh(path);
 
-	for (auto path : m_MaterialsPaths)
+	for (auto& path : m_MaterialsPaths)
 		m_Materials.push_back(MaterialImporter::GetInstance()->ImportMaterial(path));
 
 	m_Radius = 1.0f;
@@ -63,132 +63,65 @@ void InstanceRenderedMeshComponent::PreRender()
 {
 }
 
-void InstanceRenderedMeshComponent::Render()
+void InstanceRenderedMeshComponent::EmitCommands(RenderCommandBuffer& commands)
 {
-	uint32_t irradianceMap;
-	uint32_t prefilterMap;
-	uint32_t BRDFLUT;
-	float intensity;
-	bool isSkyLight = false;
-
-	auto components = m_Owner->GetScene()->GetComponents<SkyLight>();
-	if (components.size() > 0)
-	{
-		if (auto skyLight = Cast<SkyLight>(components[0]))
-		{
-			isSkyLight = true;
-			intensity = skyLight->GetIntensity();
-
-			irradianceMap = skyLight->GetIrradianceMap();
-			prefilterMap = skyLight->GetPrefilterMap();
-			BRDFLUT = skyLight->GetBRDFLUT();
-		}
-
-	}
+	if (m_Materials.empty())
+		return;
 
-	for (auto material : GetMaterials())
+	glm::vec3 center = m_InstancesBounds.GetCenter();
+	for (size_t i = 0; i < m_Meshes.size(); i++)
 	{
-		material->Use();
-
-		material->GetShader()->SetBool("u_IsSkyLight", isSkyLight);
-
-		if (isSkyLight)
-		{
-			material->GetShader()->SetFloat("u_SkyLightIntensity", intensity);
-
-			glActiveTexture(GL_TEXTURE0 + 20);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, irradianceMap);
-			material->GetShader()->SetInt("u_IrradianceMap", 20);
-			glActiveTexture(GL_TEXTURE0 + 21);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, prefilterMap);
-			material->GetShader()->SetInt("u_PrefilterMap", 21);
-			glActiveTexture(GL_TEXTURE0 + 22);
-			glBindTexture(GL_TEXTURE_2D, BRDFLUT);
-			material->GetShader()->SetInt("u_BRDFLUT", 22);
-		}
-		else
-		{
-			glActiveTexture(GL_TEXTURE0 + 20);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, Renderer::GetInstance()->GetPointLightShadowMapPlaceholder(0));
-			material->GetShader()->SetInt("u_IrradianceMap", 20);
-			glActiveTexture(GL_TEXTURE0 + 21);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, Renderer::GetInstance()->GetPointLightShadowMapPlaceholder(0));
-			material->GetShader()->SetInt("u_PrefilterMap", 21);
-			glActiveTexture(GL_TEXTURE0 + 22);
-			glBindTexture(GL_TEXTURE_2D, Renderer::GetInstance()->GetSpotLightShadowMapPlaceholder(0));
-			material->GetShader()->SetInt("u_BRDFLUT", 22);
-		}
-
-		auto pointLights = m_Owner->GetScene()->GetComponents<PointLight>();
-		for (int i = 0; i < MAX_POINT_LIGHTS; i++)
-		{
-			if (i < pointLights.size())
-			{
-				auto shadowMap = Cast<PointLight>(pointLights[i])->GetShadowMap();
-
-				glActiveTexture(GL_TEXTURE0 + 24 + i);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, shadowMap);
-				material->GetShader()->SetInt("u_PointLightShadowMaps[" + std::to_string(i) + "]", 24 + i);
-			}
-			else
-			{
-				glActiveTexture(GL_TEXTURE0 + 24 + i);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, Renderer::GetInstance()->GetPointLightShadowMapPlaceholder(i));
-				material->GetShader()->SetInt("u_PointLightShadowMaps[" + std::to_string(i) + "]", 24 + i);
-			}
-		}
-
-		auto spotLights = m_Owner->GetScene()->GetComponents<SpotLight>();
-		for (int i = 0; i < MAX_SPOT_LIGHTS; i++)
-		{
-			if (i < spotLights.size())
-			{
-				auto shadowMap = Cast<SpotLight>(spotLights[i])->GetShadowMap();
-
-				glActiveTexture(GL_TEXTURE0 + 24 + MAX_POINT_LIGHTS + i);
-				glBindTexture(GL_TEXTURE_2D, shadowMap);
-				material->GetShader()->SetInt("u_SpotLightShadowMaps[" + std::to_string(i) + "]", 24 + MAX_POINT_LIGHTS + i);
-			}
-			else
-			{
-				glActiveTexture(GL_TEXTURE0 + 24 + MAX_POINT_LIGHTS + i);
-				glBindTexture(GL_TEXTURE_2D, Renderer::GetInstance()->GetSpotLightShadowMapPlaceholder(i));
-				material->GetShader()->SetInt("u_SpotLightShadowMaps[" + std::to_string(i) + "]", 24 + MAX_POINT_LIGHTS + i);
-			}
-		}
-
-		material->GetShader()->SetMat4("u_Model", m_Owner->GetTransform().ModelMatrix);
+		// Meshes without their own material keep using the last one
+		Material* material = m_MultipleMaterials ? m_Materials[std::min(i, m_Materials.size() - 1)].get() : m_Materials[0].get();
+		if (!material)
+			continue;
+
+		RenderCommand command;
+		command.SourceMesh = &m_Meshes[i];
+		command.SourceMaterial = material;
+		command.ModelMatrix = &m_Owner->GetTransform().ModelMatrix;
+		command.VertexArray = m_VertexArray;
+		command.InstancesCount = m_InstancesCount;
+		commands.Add(RenderPass::OPAQUE, command, center);
 	}
-	if (!m_MultipleMaterials && m_Materials.at(0))
-	{
-		m_Materials.at(0)->Use();
+}
 
-		for (auto mesh : m_Meshes)
-		{
-			mesh.RenderInstanced(m_InstancesCount);
-		}
+void InstanceRenderedMeshComponent::Render()
+{
+}
 
-		return;
-	}
+void InstanceRenderedMeshComponent::Destroy()
+{
+	if (m_CastShadows)
+		m_Owner->GetScene()->InvalidateShadows(m_InstancesBounds, m_Owner->GetMobility());
 
-	for (int i = 0; i < m_Meshes.size(); i++)
-	{
-		if (m_Materials.size() > i)
-			m_Materials.at(i)->Use();
+	MeshImporter::GetInstance()->ReleaseMesh(m_Path);
+	m_Meshes.clear();
 
-		m_Meshes.at(i).RenderInstanced(m_InstancesCount);
+	if (m_ModelMatricesBuffer)
+		RenderDevice::Get().DeleteBuffers(1, &m_ModelMatricesBuffer);
+
+	if (m_VertexArray)
+	{
+		GeometryArena::GetInstance()->DetachVertexArray(m_VertexArray);
+		RenderDevice::Get().DeleteVertexArrays(1, &m_VertexArray);
 	}
 
+	m_ModelMatricesBuffer = 0;
+	m_VertexArray = 0;
 }
 
-void InstanceRenderedMeshComponent::Destroy()
+void InstanceRenderedMeshComponent::SetCastShadows(bool castShadows)
 {
+	m_CastShadows = castShadows;
+
+	m_Owner->GetScene()->InvalidateShadows(m_InstancesBounds, m_Owner->GetMobility());
 }
 
 uint32_t InstanceRenderedMeshComponent::GetRenderedVerticesCount()
 {
 	uint32_t vertices = 0;
-	for (auto mesh : m_Meshes)
+	for (auto& mesh : m_Meshes)
 	{
 		vertices += mesh.vertices.size();
 	}
@@ -210,6 +143,7 @@ void InstanceRenderedMeshComponent::LoadMaterial(std::string path)
 
 void InstanceRenderedMeshComponent::ChangeMesh(std::string path)
 {
+	MeshImporter::GetInstance()->ReleaseMesh(m_Path);
 	LoadMesh(path);
 
 	m_Materials.clear();
@@ -231,18 +165,19 @@ void InstanceRenderedMeshComponent::Generate()
 
 	glm::vec3 center = m_Owner->GetWorldPosition();
 
-	srand(glfwGetTime());
+	// The distributions of <random> differ between standard libraries, the raw engine output does not
+	std::mt19937 rng(m_Seed);
+	auto random = [&rng]() { return (rng() >> 8) * (1.0f / 16777216.0f); };
+
 	for (uint32_t i = 0; i < m_InstancesCount; i++)
 	{
-		glm::mat4 model = glm::mat4(1.0f);
-
-		float theta = 2 * glm::pi<float>() * ((float)rand() / RAND_MAX);
-		float distance = sqrt((float)rand() / RAND_MAX) * m_Radius;
+		float theta = 2 * glm::pi<float>() * random();
+		float distance = sqrt(random()) * m_Radius;
 		float x = center.x + distance * cos(theta);
 		float z = center.z + distance * sin(theta);
 
-		float scale = (rand() % (int)(m_MaxMeshScale * 100)) / 100.0f + m_MinMeshScale;
-		float rotationY = (rand() % 360);
+		float scale = (rng() % (uint32_t)(m_MaxMeshScale * 100)) / 100.0f + m_MinMeshScale;
+		float rotationY = (float)(rng() % 360);
 
 		Transform t = Transform(m_Owner);
 		t.LocalPosition = glm::vec3(x, center.y, z);
@@ -253,34 +188,53 @@ void InstanceRenderedMeshComponent::Generate()
 		m_ModelMatrices.push_back(t.ModelMatrix);
 	}
 
+	AABB meshBounds;
+	for (auto& mesh : m_Meshes)
+		meshBounds.Expand(mesh.GetBounds());
+
+	AABB previousBounds = m_InstancesBounds;
+	m_InstancesBounds = AABB();
+	for (auto& model : m_ModelMatrices)
+		m_InstancesBounds.Expand(meshBounds.Transformed(model));
+
+	if (m_CastShadows)
+	{
+		m_Owner->GetScene()->InvalidateShadows(previousBounds, m_Owner->GetMobility());
+		m_Owner->GetScene()->InvalidateShadows(m_InstancesBounds, m_Owner->GetMobility());
+	}
+
 	if (m_ModelMatricesBuffer)
-		glDeleteBuffers(1, &m_ModelMatricesBuffer);
+		RenderDevice::Get().DeleteBuffers(1, &m_ModelMatricesBuffer);
 
-	glGenBuffers(1, &m_ModelMatricesBuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, m_ModelMatricesBuffer);
-	glBufferData(GL_ARRAY_BUFFER, m_ModelMatrices.size() * sizeof(glm::mat4), &m_ModelMatrices[0], GL_STATIC_DRAW);
+	RenderDevice::Get().GenBuffers(1, &m_ModelMatricesBuffer);
+	RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, m_ModelMatricesBuffer);
+	RenderDevice::Get().BufferData(GL_ARRAY_BUFFER, m_ModelMatrices.size() * sizeof(glm::mat4), &m_ModelMatrices[0], GL_STATIC_DRAW);
 
-	for (int i = 0; i < m_Meshes.size(); i++)
+	if (!m_VertexArray)
 	{
-		glBindVertexArray(m_Meshes[i].GetVAO());
+		RenderDevice::Get().GenVertexArrays(1, &m_VertexArray);
+		GeometryArena::GetInstance()->AttachVertexArray(m_VertexArray);
+	}
 
-		glEnableVertexAttribArray(4);
-		glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)0);
+	// Every mesh shares the vertex array, they only differ by where they start in the arena
+	RenderDevice::Get().BindVertexArray(m_VertexArray);
 
-		glEnableVertexAttribArray(5);
-		glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4)));
+	RenderDevice::Get().EnableVertexAttribArray(4);
+	RenderDevice::Get().VertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)0);
 
-		glEnableVertexAttribArray(6);
-		glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(2 * sizeof(glm::vec4)));
+	RenderDevice::Get().EnableVertexAttribArray(5);
+	RenderDevice::Get().VertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4)));
 
-		glEnableVertexAttribArray(7);
-		glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(3 * sizeof(glm::vec4)));
+	RenderDevice::Get().EnableVertexAttribArray(6);
+	RenderDevice::Get().VertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(2 * sizeof(glm::vec4)));
 
-		glVertexAttribDivisor(4, 1);
-		glVertexAttribDivisor(5, 1);
-		glVertexAttribDivisor(6, 1);
-		glVertexAttribDivisor(7, 1);
+	RenderDevice::Get().EnableVertexAttribArray(7);
+	RenderDevice::Get().VertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(3 * sizeof(glm::vec4)));
 
-		glBindVertexArray(0);
-	}
+	RenderDevice::Get().VertexAttribDivisor(4, 1);
+	RenderDevice::Get().VertexAttribDivisor(5, 1);
+	RenderDevice::Get().VertexAttribDivisor(6, 1);
+	RenderDevice::Get().VertexAttribDivisor(7, 1);
+
+	RenderDevice::Get().BindVertexArray(0);
 }
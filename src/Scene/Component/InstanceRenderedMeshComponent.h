@@ -18,15 +18,22 @@ private:
 	std::vector<std::string> m_MaterialsPaths;
 
 	bool m_MultipleMaterials;
+	bool m_CastShadows = true;
 
 	int32_t m_InstancesCount;
 	float m_Radius;
 	float m_MinMeshScale;
 	float m_MaxMeshScale;
+	// Generate places the instances from this seed so a scene looks the same every time it is loaded
+	uint32_t m_Seed = 0;
 
 	std::vector<glm::mat4> m_ModelMatrices;
+	// World space, instances are placed in world space by Generate
+	AABB m_InstancesBounds;
 
-	uint32_t m_ModelMatricesBuffer;
+	uint32_t m_ModelMatricesBuffer = 0;
+	// Reads the meshes from the geometry arena and the model matrices per instance
+	uint32_t m_VertexArray = 0;
 
 public:
 	InstanceRenderedMeshComponent(Entity* owner);
@@ -43,26 +50,33 @@ public:
 	virtual void Begin() override;
 	virtual void Update() override;
 	virtual void PreRender() override;
+	virtual void EmitCommands(RenderCommandBuffer& commands) override;
 	virtual void Render() override;
 	virtual void Destroy() override;
 
-	inline std::string GetPath() const { return m_Path; }
-	inline std::vector<Mesh> GetMeshes() const { return m_Meshes; }
-	inline std::vector<Ref<Material>> GetMaterials() const { return m_Materials; }
-	inline std::vector<std::string> GetMaterialsPaths() const { return m_MaterialsPaths; }
+	inline const std::string& GetPath() const { return m_Path; }
+	inline const std::vector<Mesh>& GetMeshes() const { return m_Meshes; }
+	inline const std::vector<Ref<Material>>& GetMaterials() const { return m_Materials; }
+	inline const std::vector<std::string>& GetMaterialsPaths() const { return m_MaterialsPaths; }
 	inline int32_t GetInstancesCount() const { return m_InstancesCount; }
 	inline float GetRadius() const { return m_Radius; }
 	inline float GetMinMeshScale() const { return m_MinMeshScale; }
 	inline float GetMaxMeshScale() const { return m_MaxMeshScale; }
-	inline std::vector<glm::mat4> GetModelMatrices() const { return m_ModelMatrices; }
+	inline uint32_t GetSeed() const { return m_Seed; }
+	inline const std::vector<glm::mat4>& GetModelMatrices() const { return m_ModelMatrices; }
 	inline uint32_t GetModelMatricesBuffer() const { return m_ModelMatricesBuffer; }
+	inline uint32_t GetVertexArray() const { return m_VertexArray; }
+	inline const AABB& GetInstancesBounds() const { return m_InstancesBounds; }
+	inline bool CastsShadows() const { return m_CastShadows; }
 	uint32_t GetRenderedVerticesCount();
 
-	inline void SetMaterial(int index, Ref<Material> material) { m_Materials.at(index) = material; }
+	inline void SetMaterial(int index, Ref<Material> material) { m_Materials.at(index) = std::move(material); }
+	void SetCastShadows(bool castShadows);
 	inline void SetInstancesCount(int32_t count) { m_InstancesCount = count; }
 	inline void SetRadius(float radius) { m_Radius = radius; }
 	inline void SetMinMeshScale(float minMeshScale) { m_MinMeshScale = minMeshScale; }
 	inline void SetMaxMeshScale(float maxMeshScale) { m_MaxMeshScale = maxMeshScale; }
+	inline void SetSeed(uint32_t seed) { m_Seed = seed; }
 
 	friend class EntityDetailsPanel;
 	friend class SceneSerializer;
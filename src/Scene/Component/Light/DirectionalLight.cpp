@@ -47,7 +47,7 @@ void DirectionalLight::SwitchOff()
 	m_FragmentUniformBuffer->Unbind();
 }
 
-void DirectionalLight::RenderShadowMap()
+void DirectionalLight::RenderShadowMap(bool updateStaticLayer)
 {
-	Renderer::GetInstance()->RenderShadowMap(m_Owner->GetScene(), this);
+	Renderer::GetInstance()->RenderShadowMap(m_Owner->GetScene(), this, updateStaticLayer);
 }
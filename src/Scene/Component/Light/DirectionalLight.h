@@ -11,7 +11,13 @@ public:
 	virtual void Use() override;
 	virtual void SwitchOff() override;
 	
-	virtual void RenderShadowMap() override;
+	virtual void RenderShadowMap(bool updateStaticLayer) override;
 
 	friend class EntityDetailsPanel;
 };
+
+template<>
+struct ComponentBase<DirectionalLight>
+{
+	using Type = Light;
+};
\ No newline at end of file
@@ -7,8 +7,6 @@ Light::Light(Entity* owner, Ref<UniformBuffer> vertexUniformBuffer, Ref<UniformB
 {
 	m_Color = glm::vec3(1.0f);
 	m_ShadowsEnabled = true;
-
-	owner->GetScene()->SetChangedSinceLastFrame(true);
 }
 
 void Light::Begin()
@@ -22,13 +20,27 @@ void Light::Update()
 
 void Light::PreRender()
 {
-	if (m_Owner->GetScene()->IsChangedSinceLastFrame())
+	glm::vec3 position = m_Owner->GetWorldPosition();
+	glm::vec3 rotation = m_Owner->GetWorldRotation();
+
+	bool changed = m_Dirty || position != m_LastPosition || rotation != m_LastRotation;
+	if (changed)
 	{
 		Use();
 
-		if (m_ShadowsEnabled)
-			RenderShadowMap();
+		m_LastPosition = position;
+		m_LastRotation = rotation;
+		m_Dirty = false;
 	}
+
+	if (!m_ShadowsEnabled)
+		return;
+
+	bool staticLayerInvalidated = changed || IsShadowMapInvalidated(Mobility::STATIC);
+	if (staticLayerInvalidated || IsShadowMapInvalidated(Mobility::MOVABLE))
+		RenderShadowMap(staticLayerInvalidated);
+	else
+		Renderer::GetInstance()->CountReusedShadowMap();
 }
 
 void Light::Render()
@@ -40,9 +52,30 @@ void Light::Destroy()
 	SwitchOff();
 }
 
+bool Light::IsInShadowVolume(const AABB& bounds) const
+{
+	return Frustum::FromMatrix(m_LightSpace).Intersects(bounds);
+}
+
 void Light::SetColor(glm::vec3 color)
 {
 	m_Color = color;
+	m_Dirty = true;
+}
+
+void Light::SetShadowsEnabled(bool enabled)
+{
+	m_ShadowsEnabled = enabled;
+	m_Dirty = true;
+}
+
+bool Light::IsShadowMapInvalidated(Mobility mobility) const
+{
+	for (auto& bounds : m_Owner->GetScene()->GetShadowInvalidations(mobility))
+	{
+		if (IsInShadowVolume(bounds))
+			return true;
+	}
 
-	m_Owner->GetScene()->SetChangedSinceLastFrame(true);
+	return false;
 }
@@ -8,6 +8,7 @@
 #include "Renderer/Shader.h"
 #include "Scene/Camera.h"
 #include "Renderer/UniformBuffer.h"
+#include "Math/Bounds.h"
 
 #define MAX_POINT_LIGHTS 16
 #define MAX_SPOT_LIGHTS 16
@@ -40,13 +41,19 @@ public:
 	virtual void Use() = 0;
 	virtual void SwitchOff() = 0;
 
-	virtual void RenderShadowMap() = 0;
+	// Static casters are kept in a cached layer, only redrawn when asked to, movable casters are drawn over a copy of it
+	virtual void RenderShadowMap(bool updateStaticLayer) = 0;
+	// Whether a caster with these world bounds can appear in the shadow map
+	virtual bool IsInShadowVolume(const AABB& bounds) const;
 
 	inline Entity* GetOwner() const { return m_Owner; }
 	inline glm::vec3 GetColor() const { return m_Color; }
-	inline glm::mat4 GetLightSpace() const { return m_LightSpace; }
+	inline const glm::mat4& GetLightSpace() const { return m_LightSpace; }
+	inline bool AreShadowsEnabled() const { return m_ShadowsEnabled; }
 
 	void SetColor(glm::vec3 color);
+	void SetShadowsEnabled(bool enabled);
+	inline void MarkDirty() { m_Dirty = true; }
 
 	friend class EntityDetailsPanel;
 
@@ -59,4 +66,12 @@ protected:
 	bool m_ShadowsEnabled;
 	glm::mat4 m_LightSpace;
 	uint32_t m_ShadowMap;
+
+	// Set when the light's own parameters change, its uniforms and shadow map are refreshed at the next PreRender
+	bool m_Dirty = true;
+	glm::vec3 m_LastPosition = glm::vec3(0.0f);
+	glm::vec3 m_LastRotation = glm::vec3(0.0f);
+
+private:
+	bool IsShadowMapInvalidated(Mobility mobility) const;
 };
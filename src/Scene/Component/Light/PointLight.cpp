@@ -4,6 +4,7 @@
 
 #include "Scene/Scene.h"
 #include "Renderer/UniformBuffer.h"
+#include "Renderer/Device/RenderDevice.h"
 
 PointLight::PointLight(Entity* owner, Ref<UniformBuffer> vertexUniformBuffer, Ref<UniformBuffer> fragmentUniformBuffer)
 	: Light(owner, vertexUniformBuffer, fragmentUniformBuffer)
@@ -15,19 +16,22 @@ PointLight::PointLight(Entity* owner, Ref<UniformBuffer> vertexUniformBuffer, Re
 
 	m_FarPlane = 250.0f;
 
-	const uint32_t shadowWidth = 1024, shadowHeight = 1024;
+	m_ShadowMapSize = 1024;
 
-	glGenTextures(1, &m_ShadowMap);
-	glBindTexture(GL_TEXTURE_CUBE_MAP, m_ShadowMap);
+	for (uint32_t* shadowMap : { &m_ShadowMap, &m_StaticShadowMap })
+	{
+		RenderDevice::Get().GenTextures(1, shadowMap);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, *shadowMap);
 
-	for (int i = 0; i < 6; i++)
-		glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+		for (int i = 0; i < 6; i++)
+			RenderDevice::Get().TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, m_ShadowMapSize, m_ShadowMapSize, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
 
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+	}
 
 }
 
@@ -64,7 +68,27 @@ void PointLight::SwitchOff()
 	m_FragmentUniformBuffer->Unbind();
 }
 
-void PointLight::RenderShadowMap()
+void PointLight::Destroy()
+{
+	Light::Destroy();
+
+	RenderDevice::Get().DeleteTextures(1, &m_ShadowMap);
+	RenderDevice::Get().DeleteTextures(1, &m_StaticShadowMap);
+	m_ShadowMap = 0;
+	m_StaticShadowMap = 0;
+}
+
+void PointLight::RenderShadowMap(bool updateStaticLayer)
 {
-	Renderer::GetInstance()->RenderShadowMap(m_Owner->GetScene(), this);
+	Renderer::GetInstance()->RenderShadowMap(m_Owner->GetScene(), this, updateStaticLayer);
+}
+
+bool PointLight::IsInShadowVolume(const AABB& bounds) const
+{
+	// The cube map covers every direction up to the far plane
+	BoundingSphere range;
+	range.Center = m_Owner->GetWorldPosition();
+	range.Radius = m_FarPlane;
+
+	return range.Intersects(bounds);
 }
@@ -8,6 +8,9 @@ private:
 	int m_Index;
 
 	uint32_t m_ShadowMap;
+	// Depth of the static casters only, copied into the shadow map before movable casters are drawn
+	uint32_t m_StaticShadowMap;
+	uint32_t m_ShadowMapSize;
 	std::vector<glm::mat4> m_LightViews;
 	float m_FarPlane;
 
@@ -17,14 +20,25 @@ public:
 
 	virtual void Use() override;
 	virtual void SwitchOff() override;
+	virtual void Destroy() override;
 
-	virtual void RenderShadowMap() override;
+	virtual void RenderShadowMap(bool updateStaticLayer) override;
+	virtual bool IsInShadowVolume(const AABB& bounds) const override;
 
-	inline void SetIndex(int index) { m_Index = index; }
+	inline void SetIndex(int index) { m_Dirty |= m_Index != index; m_Index = index; }
 
+	inline int GetIndex() const { return m_Index; }
 	inline uint32_t GetShadowMap() const { return m_ShadowMap; }
-	inline std::vector<glm::mat4> GetLightViews() const { return m_LightViews; }
+	inline uint32_t GetStaticShadowMap() const { return m_StaticShadowMap; }
+	inline uint32_t GetShadowMapSize() const { return m_ShadowMapSize; }
+	inline const std::vector<glm::mat4>& GetLightViews() const { return m_LightViews; }
 	inline float GetFarPlane() const { return m_FarPlane; }
 
 	friend class EntityDetailsPanel;
 };
+
+template<>
+struct ComponentBase<PointLight>
+{
+	using Type = Light;
+};
\ No newline at end of file
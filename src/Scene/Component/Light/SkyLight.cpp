@@ -1,6 +1,7 @@
 #include "SkyLight.h"
 
 #include <glad/glad.h>
+#include "Renderer/Device/RenderDevice.h"
 #include <stb_image.h>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -18,16 +19,16 @@ SkyLight::SkyLight(Entity* owner, std::string path)
     m_SkyVisibility = true;
     m_Intensity = 1.0f;
 
-    glGenFramebuffers(1, &m_CaptureFBO);
-    glGenRenderbuffers(1, &m_CaptureRBO);
+    RenderDevice::Get().GenFramebuffers(1, &m_CaptureFBO);
+    RenderDevice::Get().GenRenderbuffers(1, &m_CaptureRBO);
 
     Load(m_Path);
 }
 
 SkyLight::~SkyLight()
 {
-    glDeleteFramebuffers(1, &m_CaptureFBO);
-    glDeleteRenderbuffers(1, &m_CaptureRBO);
+    RenderDevice::Get().DeleteFramebuffers(1, &m_CaptureFBO);
+    RenderDevice::Get().DeleteRenderbuffers(1, &m_CaptureRBO);
 }
 
 void SkyLight::Begin()
@@ -88,74 +89,86 @@ void SkyLight::SetupMesh()
          1.0f, -1.0f,  1.0f
     };
 
-    glGenVertexArrays(1, &m_VAO);
-    glGenBuffers(1, &m_VBO);
+    RenderDevice::Get().GenVertexArrays(1, &m_VAO);
+    RenderDevice::Get().GenBuffers(1, &m_VBO);
 
-    glBindVertexArray(m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    RenderDevice::Get().BindVertexArray(m_VAO);
+    RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
 
-    glBufferData(GL_ARRAY_BUFFER, sizeof(skyboxVertices), &skyboxVertices, GL_STATIC_DRAW);
+    RenderDevice::Get().BufferData(GL_ARRAY_BUFFER, sizeof(skyboxVertices), &skyboxVertices, GL_STATIC_DRAW);
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    RenderDevice::Get().EnableVertexAttribArray(0);
+    RenderDevice::Get().VertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    RenderDevice::Get().BindBuffer(GL_ARRAY_BUFFER, 0);
+    RenderDevice::Get().BindVertexArray(0);
 }
 
 void SkyLight::Render()
 {
     if (m_SkyVisibility)
     {
-        glDepthFunc(GL_LEQUAL);
+        RenderDevice::Get().DepthFunc(GL_LEQUAL);
 
         m_Shader->Use();
 
-        glBindVertexArray(m_VAO);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
+        RenderDevice::Get().BindVertexArray(m_VAO);
+        RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+        RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
 
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-        glBindVertexArray(0);
+        RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 36);
+        RenderDevice::Get().BindVertexArray(0);
 
-        glDepthFunc(GL_LESS);
+        RenderDevice::Get().DepthFunc(GL_LESS);
     }
 }
 
 void SkyLight::Destroy()
 {
+    if (m_ID)
+    {
+        RenderDevice::Get().DeleteTextures(1, &m_ID);
+        RenderDevice::Get().DeleteTextures(1, &m_PrefilterMap);
+        RenderDevice::Get().DeleteTextures(1, &m_IrradianceMap);
+        RenderDevice::Get().DeleteTextures(1, &m_BRDFLUT);
+    }
+
+    RenderDevice::Get().DeleteVertexArrays(1, &m_VAO);
+    RenderDevice::Get().DeleteBuffers(1, &m_VBO);
+
+    m_ID = 0;
 }
 
 void SkyLight::Load(std::string path)
 {
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LEQUAL);
+    RenderDevice::Get().Enable(GL_DEPTH_TEST);
+    RenderDevice::Get().DepthFunc(GL_LEQUAL);
 
     m_Path = path;
 
     if (m_ID)
     {
-        glDeleteTextures(1, &m_ID);
-        glDeleteTextures(1, &m_PrefilterMap);
-        glDeleteTextures(1, &m_IrradianceMap);
-        glDeleteTextures(1, &m_BRDFLUT);
+        RenderDevice::Get().DeleteTextures(1, &m_ID);
+        RenderDevice::Get().DeleteTextures(1, &m_PrefilterMap);
+        RenderDevice::Get().DeleteTextures(1, &m_IrradianceMap);
+        RenderDevice::Get().DeleteTextures(1, &m_BRDFLUT);
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 256, 256);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_CaptureRBO);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
+    RenderDevice::Get().BindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
+    RenderDevice::Get().RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 256, 256);
+    RenderDevice::Get().FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_CaptureRBO);
 
-    glGenTextures(1, &m_ID);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
+    RenderDevice::Get().GenTextures(1, &m_ID);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
     for (unsigned int i = 0; i < 6; ++i)
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 256, 256, 0, GL_RGB, GL_FLOAT, nullptr);
+        RenderDevice::Get().TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 256, 256, 0, GL_RGB, GL_FLOAT, nullptr);
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
     glm::mat4 captureProjection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 10.0f);
     glm::mat4 captureViews[] =
@@ -176,133 +189,133 @@ void SkyLight::Load(std::string path)
     auto hdrTexture = Texture::Create(path, TextureRange::HDR);
     hdrTexture->Bind(0);
 
-    glViewport(0, 0, 256, 256);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
+    RenderDevice::Get().Viewport(0, 0, 256, 256);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
     for (unsigned int i = 0; i < 6; ++i)
     {
         shader->SetMat4("u_View", captureViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, m_ID, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        RenderDevice::Get().FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, m_ID, 0);
+        RenderDevice::Get().Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        glBindVertexArray(m_VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-        glBindVertexArray(0);
+        RenderDevice::Get().BindVertexArray(m_VAO);
+        RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 36);
+        RenderDevice::Get().BindVertexArray(0);
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
-    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
+    RenderDevice::Get().GenerateMipmap(GL_TEXTURE_CUBE_MAP);
 
-    glGenTextures(1, &m_IrradianceMap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_IrradianceMap);
+    RenderDevice::Get().GenTextures(1, &m_IrradianceMap);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_IrradianceMap);
     for (unsigned int i = 0; i < 6; ++i)
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 32, 32, 0, GL_RGB, GL_FLOAT, nullptr);
+        RenderDevice::Get().TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 32, 32, 0, GL_RGB, GL_FLOAT, nullptr);
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
-    glViewport(0, 0, 32, 32);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
+    RenderDevice::Get().Viewport(0, 0, 32, 32);
 
-    glBindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 32, 32);
+    RenderDevice::Get().BindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
+    RenderDevice::Get().RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 32, 32);
 
     auto irradianceShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "Irradiance");
     irradianceShader->Use();
     irradianceShader->SetInt("u_EnvironmentMap", 0);
     irradianceShader->SetMat4("u_Projection", captureProjection);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
+    RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
 
     for (unsigned int i = 0; i < 6; ++i)
     {
         irradianceShader->SetMat4("u_View", captureViews[i]);
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, m_IrradianceMap, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        RenderDevice::Get().FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, m_IrradianceMap, 0);
+        RenderDevice::Get().Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        glBindVertexArray(m_VAO);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-        glBindVertexArray(0);
+        RenderDevice::Get().BindVertexArray(m_VAO);
+        RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 36);
+        RenderDevice::Get().BindVertexArray(0);
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    glGenTextures(1, &m_PrefilterMap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_PrefilterMap);
+    RenderDevice::Get().GenTextures(1, &m_PrefilterMap);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_PrefilterMap);
     for (unsigned int i = 0; i < 6; ++i)
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 128, 128, 0, GL_RGB, GL_FLOAT, nullptr);
+        RenderDevice::Get().TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 128, 128, 0, GL_RGB, GL_FLOAT, nullptr);
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+    RenderDevice::Get().GenerateMipmap(GL_TEXTURE_CUBE_MAP);
 
     auto prefilterShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "Prefilter");
     prefilterShader->Use();
     prefilterShader->SetInt("u_EnvironmentMap", 0);
     prefilterShader->SetMat4("u_Projection", captureProjection);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
+    RenderDevice::Get().ActiveTexture(GL_TEXTURE0);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_CUBE_MAP, m_ID);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
     unsigned int maxMipLevels = 5;
     for (unsigned int mip = 0; mip < maxMipLevels; ++mip)
     {
         unsigned int mipWidth = 128 * std::pow(0.5f, mip);
         unsigned int mipHeight = 128 * std::pow(0.5f, mip);
-        glBindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, mipWidth, mipHeight);
-        glViewport(0, 0, mipWidth, mipHeight);
+        RenderDevice::Get().BindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
+        RenderDevice::Get().RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, mipWidth, mipHeight);
+        RenderDevice::Get().Viewport(0, 0, mipWidth, mipHeight);
 
         float roughness = (float)mip / (float)(maxMipLevels - 1);
         prefilterShader->SetFloat("u_Roughness", roughness);
         for (unsigned int i = 0; i < 6; ++i)
         {
             prefilterShader->SetMat4("u_View", captureViews[i]);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, m_PrefilterMap, mip);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            RenderDevice::Get().FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, m_PrefilterMap, mip);
+            RenderDevice::Get().Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-            glBindVertexArray(m_VAO);
-            glDrawArrays(GL_TRIANGLES, 0, 36);
-            glBindVertexArray(0);
+            RenderDevice::Get().BindVertexArray(m_VAO);
+            RenderDevice::Get().DrawArrays(GL_TRIANGLES, 0, 36);
+            RenderDevice::Get().BindVertexArray(0);
         }
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+    RenderDevice::Get().Enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
-    glGenTextures(1, &m_BRDFLUT);
+    RenderDevice::Get().GenTextures(1, &m_BRDFLUT);
 
-    glBindTexture(GL_TEXTURE_2D, m_BRDFLUT);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, 512, 512, 0, GL_RG, GL_FLOAT, 0);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    RenderDevice::Get().BindTexture(GL_TEXTURE_2D, m_BRDFLUT);
+    RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, 512, 512, 0, GL_RG, GL_FLOAT, 0);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 512, 512);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_BRDFLUT, 0);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, m_CaptureFBO);
+    RenderDevice::Get().BindRenderbuffer(GL_RENDERBUFFER, m_CaptureRBO);
+    RenderDevice::Get().RenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 512, 512);
+    RenderDevice::Get().FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_BRDFLUT, 0);
 
-    glViewport(0, 0, 512, 512);
+    RenderDevice::Get().Viewport(0, 0, 512, 512);
     auto brdfShader = ShaderLibrary::GetInstance()->GetShader(ShaderType::CALCULATION, "BRDF");
     brdfShader->Use();
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    RenderDevice::Get().Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     Renderer::GetInstance()->RenderQuad();
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderDevice::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    glDepthFunc(GL_LESS);
+    RenderDevice::Get().DepthFunc(GL_LESS);
 }
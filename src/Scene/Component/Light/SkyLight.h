@@ -38,7 +38,7 @@ public:
 
 	void Load(std::string path);
 
-	inline std::string GetPath() const { return m_Path; }
+	inline const std::string& GetPath() const { return m_Path; }
 	inline float GetIntensity() const { return m_Intensity; }
 	inline uint32_t GetID() const { return m_ID; }
 	inline unsigned int GetIrradianceMap() const { return m_IrradianceMap; }
@@ -3,6 +3,7 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "Scene/Scene.h"
+#include "Renderer/Device/RenderDevice.h"
 
 SpotLight::SpotLight(Entity* owner, Ref<UniformBuffer> vertexUniformBuffer, Ref<UniformBuffer> fragmentUniformBuffer)
 	: Light(owner, vertexUniformBuffer, fragmentUniformBuffer)
@@ -14,16 +15,19 @@ SpotLight::SpotLight(Entity* owner, Ref<UniformBuffer> vertexUniformBuffer, Ref<
 
 	m_FarPlane = 250.0f;
 
-	const uint32_t shadowWidth = 1024, shadowHeight = 1024;
+	m_ShadowMapSize = 1024;
 
-	glGenTextures(1, &m_ShadowMap);
-	glBindTexture(GL_TEXTURE_2D, m_ShadowMap);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+	for (uint32_t* shadowMap : { &m_ShadowMap, &m_StaticShadowMap })
+	{
+		RenderDevice::Get().GenTextures(1, shadowMap);
+		RenderDevice::Get().BindTexture(GL_TEXTURE_2D, *shadowMap);
+		RenderDevice::Get().TexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, m_ShadowMapSize, m_ShadowMapSize, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
 
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		RenderDevice::Get().TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
 }
 
 SpotLight::~SpotLight()
@@ -69,21 +73,29 @@ void SpotLight::SwitchOff()
 	m_FragmentUniformBuffer->Unbind();
 }
 
-void SpotLight::RenderShadowMap()
+void SpotLight::Destroy()
 {
-	Renderer::GetInstance()->RenderShadowMap(m_Owner->GetScene(), this);
+	Light::Destroy();
+
+	RenderDevice::Get().DeleteTextures(1, &m_ShadowMap);
+	RenderDevice::Get().DeleteTextures(1, &m_StaticShadowMap);
+	m_ShadowMap = 0;
+	m_StaticShadowMap = 0;
+}
+
+void SpotLight::RenderShadowMap(bool updateStaticLayer)
+{
+	Renderer::GetInstance()->RenderShadowMap(m_Owner->GetScene(), this, updateStaticLayer);
 }
 
 void SpotLight::SetInnerCutOff(float innerCutOff)
 {
 	m_InnerCutOff = innerCutOff;
-
-	m_Owner->GetScene()->SetChangedSinceLastFrame(true);
+	m_Dirty = true;
 }
 
 void SpotLight::SetOuterCutOff(float outerCutOff)
 {
 	m_OuterCutOff = outerCutOff;
-
-	m_Owner->GetScene()->SetChangedSinceLastFrame(true);
+	m_Dirty = true;
 }
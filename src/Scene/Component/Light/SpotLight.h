@@ -11,6 +11,9 @@ private:
 	float m_OuterCutOff;
 
 	uint32_t m_ShadowMap;
+	// Depth of the static casters only, copied into the shadow map before movable casters are drawn
+	uint32_t m_StaticShadowMap;
+	uint32_t m_ShadowMapSize;
 	float m_FarPlane;
 
 public:
@@ -19,14 +22,18 @@ public:
 
 	virtual void Use() override;
 	virtual void SwitchOff() override;
+	virtual void Destroy() override;
 
-	virtual void RenderShadowMap() override;
+	virtual void RenderShadowMap(bool updateStaticLayer) override;
 
-	inline void SetIndex(int index) { m_Index = index; }
+	inline void SetIndex(int index) { m_Dirty |= m_Index != index; m_Index = index; }
 
+	inline int GetIndex() const { return m_Index; }
 	inline float GetInnerCutOff() const { return m_InnerCutOff; }
 	inline float GetOuterCutOff() const { return m_OuterCutOff; }
 	inline uint32_t GetShadowMap() const { return m_ShadowMap; }
+	inline uint32_t GetStaticShadowMap() const { return m_StaticShadowMap; }
+	inline uint32_t GetShadowMapSize() const { return m_ShadowMapSize; }
 	inline float GetFarPlane() const { return m_FarPlane; }
 
 	void SetInnerCutOff(float innerCutOff);
@@ -34,3 +41,9 @@ public:
 
 	friend class EntityDetailsPanel;
 };
+
+template<>
+struct ComponentBase<SpotLight>
+{
+	using Type = Light;
+};
\ No newline at end of file
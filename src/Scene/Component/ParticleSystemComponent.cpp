@@ -1,8 +1,8 @@
 #include "ParticleSystemComponent.h"
-#include <GLFW/glfw3.h>
 #include "Material/ShaderLibrary.h"
 #include "Scene/Entity.h"
 #include "Scene/Scene.h"
+#include "Renderer/Device/RenderDevice.h"
 
 ParticleSystemComponent::ParticleSystemComponent(Entity* owner)
 	: RenderComponent(owner)
@@ -54,13 +54,13 @@ void ParticleSystemComponent::Update()
 	}
 
 
-	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_PositionBuffer->GetID());
-	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, m_VelocityBuffer->GetID());
+	RenderDevice::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_PositionBuffer->GetID());
+	RenderDevice::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, m_VelocityBuffer->GetID());
 
 	m_ComputeShader->Use();
 
-	glDispatchCompute(m_ParticlesCount / 128, 1, 1);
-	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+	RenderDevice::Get().DispatchCompute(m_ParticlesCount / 128, 1, 1);
+	RenderDevice::Get().MemoryBarrierBits(GL_SHADER_STORAGE_BARRIER_BIT);
 }
 
 void ParticleSystemComponent::PreRender()
@@ -79,27 +79,36 @@ void ParticleSystemComponent::Render()
 	particleShader->SetInt("u_Sprite", 0);
 	particleShader->SetVec4("u_Color", glm::vec4(0.4f, 6.0f, 7.0f, std::clamp((m_ParticleLifeTime - m_ParticlesLifeTimeCounter), 0.0f, 1.0f)));
 
-	glDisable(GL_CULL_FACE);
+	RenderDevice::Get().Disable(GL_CULL_FACE);
 
 
-	glBindVertexArray(m_ParticleVAO);
+	RenderDevice::Get().BindVertexArray(m_ParticleVAO);
 
-	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_PositionBuffer->GetID());
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer->GetID());
+	RenderDevice::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_PositionBuffer->GetID());
+	RenderDevice::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer->GetID());
 
-	glDrawElements(GL_TRIANGLES, m_ParticlesCount * 6, GL_UNSIGNED_INT, 0);
+	RenderDevice::Get().DrawElements(GL_TRIANGLES, m_ParticlesCount * 6, GL_UNSIGNED_INT, 0);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
+	RenderDevice::Get().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	RenderDevice::Get().BindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
 
-	glBindVertexArray(0);
+	RenderDevice::Get().BindVertexArray(0);
 
-	glEnable(GL_CULL_FACE);
-	glDisable(GL_BLEND);
+	RenderDevice::Get().Enable(GL_CULL_FACE);
+	RenderDevice::Get().Disable(GL_BLEND);
 }
 
 void ParticleSystemComponent::Destroy()
 {
+	m_PositionBuffer.reset();
+	m_VelocityBuffer.reset();
+	m_IndexBuffer.reset();
+	m_ComputeShader.reset();
+
+	if (m_ParticleVAO)
+		RenderDevice::Get().DeleteVertexArrays(1, &m_ParticleVAO);
+
+	m_ParticleVAO = 0;
 }
 
 void ParticleSystemComponent::Reset()
@@ -166,10 +175,10 @@ void ParticleSystemComponent::Reset()
 
 	if (m_ParticleVAO)
 	{
-		glDeleteVertexArrays(1, &m_ParticleVAO);
+		RenderDevice::Get().DeleteVertexArrays(1, &m_ParticleVAO);
 	}
 
-	glGenVertexArrays(1, &m_ParticleVAO);
+	RenderDevice::Get().GenVertexArrays(1, &m_ParticleVAO);
 }
 
 void ParticleSystemComponent::SetParticlesCount(uint32_t count)
@@ -32,7 +32,7 @@ private:
 
 	uint32_t m_NoiseTexture;
 
-	uint32_t m_ParticleVAO;
+	uint32_t m_ParticleVAO = 0;
 
 	uint32_t m_ParticlesCount;
 	float m_Radius;
@@ -82,8 +82,7 @@ void PlayerComponent::MoveBackward()
 
 void PlayerComponent::RotateHeadLeft()
 {
-	auto children = m_Owner->GetChildren();
-	for (auto child : children)
+	for (auto child : m_Owner->GetChildren())
 	{
 		if (child->GetName() == "Head")
 		{
@@ -98,8 +97,7 @@ void PlayerComponent::RotateHeadLeft()
 
 void PlayerComponent::RotateHeadRight()
 {
-	auto children = m_Owner->GetChildren();
-	for (auto child : children)
+	for (auto child : m_Owner->GetChildren())
 	{
 		if (child->GetName() == "Head")
 		{
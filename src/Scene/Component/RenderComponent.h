@@ -4,11 +4,15 @@
 
 #include "Renderer/Renderer.h"
 
+class RenderCommandBuffer;
+
 class RenderComponent : public Component
 {
 public:
 	RenderComponent(Entity* owner) : Component(owner) {};
 
 	virtual void PreRender() = 0;
+	// Records the component's draws for the main pass, components drawing themselves do it in Render
+	virtual void EmitCommands(RenderCommandBuffer& /*commands*/) {}
 	virtual void Render() = 0;
 };
\ No newline at end of file
@@ -5,9 +5,6 @@
 
 #include "Scene/Entity.h"
 #include "Scene/Scene.h"
-#include "Light/PointLight.h"
-#include "Light/SpotLight.h"
-#include "Light/SkyLight.h"
 
 #include <glad/glad.h>
 
@@ -26,11 +23,11 @@ StaticMeshComponent::StaticMeshComponent(Entity* owner, std::string path)
 }
 
 StaticMeshComponent::StaticMeshComponent(Entity* owner, std::string path, std::vector<std::string> materialsPaths)
-	: RenderComponent(owner), m_Path(path), m_MaterialsPaths(materialsPaths)
+	: RenderComponent(owner), m_Path(path), m_MaterialsPaths(std::move(materialsPaths))
 {
 	LoadMesh(path);
 
-	for (auto path : m_MaterialsPaths)
+	for (auto& path : m_MaterialsPaths)
 		m_Materials.push_back(MaterialImporter::GetInstance()->ImportMaterial(path));
 
 }
@@ -51,135 +48,26 @@ void StaticMeshComponent::PreRender()
 
 void StaticMeshComponent::Render()
 {
-	uint32_t irradianceMap;
-	uint32_t prefilterMap;
-	uint32_t BRDFLUT;
-	float intensity;
-	bool isSkyLight = false;
-
-	auto components = m_Owner->GetScene()->GetComponents<SkyLight>();
-	if (components.size() > 0)
-	{
-		if (auto skyLight = Cast<SkyLight>(components[0]))
-		{
-			isSkyLight = true;
-			intensity = skyLight->GetIntensity();
-
-			irradianceMap = skyLight->GetIrradianceMap();
-			prefilterMap = skyLight->GetPrefilterMap();
-			BRDFLUT = skyLight->GetBRDFLUT();
-		}
-
-	}
-
-	for (auto material : GetMaterials())
-	{
-		material->Use();
-
-		material->GetShader()->SetBool("u_IsSkyLight", isSkyLight);
-
-		if (isSkyLight)
-		{
-			material->GetShader()->SetFloat("u_SkyLightIntensity", intensity);
-
-			glActiveTexture(GL_TEXTURE0 + 20);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, irradianceMap);
-			material->GetShader()->SetInt("u_IrradianceMap", 20);
-			glActiveTexture(GL_TEXTURE0 + 21);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, prefilterMap);
-			material->GetShader()->SetInt("u_PrefilterMap", 21);
-			glActiveTexture(GL_TEXTURE0 + 22);
-			glBindTexture(GL_TEXTURE_2D, BRDFLUT);
-			material->GetShader()->SetInt("u_BRDFLUT", 22);
-		}
-		else
-		{
-			glActiveTexture(GL_TEXTURE0 + 20);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, Renderer::GetInstance()->GetPointLightShadowMapPlaceholder(0));
-			material->GetShader()->SetInt("u_IrradianceMap", 20);
-			glActiveTexture(GL_TEXTURE0 + 21);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, Renderer::GetInstance()->GetPointLightShadowMapPlaceholder(0));
-			material->GetShader()->SetInt("u_PrefilterMap", 21);
-			glActiveTexture(GL_TEXTURE0 + 22);
-			glBindTexture(GL_TEXTURE_2D, Renderer::GetInstance()->GetSpotLightShadowMapPlaceholder(0));
-			material->GetShader()->SetInt("u_BRDFLUT", 22);
-		}
-
-		glActiveTexture(GL_TEXTURE0 + 23);
-		glBindTexture(GL_TEXTURE_2D, Renderer::GetInstance()->GetDirectionalLightShadowMapFramebuffer()->GetDepthAttachment());
-		material->GetShader()->SetInt("u_DirectionalLightShadowMap", 23);
-
-		auto pointLights = m_Owner->GetScene()->GetComponents<PointLight>();
-		for (int i = 0; i < MAX_POINT_LIGHTS; i++)
-		{
-			if (i < pointLights.size())
-			{
-				auto shadowMap = Cast<PointLight>(pointLights[i])->GetShadowMap();
-
-				glActiveTexture(GL_TEXTURE0 + 24 + i);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, shadowMap);
-				material->GetShader()->SetInt("u_PointLightShadowMaps[" + std::to_string(i) + "]", 24 + i);
-			}
-			else
-			{
-				glActiveTexture(GL_TEXTURE0 + 24 + i);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, Renderer::GetInstance()->GetPointLightShadowMapPlaceholder(i));
-				material->GetShader()->SetInt("u_PointLightShadowMaps[" + std::to_string(i) + "]", 24 + i);
-			}
-		}
-
-		auto spotLights = m_Owner->GetScene()->GetComponents<SpotLight>();
-		for (int i = 0; i < MAX_SPOT_LIGHTS; i++)
-		{
-			if (i < spotLights.size())
-			{
-				auto shadowMap = Cast<SpotLight>(spotLights[i])->GetShadowMap();
-
-				glActiveTexture(GL_TEXTURE0 + 24 + MAX_POINT_LIGHTS + i);
-				glBindTexture(GL_TEXTURE_2D, shadowMap);
-				material->GetShader()->SetInt("u_SpotLightShadowMaps[" + std::to_string(i) + "]", 24 + MAX_POINT_LIGHTS + i);
-			}
-			else
-			{
-				glActiveTexture(GL_TEXTURE0 + 24 + MAX_POINT_LIGHTS + i);
-				glBindTexture(GL_TEXTURE_2D, Renderer::GetInstance()->GetSpotLightShadowMapPlaceholder(i));
-				material->GetShader()->SetInt("u_SpotLightShadowMaps[" + std::to_string(i) + "]", 24 + MAX_POINT_LIGHTS + i);
-			}
-		}
-
-
-		material->GetShader()->SetMat4("u_Model", m_Owner->GetTransform().ModelMatrix);
-	}
-	if (!m_MultipleMaterials && m_Materials.at(0))
-	{
-		m_Materials.at(0)->Use();
-
-		for (auto mesh : m_Meshes)
-		{
-			mesh.Render();
-		}
-
-		return;
-	}
-
-	for (int i = 0; i < m_Meshes.size(); i++)
-	{
-		if (m_Materials.size() > i)
-			m_Materials.at(i)->Use();
-
-		m_Meshes.at(i).Render();
-	}
-
+	// Meshes are extracted into the scene's render list and drawn by the renderer
 }
 
 void StaticMeshComponent::Destroy()
 {
+	MeshImporter::GetInstance()->ReleaseMesh(m_Path);
+	m_Meshes.clear();
+}
+
+void StaticMeshComponent::SetCastShadows(bool castShadows)
+{
+	m_CastShadows = castShadows;
+
+	m_Owner->GetScene()->InvalidateShadows(m_WorldBounds, m_Owner->GetMobility());
 }
 
 uint32_t StaticMeshComponent::GetRenderedVerticesCount()
 {
 	uint32_t vertices = 0;
-	for (auto mesh : m_Meshes)
+	for (auto& mesh : m_Meshes)
 	{
 		vertices += mesh.vertices.size();
 	}
@@ -191,6 +79,13 @@ void StaticMeshComponent::LoadMesh(std::string path)
 {
 	m_Path = path;
 	m_Meshes = MeshImporter::GetInstance()->ImportMesh(path);
+
+	m_LocalBounds = AABB();
+	for (auto& mesh : m_Meshes)
+		m_LocalBounds.Expand(mesh.GetBounds());
+
+	m_BoundsDirty = true;
+	m_Owner->GetScene()->MarkBoundsDirty();
 }
 
 void StaticMeshComponent::LoadMaterial(std::string path)
@@ -201,6 +96,7 @@ void StaticMeshComponent::LoadMaterial(std::string path)
 
 void StaticMeshComponent::ChangeMesh(std::string path)
 {
+	MeshImporter::GetInstance()->ReleaseMesh(m_Path);
 	LoadMesh(path);
 
 	m_Materials.clear();
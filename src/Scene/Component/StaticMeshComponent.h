@@ -18,6 +18,13 @@ private:
 	std::vector<std::string> m_MaterialsPaths;
 
 	bool m_MultipleMaterials;
+	bool m_CastShadows = true;
+
+	// Union of the meshes' bounds, the scene keeps the world space version in its BVH
+	AABB m_LocalBounds;
+	int32_t m_BoundsProxy = -1;
+	AABB m_WorldBounds;
+	bool m_BoundsDirty = true;
 
 public:
 	StaticMeshComponent(Entity* owner);
@@ -35,11 +42,17 @@ public:
 	virtual void Render() override;
 	virtual void Destroy() override;
 
-	inline std::string GetPath() const { return m_Path; }
-	inline std::vector<Mesh> GetMeshes() const { return m_Meshes; }
-	inline std::vector<Ref<Material>> GetMaterials() const { return m_Materials; }
-	inline std::vector<std::string> GetMaterialsPaths() const { return m_MaterialsPaths; }
+	inline const std::string& GetPath() const { return m_Path; }
+	inline const std::vector<Mesh>& GetMeshes() const { return m_Meshes; }
+	inline const std::vector<Ref<Material>>& GetMaterials() const { return m_Materials; }
+	inline const std::vector<std::string>& GetMaterialsPaths() const { return m_MaterialsPaths; }
 	uint32_t GetRenderedVerticesCount();
+	inline const AABB& GetLocalBounds() const { return m_LocalBounds; }
+	inline const AABB& GetWorldBounds() const { return m_WorldBounds; }
+	inline bool CastsShadows() const { return m_CastShadows; }
+
+	inline void SetMaterial(int index, Ref<Material> material) { m_Materials.at(index) = std::move(material); }
+	void SetCastShadows(bool castShadows);
 
-	inline void SetMaterial(int index, Ref<Material> material) { m_Materials.at(index) = material; }
+	friend class Scene;
 };
\ No newline at end of file
@@ -1,107 +1,146 @@
 #include "Entity.h"
 
-#include "Scene.h"
-
-Ref<Entity> Entity::Create(Scene* scene, std::string name)
-{
-	return CreateRef<Entity>(scene, name);
-}
+#include <algorithm>
 
-Ref<Entity> Entity::Create(Scene* scene, uint64_t id, std::string name)
-{
-	return CreateRef<Entity>(scene, id, name);
-}
+#include "Scene.h"
+#include "Component/StaticMeshComponent.h"
+#include "Component/InstanceRenderedMeshComponent.h"
+#include "Component/Light/Light.h"
 
-Entity::Entity(Scene* scene, std::string name)
-	: m_Scene(scene), m_Name(name), m_Transform(Transform(this))
+Ref<Entity> Entity::Create(Scene* scene, std::string_view name)
 {
-	std::random_device rd;
-	std::mt19937 gen(rd());
-	std::uniform_int_distribution distribution(1, 999999999);
-
-	m_ID = distribution(gen);
-
-	m_Parent = nullptr;
+	return std::allocate_shared<Entity>(SceneAllocator<Entity>(scene->GetMemory()), scene, name);
 }
 
-Entity::Entity(Scene* scene, uint64_t id, std::string name)
-	: m_Scene(scene), m_ID(id), m_Name(name), m_Transform(Transform(this))
+Entity::Entity(Scene* scene, std::string_view name)
+	: m_Scene(scene), m_Name(scene->GetMemory()->StoreName(name)),
+	m_Components(scene->GetMemory()), m_RenderComponents(scene->GetMemory()), m_InGameComponents(scene->GetMemory()),
+	m_Transform(Transform(this)), m_Children(scene->GetMemory())
 {
 	m_Parent = nullptr;
 }
 
 void Entity::Begin()
 {
-	for (auto component : m_Components)
+	for (auto& component : m_Components)
 	{
 		component->Begin();
 	}
 }
 
-void Entity::Update()
+void Entity::Render()
 {
-	for (auto component : m_Components)
+	for (auto rc : m_RenderComponents)
 	{
-		component->Update();
+		rc->Render();
 	}
 }
 
-void Entity::PreRender()
+void Entity::Destroy()
 {
-	for (auto component : m_Components)
+	for (auto& component : m_Components)
 	{
-		if (auto rc = Cast<RenderComponent>(component))
-			rc->PreRender();
+		component->Destroy();
 	}
 }
 
-void Entity::Render()
+void Entity::BeginPlay()
 {
-	for (auto component : m_Components)
+	for (auto igc : m_InGameComponents)
 	{
-		if (auto rc = Cast<RenderComponent>(component))
-			rc->Render();
+		igc->BeginPlay();
 	}
 }
 
-void Entity::Destroy()
+void Entity::EndPlay()
 {
-	for (auto component : m_Components)
+	for (auto igc : m_InGameComponents)
 	{
-		component->Destroy();
+		igc->EndPlay();
 	}
 }
 
-void Entity::BeginPlay()
+void Entity::RemoveComponent(Ref<Component> component)
 {
-	for (auto component : m_Components)
+	auto it = std::find(m_Components.begin(), m_Components.end(), component);
+	if (it == m_Components.end())
+		return;
+
+	component->Destroy();
+
+	m_Components.erase(it);
+	m_RenderComponents.erase(std::remove_if(m_RenderComponents.begin(), m_RenderComponents.end(),
+		[&](RenderComponent* rc) { return rc == component.get(); }), m_RenderComponents.end());
+	m_InGameComponents.erase(std::remove_if(m_InGameComponents.begin(), m_InGameComponents.end(),
+		[&](InGameComponent* igc) { return igc == component.get(); }), m_InGameComponents.end());
+
+	for (ComponentTypeID type = 0; type < MAX_COMPONENT_TYPES; type++)
 	{
-		if (auto igc = Cast<InGameComponent>(component))
-			igc->BeginPlay();
+		if (!component->m_TypeMask.test(type) || !m_ComponentMask.test(type) || GetComponent(type) != component)
+			continue;
+
+		m_Scene->UnregisterComponent(type, m_ComponentIndices[type]);
+		m_ComponentMask.reset(type);
+
+		// Another component sharing this base type takes over the slot
+		for (auto& other : m_Components)
+		{
+			if (other->m_TypeMask.test(type))
+			{
+				RegisterComponent(type, other);
+				break;
+			}
+		}
 	}
 }
 
-void Entity::Tick(float deltaTime)
+void Entity::SetEnable(bool enable)
 {
-	for (auto component : m_Components)
+	if (m_Enable == enable)
+		return;
+
+	m_Enable = enable;
+
+	// Shows or hides a whole subtree of lights and casters, subtrees disabled on their own stay hidden either way
+	std::vector<Entity*> stack = { this };
+	while (!stack.empty())
 	{
-		if (auto igc = Cast<InGameComponent>(component))
-			igc->Tick(deltaTime);
+		Entity* entity = stack.back();
+		stack.pop_back();
+
+		entity->InvalidateShadowCasters(entity->m_Mobility);
+		if (auto light = entity->GetComponent<Light>())
+			light->MarkDirty();
+
+		for (auto child : entity->m_Children)
+		{
+			if (child->m_Enable)
+				stack.push_back(child);
+		}
 	}
 }
 
-void Entity::EndPlay()
+void Entity::SetMobility(Mobility mobility)
 {
-	for (auto component : m_Components)
-	{
-		if (auto igc = Cast<InGameComponent>(component))
-			igc->EndPlay();
-	}
+	if (m_Mobility == mobility)
+		return;
+
+	// Moves the entity's casters from one shadow layer to the other, both have to be redrawn where they are
+	InvalidateShadowCasters(m_Mobility);
+	InvalidateShadowCasters(mobility);
+
+	m_Mobility = mobility;
 }
 
-void Entity::SetEnable(bool enable)
+void Entity::InvalidateShadowCasters(Mobility mobility)
 {
-	m_Enable = enable;
+	auto smc = GetComponent<StaticMeshComponent>();
+	if (smc && smc->CastsShadows())
+		m_Scene->InvalidateShadows(smc->GetWorldBounds(), mobility);
+
+	auto irmc = GetComponent<InstanceRenderedMeshComponent>();
+	if (irmc && irmc->CastsShadows())
+		m_Scene->InvalidateShadows(irmc->GetInstancesBounds(), mobility);
 }
 
 void Entity::SetParent(Entity* parent)
@@ -112,45 +151,51 @@ void Entity::SetParent(Entity* parent)
 	m_Parent = parent;
 	m_Parent->m_Children.emplace_back(this);
 
-	CalculateModelMatrix();
+	m_TransformDirty = true;
+	m_Scene->MarkHierarchyDirty();
 }
 
 void Entity::SetLocalPosition(glm::vec3 position)
 {
 	m_Transform.LocalPosition = position;
-	CalculateModelMatrix();
-
-	m_Scene->SetChangedSinceLastFrame(true);
+	MarkTransformDirty();
 }
 
 void Entity::SetLocalRotation(glm::vec3 rotation)
 {
 	m_Transform.LocalRotation = rotation;
-	CalculateModelMatrix();
-
-	m_Scene->SetChangedSinceLastFrame(true);
+	MarkTransformDirty();
 }
 
 void Entity::SetLocalScale(glm::vec3 scale)
 {
 	m_Transform.LocalScale = scale;
-	CalculateModelMatrix();
-
-	m_Scene->SetChangedSinceLastFrame(true);
+	MarkTransformDirty();
 }
 
-void Entity::SetID(uint64_t id)
+void Entity::SetName(std::string name)
 {
-	m_ID = id;
+	// The previous name stays in the arena until the scene goes away
+	std::string_view previousName = m_Name;
+	m_Name = m_Scene->GetMemory()->StoreName(name);
+
+	m_Scene->UpdateEntityName(this, previousName);
 }
 
 glm::vec3 Entity::GetWorldPosition()
 {
+	// Only walk up the hierarchy while there are changes the scene has not resolved yet
+	if (IsTransformResolved())
+		return m_Scene->GetTransformHierarchy().WorldPositions[m_TransformIndex];
+
 	return m_Transform.LocalPosition + (m_Parent ? m_Parent->GetWorldPosition() : glm::vec3(0.0f));
 }
 
 glm::vec3 Entity::GetWorldRotation()
 {
+	if (IsTransformResolved())
+		return m_Scene->GetTransformHierarchy().WorldRotations[m_TransformIndex];
+
 	return m_Transform.LocalRotation + (m_Parent ? m_Parent->GetWorldRotation() : glm::vec3(0.0f));
 }
 
@@ -159,15 +204,35 @@ void Entity::SetWorldPosition(glm::vec3 position)
 	SetLocalPosition(position - (m_Parent ? m_Parent->GetWorldPosition() : glm::vec3(0.0f)));
 }
 
-void Entity::CalculateModelMatrix()
+void Entity::RegisterComponent(ComponentTypeID type, const Ref<Component>& component)
 {
-	if (m_Parent)
-		m_Transform.CalculateModelMatrix(m_Parent->GetTransform().ModelMatrix);
-	else
-		m_Transform.CalculateModelMatrix();
+	component->m_TypeMask.set(type);
 
-	for (auto child : m_Children)
-	{
-		child->CalculateModelMatrix();
-	}
+	if (m_ComponentMask.test(type))
+		return;
+
+	m_ComponentIndices[type] = m_Scene->RegisterComponent(type, this, component);
+	m_ComponentMask.set(type);
 }
+
+Ref<Component> Entity::GetComponent(ComponentTypeID type) const
+{
+	return m_Scene->GetComponentPool(type).Components[m_ComponentIndices[type]];
+}
+
+SystemScheduler& Entity::GetSystemScheduler() const
+{
+	return m_Scene->GetSystemScheduler();
+}
+
+void Entity::MarkTransformDirty()
+{
+	m_TransformDirty = true;
+	m_Scene->MarkTransformsDirty();
+}
+
+bool Entity::IsTransformResolved() const
+{
+	const TransformHierarchy& hierarchy = m_Scene->GetTransformHierarchy();
+	return !m_Scene->AreTransformsDirty() && m_TransformIndex < hierarchy.Entities.size() && hierarchy.Entities[m_TransformIndex] == this;
+}
\ No newline at end of file
@@ -1,100 +1,144 @@
 #pragma once
 
+#include <array>
+#include <string_view>
+
 #include "glm/glm.hpp"
+#include "EntityHandle.h"
+#include "Mobility.h"
+#include "Core/Memory/SceneMemory.h"
+#include "Core/Span.h"
 #include "Scene/Component/Component.h"
 #include "Scene/Component/RenderComponent.h"
 #include "Scene/Component/InGameComponent.h"
 #include "Scene/Component/Transform.h"
+#include "Scene/SystemScheduler.h"
 
 class Scene;
 
 class Entity : public std::enable_shared_from_this<Entity>
 {
 public:
-	static Ref<Entity> Create(Scene* scene, std::string name);
-	static Ref<Entity> Create(Scene* scene, uint64_t id, std::string name);
+	static Ref<Entity> Create(Scene* scene, std::string_view name);
 
-	Entity(Scene* scene, std::string name);
-	Entity(Scene* scene, uint64_t id, std::string name);
+	Entity(Scene* scene, std::string_view name);
 
 	void Begin();
-	void Update();
-	void PreRender();
 	void Render();
 	void Destroy();
 
 	void BeginPlay();
-	void Tick(float deltaTime);
 	void EndPlay();
 
 	template<typename T, typename ... Args>
 	Ref<T> AddComponent(Args&& ... args)
 	{
-		Ref<T> comp = CreateRef<T>(this, std::forward<Args>(args)...);
+		// Components live in the scene memory, next to the other components of the same size
+		Ref<T> comp = std::allocate_shared<T>(SceneAllocator<T>(m_Components.get_allocator()), this, std::forward<Args>(args)...);
 		m_Components.push_back(comp);
 
+		if constexpr (std::is_base_of_v<RenderComponent, T>)
+			m_RenderComponents.push_back(comp.get());
+		if constexpr (std::is_base_of_v<InGameComponent, T>)
+			m_InGameComponents.push_back(comp.get());
+
+		RegisterComponent<T>(comp);
+		GetSystemScheduler().AddDefaultSystems<T>();
+
 		return comp;
 	}
 
 	template<typename T>
 	Ref<T> GetComponent() const
 	{
-		for (auto component : m_Components)
-		{
-			if (Ref<T> comp = Cast<T>(component))
-				return comp;
-		}
+		ComponentTypeID type = ComponentType::Get<T>();
+		if (!m_ComponentMask.test(type))
+			return Ref<T>();
 
-		return Ref<T>();
+		return std::static_pointer_cast<T>(GetComponent(type));
 	}
 
 	template<typename T>
 	void RemoveComponent()
 	{
-		for (auto component : m_Components)
-		{
-			if (Cast<T>(component))
-			{
-				m_Components.erase(std::remove(m_Components.begin(), m_Components.end(), component), m_Components.end());
-			}
-		}
+		if (Ref<T> component = GetComponent<T>())
+			RemoveComponent(component);
 	}
 
+	void RemoveComponent(Ref<Component> component);
+
 	inline Scene* GetScene() const { return m_Scene; }
-	inline std::string GetName() const { return m_Name; }
-	inline Transform GetTransform() const { return m_Transform; }
+	// Stored in the scene's name arena, always null terminated
+	inline std::string_view GetName() const { return m_Name; }
+	inline const Transform& GetTransform() const { return m_Transform; }
 	inline bool IsEnable() const { return m_Enable; }
+	inline Mobility GetMobility() const { return m_Mobility; }
 	inline Entity* GetParent() const { return m_Parent; }
-	inline std::vector<Entity*> GetChildren() const { return m_Children; }
-	inline uint64_t GetID() const { return m_ID; }
+	inline Span<Entity* const> GetChildren() const { return m_Children; }
+	inline EntityHandle GetHandle() const { return m_Handle; }
+	inline uint64_t GetID() const { return m_Handle.ToID(); }
 
 	void SetEnable(bool enable);
+	void SetMobility(Mobility mobility);
 	void SetParent(Entity* parent);
 	void SetLocalPosition(glm::vec3 position);
 	void SetLocalRotation(glm::vec3 rotation);
 	void SetLocalScale(glm::vec3 scale);
-	void SetID(uint64_t id);
+	void SetName(std::string name);
 
 	glm::vec3 GetWorldPosition();
 	glm::vec3 GetWorldRotation();
 
 	void SetWorldPosition(glm::vec3 position);
 
-	void CalculateModelMatrix();
+private:
+	template<typename T>
+	void RegisterComponent(const Ref<Component>& component)
+	{
+		RegisterComponent(ComponentType::Get<T>(), component);
+
+		using Base = typename ComponentBase<T>::Type;
+		if constexpr (!std::is_void_v<Base>)
+			RegisterComponent<Base>(component);
+	}
+
+	void RegisterComponent(ComponentTypeID type, const Ref<Component>& component);
+	Ref<Component> GetComponent(ComponentTypeID type) const;
+	SystemScheduler& GetSystemScheduler() const;
+
+	void MarkTransformDirty();
+	// Queues the bounds of the entity's own shadow casters for the shadow maps of the given mobility
+	void InvalidateShadowCasters(Mobility mobility);
+	bool IsTransformResolved() const;
 
 private:
 	Scene* m_Scene;
 
-	uint64_t m_ID;
-	std::string m_Name;
-	std::vector<Ref<Component>> m_Components;
+	// Assigned by the scene when the entity is added
+	EntityHandle m_Handle;
+	std::string_view m_Name;
+	SceneVector<Ref<Component>> m_Components;
+	SceneVector<RenderComponent*> m_RenderComponents;
+	SceneVector<InGameComponent*> m_InGameComponents;
+
+	// Index of the component of each type inside the scene's component pools
+	ComponentMask m_ComponentMask;
+	std::array<uint32_t, MAX_COMPONENT_TYPES> m_ComponentIndices;
 
 	Transform m_Transform;
+	// World transform is resolved by Scene::UpdateTransforms, stored at this index of the scene's transform hierarchy
+	uint32_t m_TransformIndex = UINT32_MAX;
+	bool m_TransformDirty = true;
+
 	Entity* m_Parent;
-	std::vector<Entity*> m_Children;
+	SceneVector<Entity*> m_Children;
 
 	bool m_Enable = true;
+	Mobility m_Mobility = Mobility::STATIC;
+	// Queued by Scene::RemoveEntity, destroyed at the next frame boundary
+	bool m_PendingDestroy = false;
 
+	friend class Scene;
 	friend class SceneHierarchyPanel;
 	friend class EntityDetailsPanel;
 };
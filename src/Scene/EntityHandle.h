@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// Slot index in the scene's entity table plus the generation of that slot. Once the entity is
+// removed and its slot reused the generations no longer match, so stale handles are detected.
+struct EntityHandle
+{
+	uint32_t Index = UINT32_MAX;
+	uint32_t Generation = 0;
+
+	EntityHandle() = default;
+	EntityHandle(uint32_t index, uint32_t generation) : Index(index), Generation(generation) {}
+	explicit EntityHandle(uint64_t id) : Index((uint32_t)id), Generation((uint32_t)(id >> 32)) {}
+
+	inline uint64_t ToID() const { return ((uint64_t)Generation << 32) | Index; }
+	inline bool IsNull() const { return Index == UINT32_MAX; }
+
+	inline bool operator==(const EntityHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+	inline bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <array>
+
+#include "Scene/Component/Light/Light.h"
+
+// Lighting state gathered once per frame and shared by every draw
+struct FrameLights
+{
+	bool IsSkyLight = false;
+	float SkyLightIntensity = 0.0f;
+	uint32_t IrradianceMap = 0;
+	uint32_t PrefilterMap = 0;
+	uint32_t BRDFLUT = 0;
+
+	int PointLightsCount = 0;
+	int SpotLightsCount = 0;
+
+	std::array<uint32_t, MAX_POINT_LIGHTS> PointLightShadowMaps;
+	std::array<uint32_t, MAX_SPOT_LIGHTS> SpotLightShadowMaps;
+};
\ No newline at end of file
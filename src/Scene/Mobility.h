@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+// Static entities are not expected to move, lights keep the shadows they cast cached between frames
+enum class Mobility : uint8_t
+{
+	STATIC, MOVABLE
+};
\ No newline at end of file
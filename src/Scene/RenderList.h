@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Renderer/Culling.h"
+#include "Mobility.h"
+
+class Entity;
+class Mesh;
+class Material;
+class RenderComponent;
+class InstanceRenderedMeshComponent;
+
+struct DrawItem
+{
+	Mesh* SourceMesh;
+	Material* SourceMaterial;
+	Entity* Owner;
+	glm::mat4 ModelMatrix;
+	bool CastShadows;
+};
+
+// Everything visible this frame, extracted once from the enabled hierarchy and reused between frames
+struct RenderList
+{
+	std::vector<DrawItem> Items;
+	// World bounds of the items, in the same order
+	CullingBounds Bounds;
+	// Render components which draw themselves (instanced meshes, particles, sky)
+	std::vector<RenderComponent*> Components;
+
+	// Built once per frame and culled against every light's volume
+	std::vector<uint32_t> ShadowCasters;
+	std::vector<Mobility> ShadowCastersMobility;
+	CullingBounds ShadowCastersBounds;
+	std::vector<InstanceRenderedMeshComponent*> InstancedShadowCasters;
+	std::vector<Mobility> InstancedShadowCastersMobility;
+	CullingBounds InstancedShadowCastersBounds;
+	// Per entity in transform hierarchy order
+	std::vector<uint8_t> Visible;
+
+	inline void Clear()
+	{
+		Items.clear();
+		Bounds.Clear();
+		Components.clear();
+		ShadowCasters.clear();
+		ShadowCastersMobility.clear();
+		ShadowCastersBounds.Clear();
+		InstancedShadowCasters.clear();
+		InstancedShadowCastersMobility.clear();
+		InstancedShadowCastersBounds.Clear();
+	}
+};
\ No newline at end of file
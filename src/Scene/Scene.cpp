@@ -1,15 +1,22 @@
 #include "Scene.h"
 #include "Component/StaticMeshComponent.h"
+#include "Component/InstanceRenderedMeshComponent.h"
+#include "Component/ParticleSystemComponent.h"
+#include "Component/PlayerComponent.h"
 #include "Component/Light/DirectionalLight.h"
 #include "Component/Light/PointLight.h"
 #include "Component/Light/SpotLight.h"
+#include "Component/Light/SkyLight.h"
 
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glad/glad.h>
+#include <algorithm>
 #include "Renderer/Renderer.h"
+#include "Core/Memory/FrameMemory.h"
 
 Scene::Scene()
+	: m_Memory(std::make_unique<SceneMemory>()), m_SystemScheduler(this)
 {
 	m_Camera = CreateRef<Camera>(this, glm::vec3(0.0f, 0.0f, 5.0f));
 
@@ -25,13 +32,15 @@ Scene::Scene()
 		+ GLSL_DIRECTIONAL_LIGHT_SIZE
 		+ (GLSL_POINT_LIGHT_SIZE * MAX_POINT_LIGHTS)
 		+ (GLSL_SPOT_LIGHT_SIZE * MAX_SPOT_LIGHTS), 3);
+
+	RegisterSystems();
 }
 
 void Scene::Begin()
 {
-	m_Root->CalculateModelMatrix();
+	UpdateTransforms();
 
-	for (auto entity : m_Entities)
+	for (auto& entity : m_Entities)
 	{
 		entity->Begin();
 	}
@@ -39,26 +48,30 @@ void Scene::Begin()
 
 void Scene::Update()
 {
+	DestroyPendingEntities();
+
 	m_Camera->Update();
 
-	for (auto entity : m_Entities)
-	{
-		entity->Update();
-	}
+	m_SystemScheduler.Run(SystemPhase::UPDATE);
+
+	UpdateTransforms();
 }
 
 void Scene::PreRender()
 {
-	for (auto e : m_Entities)
-	{
-		e->PreRender();
-	}
+	// Picks up changes made after Update (in game ticks, editor)
+	DestroyPendingEntities();
+	UpdateTransforms();
+	ExtractRenderList();
+
+	m_SystemScheduler.Run(SystemPhase::PRE_RENDER);
+
+	for (auto& invalidations : m_ShadowInvalidations)
+		invalidations.clear();
 }
 
 void Scene::Render()
 {
-	m_ChangedSinceLastFrame = false;
-
 	m_CameraVertexUniformBuffer->Bind();
 	m_CameraVertexUniformBuffer->SetUniform(0, sizeof(glm::mat4), glm::value_ptr(m_Camera->GetViewProjectionMatrix()));
 	m_CameraVertexUniformBuffer->SetUniform(GLSL_MAT4_SIZE, sizeof(glm::mat4), glm::value_ptr(m_Camera->GetViewMatrix()));
@@ -69,15 +82,12 @@ void Scene::Render()
 	m_CameraFragmentUniformBuffer->SetUniform(0, sizeof(glm::vec3), glm::value_ptr(m_Camera->Position));
 	m_CameraFragmentUniformBuffer->Unbind();
 	
-	int pointLightsCount = GetComponentsCount<PointLight>();
-	int spotLightsCount = GetComponentsCount<SpotLight>();
+	UpdateFrameLights();
 
 	m_LightsFragmentUniformBuffer->Bind();
-	m_LightsFragmentUniformBuffer->SetUniform(0, GLSL_SCALAR_SIZE, &pointLightsCount);
-	m_LightsFragmentUniformBuffer->SetUniform(GLSL_SCALAR_SIZE, GLSL_SCALAR_SIZE, &spotLightsCount);
+	m_LightsFragmentUniformBuffer->SetUniform(0, GLSL_SCALAR_SIZE, &m_FrameLights.PointLightsCount);
+	m_LightsFragmentUniformBuffer->SetUniform(GLSL_SCALAR_SIZE, GLSL_SCALAR_SIZE, &m_FrameLights.SpotLightsCount);
 	m_LightsFragmentUniformBuffer->Unbind();
-
-	RenderEntity(GetRoot());
 }
 
 void Scene::Destroy()
@@ -88,7 +98,7 @@ void Scene::BeginPlay()
 {
 	m_Camera->BeginPlay();
 
-	for (auto entity : m_Entities)
+	for (auto& entity : m_Entities)
 	{
 		entity->BeginPlay();
 	}
@@ -98,37 +108,241 @@ void Scene::Tick(float deltaTime)
 {
 	m_Camera->Tick(deltaTime);
 
-	for (auto entity : m_Entities)
-	{
-		entity->Tick(deltaTime);
-	}
+	m_SystemScheduler.Run(SystemPhase::TICK, deltaTime);
 }
 
 void Scene::EndPlay()
 {
-	for (auto entity : m_Entities)
+	for (auto& entity : m_Entities)
 	{
 		entity->EndPlay();
 	}
 }
 
-void Scene::RenderEntity(Ref<Entity> entity)
+void Scene::UpdateFrameLights()
 {
-	if (!entity->IsEnable())
+	auto renderer = Renderer::GetInstance();
+
+	const auto& skyLights = GetComponents<SkyLight>();
+	m_FrameLights.IsSkyLight = !skyLights.empty();
+	if (m_FrameLights.IsSkyLight)
+	{
+		auto skyLight = std::static_pointer_cast<SkyLight>(skyLights[0]);
+		m_FrameLights.SkyLightIntensity = skyLight->GetIntensity();
+		m_FrameLights.IrradianceMap = skyLight->GetIrradianceMap();
+		m_FrameLights.PrefilterMap = skyLight->GetPrefilterMap();
+		m_FrameLights.BRDFLUT = skyLight->GetBRDFLUT();
+	}
+	else
 	{
-		if (auto light = entity->GetComponent<Light>())
-			light->SwitchOff();
+		m_FrameLights.IrradianceMap = renderer->GetPointLightShadowMapPlaceholder(0);
+		m_FrameLights.PrefilterMap = renderer->GetPointLightShadowMapPlaceholder(0);
+		m_FrameLights.BRDFLUT = renderer->GetSpotLightShadowMapPlaceholder(0);
+	}
 
-		return;
+	for (int i = 0; i < MAX_POINT_LIGHTS; i++)
+		m_FrameLights.PointLightShadowMaps[i] = renderer->GetPointLightShadowMapPlaceholder(i);
+	for (int i = 0; i < MAX_SPOT_LIGHTS; i++)
+		m_FrameLights.SpotLightShadowMaps[i] = renderer->GetSpotLightShadowMapPlaceholder(i);
+
+	// Shadow maps go to the slot matching the light's index in the lights uniform buffer
+	const auto& pointLights = GetComponents<PointLight>();
+	for (auto& c : pointLights)
+	{
+		auto pointLight = std::static_pointer_cast<PointLight>(c);
+		if (pointLight->GetIndex() < MAX_POINT_LIGHTS)
+			m_FrameLights.PointLightShadowMaps[pointLight->GetIndex()] = pointLight->GetShadowMap();
+	}
+
+	const auto& spotLights = GetComponents<SpotLight>();
+	for (auto& c : spotLights)
+	{
+		auto spotLight = std::static_pointer_cast<SpotLight>(c);
+		if (spotLight->GetIndex() < MAX_SPOT_LIGHTS)
+			m_FrameLights.SpotLightShadowMaps[spotLight->GetIndex()] = spotLight->GetShadowMap();
+	}
+
+	m_FrameLights.PointLightsCount = pointLights.size();
+	m_FrameLights.SpotLightsCount = spotLights.size();
+}
+
+void Scene::UpdateTransforms()
+{
+	bool transformsResolved = m_TransformsDirty;
+	if (m_TransformsDirty)
+		ResolveWorldTransforms();
+
+	if (transformsResolved || m_BoundsDirty)
+		UpdateBounds(transformsResolved);
+}
+
+void Scene::ResolveWorldTransforms()
+{
+	if (m_HierarchyDirty)
+		RebuildTransformHierarchy();
+
+	TransformHierarchy& h = m_TransformHierarchy;
+	for (size_t i = 0; i < h.Entities.size(); i++)
+	{
+		Entity* entity = h.Entities[i];
+		int32_t parent = h.Parents[i];
+
+		h.Dirty[i] = entity->m_TransformDirty || (parent >= 0 && h.Dirty[parent]);
+		if (!h.Dirty[i])
+			continue;
+
+		Transform& transform = entity->m_Transform;
+		if (parent >= 0)
+		{
+			h.WorldMatrices[i] = h.WorldMatrices[parent] * transform.GetLocalModelMatrix();
+			h.WorldPositions[i] = h.WorldPositions[parent] + transform.LocalPosition;
+			h.WorldRotations[i] = h.WorldRotations[parent] + transform.LocalRotation;
+		}
+		else
+		{
+			h.WorldMatrices[i] = transform.GetLocalModelMatrix();
+			h.WorldPositions[i] = transform.LocalPosition;
+			h.WorldRotations[i] = transform.LocalRotation;
+		}
+
+		transform.ModelMatrix = h.WorldMatrices[i];
+		entity->m_TransformDirty = false;
+	}
+
+	m_TransformsDirty = false;
+}
+
+void Scene::UpdateBounds(bool transformsResolved)
+{
+	const TransformHierarchy& h = m_TransformHierarchy;
+	const ComponentPool& pool = m_ComponentPools[ComponentType::Get<StaticMeshComponent>()];
+
+	for (size_t i = 0; i < pool.Components.size(); i++)
+	{
+		auto smc = static_cast<StaticMeshComponent*>(pool.Components[i].get());
+		uint32_t index = pool.Owners[i]->m_TransformIndex;
+		if (index >= h.Entities.size())
+			continue;
+
+		// Dirty flags are only fresh right after the transform pass
+		bool moved = transformsResolved && h.Dirty[index];
+		if (!moved && !smc->m_BoundsDirty)
+			continue;
+
+		AABB bounds = smc->m_LocalBounds.Transformed(h.WorldMatrices[index]);
+		if (smc->m_BoundsProxy < 0)
+			smc->m_BoundsProxy = m_BVH.CreateProxy(bounds, smc);
+		else
+			m_BVH.UpdateProxy(smc->m_BoundsProxy, bounds);
+
+		// Both where the caster was and where it is now may be covered by a shadow map
+		if (smc->CastsShadows())
+		{
+			InvalidateShadows(smc->m_WorldBounds, pool.Owners[i]->GetMobility());
+			InvalidateShadows(bounds, pool.Owners[i]->GetMobility());
+		}
+		smc->m_WorldBounds = bounds;
+
+		smc->m_BoundsDirty = false;
+	}
+
+	if (m_BVH.NeedsRebuild())
+		m_BVH.Rebuild();
+
+	m_BoundsDirty = false;
+}
+
+void Scene::ExtractRenderList()
+{
+	m_RenderList.Clear();
+
+	const TransformHierarchy& h = m_TransformHierarchy;
+	m_RenderList.Visible.resize(h.Entities.size());
+
+	const ComponentTypeID staticMeshType = ComponentType::Get<StaticMeshComponent>();
+
+	for (size_t i = 0; i < h.Entities.size(); i++)
+	{
+		Entity* entity = h.Entities[i];
+		int32_t parent = h.Parents[i];
+
+		if (!entity->IsEnable())
+		{
+			if (auto light = entity->GetComponent<Light>())
+				light->SwitchOff();
+		}
+
+		// Parents come first, so a disabled entity hides its whole subtree
+		m_RenderList.Visible[i] = entity->IsEnable() && (parent < 0 || m_RenderList.Visible[parent]);
+		if (!m_RenderList.Visible[i])
+			continue;
+
+		for (auto rc : entity->m_RenderComponents)
+		{
+			// Static meshes are extracted from their pool below
+			if (rc->IsOfType(staticMeshType))
+				continue;
+
+			m_RenderList.Components.push_back(rc);
+		}
+	}
+
+	const ComponentPool& instancedMeshes = m_ComponentPools[ComponentType::Get<InstanceRenderedMeshComponent>()];
+	for (size_t p = 0; p < instancedMeshes.Components.size(); p++)
+	{
+		Entity* owner = instancedMeshes.Owners[p];
+		uint32_t index = owner->m_TransformIndex;
+		if (index >= h.Entities.size() || !m_RenderList.Visible[index])
+			continue;
+
+		auto irmc = static_cast<InstanceRenderedMeshComponent*>(instancedMeshes.Components[p].get());
+		if (!irmc->CastsShadows())
+			continue;
+
+		m_RenderList.InstancedShadowCasters.push_back(irmc);
+		m_RenderList.InstancedShadowCastersMobility.push_back(owner->GetMobility());
+		m_RenderList.InstancedShadowCastersBounds.Add(irmc->GetInstancesBounds());
 	}
 
-	entity->Render();
+	const ComponentPool& staticMeshes = m_ComponentPools[staticMeshType];
+	for (size_t p = 0; p < staticMeshes.Components.size(); p++)
+	{
+		Entity* owner = staticMeshes.Owners[p];
+		uint32_t index = owner->m_TransformIndex;
+		if (index >= h.Entities.size() || !m_RenderList.Visible[index])
+			continue;
+
+		auto smc = static_cast<StaticMeshComponent*>(staticMeshes.Components[p].get());
+		if (smc->m_Materials.empty())
+			continue;
+
+		for (size_t m = 0; m < smc->m_Meshes.size(); m++)
+		{
+			// Meshes without their own material keep using the last one
+			Material* material = smc->m_Materials[std::min(m, smc->m_Materials.size() - 1)].get();
+
+			DrawItem item;
+			item.SourceMesh = &smc->m_Meshes[m];
+			item.SourceMaterial = material;
+			item.Owner = owner;
+			item.ModelMatrix = h.WorldMatrices[index];
+			item.CastShadows = smc->CastsShadows();
+			m_RenderList.Items.push_back(item);
+		}
+	}
 
-	if (!entity->GetChildren().empty())
+	m_RenderList.Bounds.Reserve(m_RenderList.Items.size());
+	for (uint32_t i = 0; i < m_RenderList.Items.size(); i++)
 	{
-		for (auto child : entity->GetChildren())
+		const DrawItem& item = m_RenderList.Items[i];
+		AABB bounds = item.SourceMesh->GetBounds().Transformed(item.ModelMatrix);
+		m_RenderList.Bounds.Add(bounds);
+
+		if (item.CastShadows)
 		{
-			RenderEntity(CreateRef<Entity>(*child));
+			m_RenderList.ShadowCasters.push_back(i);
+			m_RenderList.ShadowCastersMobility.push_back(item.Owner->GetMobility());
+			m_RenderList.ShadowCastersBounds.Add(bounds);
 		}
 	}
 }
@@ -138,71 +352,351 @@ Ref<Entity> Scene::AddRoot()
 	Ref<Entity> root = Entity::Create(this, "Root");
 	m_Root = root;
 	m_Entities.push_back(root);
+	IndexEntity(root);
+	MarkHierarchyDirty();
 
 	return root;
 }
 
 Ref<Entity> Scene::AddEntity(std::string name)
 {
-	Ref<Entity> entity = Entity::Create(this, name);
+	Ref<Entity> entity = Entity::Create(this, std::move(name));
 	entity->SetParent(m_Root.get());
 	m_Entities.push_back(entity);
-
-	return entity;
-}
-
-Ref<Entity> Scene::AddEntity(uint64_t id, std::string name)
-{
-	Ref<Entity> entity = Entity::Create(this, id, name);
-	Entity* root = m_Root.get();
-	entity->SetParent(root);
-	m_Entities.push_back(entity);
+	IndexEntity(entity);
 
 	return entity;
 }
 
 Ref<Entity> Scene::AddEntity(std::string path, std::string name)
 {
-	Ref<Entity> entity = Entity::Create(this, name);
+	Ref<Entity> entity = Entity::Create(this, std::move(name));
 	entity->SetParent(m_Root.get());
-	entity->AddComponent<StaticMeshComponent>(path.c_str());
+	entity->AddComponent<StaticMeshComponent>(std::move(path));
 	m_Entities.push_back(entity);
+	IndexEntity(entity);
 
 	return entity;
 }
 
 Ref<Entity> Scene::AddEntity(std::string path, std::string name, Ref<Entity> parent)
 {
-	Ref<Entity> entity = Entity::Create(this, name);
+	Ref<Entity> entity = Entity::Create(this, std::move(name));
 	entity->SetParent(parent.get());
-	entity->AddComponent<StaticMeshComponent>(path.c_str());
+	entity->AddComponent<StaticMeshComponent>(std::move(path));
 	m_Entities.push_back(entity);
+	IndexEntity(entity);
 
 	return entity;
 }
 
 void Scene::RemoveEntity(Ref<Entity> entity)
 {
+	if (!entity || entity == m_Root)
+		return;
+
+	m_PendingRemovals.push_back(entity->GetHandle());
 }
 
-Ref<Entity> Scene::FindEntity(std::string name)
+void Scene::DestroyPendingEntities()
+{
+	if (m_PendingRemovals.empty())
+		return;
+
+	// Gather every queued entity with its subtree, parents before children
+	FrameVector<Entity*> destroyed;
+	for (auto handle : m_PendingRemovals)
+	{
+		Entity* entity = GetEntity(handle);
+		if (!entity || entity->m_PendingDestroy)
+			continue;
+
+		size_t first = destroyed.size();
+		entity->m_PendingDestroy = true;
+		destroyed.push_back(entity);
+
+		for (size_t i = first; i < destroyed.size(); i++)
+		{
+			for (auto child : destroyed[i]->m_Children)
+			{
+				if (child->m_PendingDestroy)
+					continue;
+
+				child->m_PendingDestroy = true;
+				destroyed.push_back(child);
+			}
+		}
+	}
+	m_PendingRemovals.clear();
+
+	for (auto entity : destroyed)
+	{
+		// Releases the GPU resources of each component and frees its pool slots
+		while (!entity->m_Components.empty())
+			entity->RemoveComponent(entity->m_Components.back());
+
+		Entity* parent = entity->m_Parent;
+		if (parent && !parent->m_PendingDestroy)
+			parent->m_Children.erase(std::remove(parent->m_Children.begin(), parent->m_Children.end(), entity), parent->m_Children.end());
+
+		UnindexEntity(entity);
+		m_SerializedIDs.erase(entity->GetID());
+	}
+
+	// One compaction pass for the whole batch, the entities are freed once nothing else holds them
+	m_Entities.erase(std::remove_if(m_Entities.begin(), m_Entities.end(),
+		[](const Ref<Entity>& e) { return e->m_PendingDestroy; }), m_Entities.end());
+	m_Memory->ReleaseEmptyChunks();
+
+	MarkHierarchyDirty();
+}
+
+void Scene::InvalidateShadows(const AABB& bounds, Mobility mobility)
+{
+	if (bounds.IsValid())
+		m_ShadowInvalidations[(size_t)mobility].push_back(bounds);
+}
+
+uint32_t Scene::RegisterComponent(ComponentTypeID type, Entity* owner, Ref<Component> component)
+{
+	ComponentPool& pool = m_ComponentPools[type];
+	pool.Components.push_back(component);
+	pool.Owners.push_back(owner);
+
+	return pool.Components.size() - 1;
+}
+
+void Scene::UnregisterComponent(ComponentTypeID type, uint32_t index)
 {
-	for (auto entity : m_Entities)
+	ComponentPool& pool = m_ComponentPools[type];
+
+	if (type == ComponentType::Get<StaticMeshComponent>())
 	{
-		if (entity->GetName() == name)
-			return entity;
+		auto smc = static_cast<StaticMeshComponent*>(pool.Components[index].get());
+		if (smc->m_BoundsProxy >= 0)
+			m_BVH.DestroyProxy(smc->m_BoundsProxy);
+		if (smc->CastsShadows())
+			InvalidateShadows(smc->m_WorldBounds, pool.Owners[index]->GetMobility());
+
+		smc->m_BoundsProxy = -1;
+		smc->m_WorldBounds = AABB();
+		smc->m_BoundsDirty = true;
 	}
 
-	return Ref<Entity>();
+	uint32_t last = pool.Components.size() - 1;
+	if (index != last)
+	{
+		pool.Components[index] = pool.Components[last];
+		pool.Owners[index] = pool.Owners[last];
+		pool.Owners[index]->m_ComponentIndices[type] = index;
+	}
+
+	pool.Components.pop_back();
+	pool.Owners.pop_back();
+
+	if (type == ComponentType::Get<PointLight>() || type == ComponentType::Get<SpotLight>())
+		ReindexLights();
+}
+
+Ref<Entity> Scene::FindEntity(std::string name)
+{
+	auto it = m_EntityNameIndex.find(name);
+	if (it == m_EntityNameIndex.end() || it->second.empty())
+		return Ref<Entity>();
+
+	return it->second.front()->shared_from_this();
 }
 
 Ref<Entity> Scene::FindEntity(uint64_t id)
 {
-	for (auto entity : m_Entities)
+	Entity* entity = GetEntity(EntityHandle(id));
+	return entity ? entity->shared_from_this() : Ref<Entity>();
+}
+
+std::vector<Ref<Entity>> Scene::FindEntities(std::string name)
+{
+	std::vector<Ref<Entity>> entities;
+
+	auto it = m_EntityNameIndex.find(name);
+	if (it != m_EntityNameIndex.end())
+	{
+		for (auto entity : it->second)
+			entities.push_back(entity->shared_from_this());
+	}
+
+	return entities;
+}
+
+Entity* Scene::GetEntity(EntityHandle handle) const
+{
+	if (handle.Index >= m_EntitySlots.size())
+		return nullptr;
+
+	const EntitySlot& slot = m_EntitySlots[handle.Index];
+	return slot.Generation == handle.Generation ? slot.Instance : nullptr;
+}
+
+bool Scene::IsValid(EntityHandle handle) const
+{
+	return GetEntity(handle) != nullptr;
+}
+
+void Scene::UpdateEntityName(Entity* entity, std::string_view previousName)
+{
+	auto it = m_EntityNameIndex.find(previousName);
+	if (it == m_EntityNameIndex.end())
+		return;
+
+	auto& entities = it->second;
+	auto e = std::find(entities.begin(), entities.end(), entity);
+	if (e == entities.end())
+		return;
+
+	entities.erase(e);
+	if (entities.empty())
+		m_EntityNameIndex.erase(it);
+
+	m_EntityNameIndex[entity->GetName()].push_back(entity);
+}
+
+size_t Scene::GetEntityIndexMemoryUsage() const
+{
+	size_t size = m_EntitySlots.capacity() * sizeof(EntitySlot) + m_FreeEntitySlots.capacity() * sizeof(uint32_t);
+
+	// Approximation of what the name index allocates: bucket array, nodes and per-name vectors
+	size += m_EntityNameIndex.bucket_count() * sizeof(void*);
+	for (auto& entry : m_EntityNameIndex)
+	{
+		size += sizeof(std::pair<const std::string_view, std::vector<Entity*>>) + sizeof(void*) + sizeof(size_t);
+		size += entry.second.capacity() * sizeof(Entity*);
+	}
+
+	return size;
+}
+
+void Scene::RegisterSystems()
+{
+	// Component types without a system here get one calling their virtual method when first added,
+	// the ones doing nothing in a phase are skipped so they cost nothing per frame
+	SystemAccess particles;
+	particles.Reads = SystemScheduler::Mask<Transform>();
+	particles.Writes = SystemScheduler::Mask<ParticleSystemComponent>();
+	m_SystemScheduler.AddComponentSystem<ParticleSystemComponent>(SystemPhase::UPDATE, "Particles", particles,
+		[](ParticleSystemComponent* psc) { psc->ParticleSystemComponent::Update(); });
+
+	// Uploads light uniforms and renders shadow maps
+	SystemAccess lights;
+	lights.Reads = SystemScheduler::Mask<Transform>();
+	lights.Writes = SystemScheduler::Mask<Light>();
+	m_SystemScheduler.AddComponentSystem<Light>(SystemPhase::PRE_RENDER, "Lights", lights,
+		[](Light* light) { light->Light::PreRender(); });
+
+	m_SystemScheduler.SkipComponent<StaticMeshComponent>(SystemPhase::UPDATE);
+	m_SystemScheduler.SkipComponent<StaticMeshComponent>(SystemPhase::PRE_RENDER);
+	m_SystemScheduler.SkipComponent<InstanceRenderedMeshComponent>(SystemPhase::UPDATE);
+	m_SystemScheduler.SkipComponent<InstanceRenderedMeshComponent>(SystemPhase::PRE_RENDER);
+	m_SystemScheduler.SkipComponent<ParticleSystemComponent>(SystemPhase::PRE_RENDER);
+	m_SystemScheduler.SkipComponent<PlayerComponent>(SystemPhase::UPDATE);
+	m_SystemScheduler.SkipComponent<PlayerComponent>(SystemPhase::TICK);
+	m_SystemScheduler.SkipComponent<Light>(SystemPhase::UPDATE);
+	m_SystemScheduler.SkipComponent<SkyLight>(SystemPhase::UPDATE);
+	m_SystemScheduler.SkipComponent<SkyLight>(SystemPhase::PRE_RENDER);
+}
+
+void Scene::ReindexLights()
+{
+	// Lights occupy the first slots of the lights uniform buffer, matching the counts the shaders read
+	const auto& pointLights = GetComponents<PointLight>();
+	for (int i = 0; i < pointLights.size(); i++)
+		std::static_pointer_cast<PointLight>(pointLights[i])->SetIndex(i);
+
+	const auto& spotLights = GetComponents<SpotLight>();
+	for (int i = 0; i < spotLights.size(); i++)
+		std::static_pointer_cast<SpotLight>(spotLights[i])->SetIndex(i);
+}
+
+void Scene::RebuildTransformHierarchy()
+{
+	TransformHierarchy& h = m_TransformHierarchy;
+	h.Entities.clear();
+	h.Parents.clear();
+
+	if (m_Root)
+	{
+		h.Entities.push_back(m_Root.get());
+		h.Parents.push_back(-1);
+	}
+
+	// Breadth first, so every parent is resolved before its children
+	for (size_t i = 0; i < h.Entities.size(); i++)
+	{
+		Entity* entity = h.Entities[i];
+		entity->m_TransformIndex = i;
+		entity->m_TransformDirty = true;
+
+		for (auto child : entity->m_Children)
+		{
+			h.Entities.push_back(child);
+			h.Parents.push_back(i);
+		}
+	}
+
+	h.WorldMatrices.resize(h.Entities.size());
+	h.WorldPositions.resize(h.Entities.size());
+	h.WorldRotations.resize(h.Entities.size());
+	h.Dirty.resize(h.Entities.size());
+
+	m_HierarchyDirty = false;
+}
+
+void Scene::IndexEntity(Ref<Entity> entity)
+{
+	entity->m_Handle = AllocateEntitySlot(entity.get());
+	m_EntityNameIndex[entity->GetName()].push_back(entity.get());
+}
+
+void Scene::UnindexEntity(Entity* entity)
+{
+	ReleaseEntitySlot(entity->GetHandle());
+	entity->m_Handle = EntityHandle();
+
+	auto name = m_EntityNameIndex.find(entity->GetName());
+	if (name != m_EntityNameIndex.end())
+	{
+		auto& entities = name->second;
+		entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
+		if (entities.empty())
+			m_EntityNameIndex.erase(name);
+	}
+}
+
+EntityHandle Scene::AllocateEntitySlot(Entity* entity)
+{
+	uint32_t index;
+	if (!m_FreeEntitySlots.empty())
+	{
+		index = m_FreeEntitySlots.back();
+		m_FreeEntitySlots.pop_back();
+	}
+	else
 	{
-		if (entity->GetID() == id)
-			return entity;
+		index = m_EntitySlots.size();
+		m_EntitySlots.emplace_back();
 	}
 
-	return Ref<Entity>();
+	m_EntitySlots[index].Instance = entity;
+
+	return EntityHandle(index, m_EntitySlots[index].Generation);
 }
+
+void Scene::ReleaseEntitySlot(EntityHandle handle)
+{
+	if (!IsValid(handle))
+		return;
+
+	EntitySlot& slot = m_EntitySlots[handle.Index];
+	slot.Instance = nullptr;
+	slot.Generation++;
+
+	m_FreeEntitySlots.push_back(handle.Index);
+}
\ No newline at end of file
@@ -1,13 +1,42 @@
 #pragma once
 
+#include <unordered_map>
+
 #include "typedefs.h"
 #include "Camera.h"
 #include "Entity.h"
+#include "FrameLights.h"
+#include "RenderList.h"
+#include "BVH.h"
+#include "SystemScheduler.h"
 #include "Material/ShaderLibrary.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/UniformBuffer.h"
 #include "Renderer/Framebuffer.h"
 
+struct EntitySlot
+{
+	Entity* Instance = nullptr;
+	uint32_t Generation = 0;
+};
+
+struct ComponentPool
+{
+	std::vector<Ref<Component>> Components;
+	std::vector<Entity*> Owners;
+};
+
+// World transforms of all entities, ordered so that parents always come before their children
+struct TransformHierarchy
+{
+	std::vector<Entity*> Entities;
+	std::vector<int32_t> Parents;
+	std::vector<glm::mat4> WorldMatrices;
+	std::vector<glm::vec3> WorldPositions;
+	std::vector<glm::vec3> WorldRotations;
+	std::vector<uint8_t> Dirty;
+};
+
 class Scene
 {
 public:
@@ -18,18 +47,43 @@ public:
 	unsigned int m_BRDFLUT;
 
 private:
+	// Declared first so it is created before and released after everything allocated from it
+	std::unique_ptr<SceneMemory> m_Memory;
 	Ref<Camera> m_Camera;
 	Ref<Entity> m_Root;
 	std::vector<Ref<Entity>> m_Entities;
+	std::vector<EntitySlot> m_EntitySlots;
+	std::vector<uint32_t> m_FreeEntitySlots;
+	std::vector<EntityHandle> m_PendingRemovals;
+	// Keyed by the names in the scene memory, which live as long as the scene
+	std::unordered_map<std::string_view, std::vector<Entity*>> m_EntityNameIndex;
+	// Entity IDs of the scene file by handle ID, so saving writes back the IDs that were loaded
+	std::unordered_map<uint64_t, uint64_t> m_SerializedIDs;
+	uint64_t m_NextSerializedID = 1;
 	glm::vec4 m_BackgroundColor;
 
+	std::array<ComponentPool, MAX_COMPONENT_TYPES> m_ComponentPools;
+	FrameLights m_FrameLights;
+
+	TransformHierarchy m_TransformHierarchy;
+	bool m_TransformsDirty = true;
+	bool m_HierarchyDirty = true;
+
+	// World space bounds of static meshes, refitted by UpdateTransforms
+	BVH m_BVH;
+	bool m_BoundsDirty = false;
+
+	RenderList m_RenderList;
+	// World bounds of shadow casters which moved, appeared or disappeared since the last shadow pass, per mobility.
+	// Lights only re-render the matching layer of their shadow map when one of them is inside their shadow volume
+	std::array<std::vector<AABB>, 2> m_ShadowInvalidations;
+	SystemScheduler m_SystemScheduler;
+
 	Ref<UniformBuffer> m_CameraVertexUniformBuffer;
 	Ref<UniformBuffer> m_LightsVertexUniformBuffer;
 	Ref<UniformBuffer> m_CameraFragmentUniformBuffer;
 	Ref<UniformBuffer> m_LightsFragmentUniformBuffer;
 
-	bool m_ChangedSinceLastFrame = false;
-
 public:
 	Scene();
 
@@ -44,64 +98,90 @@ public:
 	void Tick(float deltaTime);
 	void EndPlay();
 
-	void RenderEntity(Ref<Entity> entity);
+	void UpdateFrameLights();
+	void UpdateTransforms();
+	void ExtractRenderList();
 
 	Ref<Entity> AddRoot();
 	Ref<Entity> AddEntity(std::string name);
-	Ref<Entity> AddEntity(uint64_t id, std::string name);
 	Ref<Entity> AddEntity(std::string path, std::string name);
 	Ref<Entity> AddEntity(std::string path, std::string name, Ref<Entity> parent);
 
+	// Removal is deferred, the entity and its children are destroyed at the start of the next Update or PreRender
 	void RemoveEntity(Ref<Entity> entity);
+	void DestroyPendingEntities();
 	Ref<Entity> FindEntity(std::string name);
 	Ref<Entity> FindEntity(uint64_t id);
+	std::vector<Ref<Entity>> FindEntities(std::string name);
+	Entity* GetEntity(EntityHandle handle) const;
+	bool IsValid(EntityHandle handle) const;
+
+	void UpdateEntityName(Entity* entity, std::string_view previousName);
+	size_t GetEntityIndexMemoryUsage() const;
+
+	void InvalidateShadows(const AABB& bounds, Mobility mobility);
+
+	uint32_t RegisterComponent(ComponentTypeID type, Entity* owner, Ref<Component> component);
+	void UnregisterComponent(ComponentTypeID type, uint32_t index);
 
 	template<typename T>
-	std::vector<Ref<Component>> GetComponents()
+	const std::vector<Ref<Component>>& GetComponents() const
 	{
-		std::vector<Ref<Component>> components;
-		for (auto entity : m_Entities)
-		{
-			if (auto c = entity->GetComponent<T>())
-				components.push_back(c);
-		}
+		return m_ComponentPools[ComponentType::Get<T>()].Components;
+	}
 
-		return components;
+	template<typename T>
+	const std::vector<Entity*>& GetComponentOwners() const
+	{
+		return m_ComponentPools[ComponentType::Get<T>()].Owners;
 	}
 
 	template<typename T>
 	std::vector<Ref<Entity>> GetEntitiesWithComponent()
 	{
 		std::vector<Ref<Entity>> entities;
-		for (auto entity : m_Entities)
+		for (auto owner : m_ComponentPools[ComponentType::Get<T>()].Owners)
 		{
-			if (entity->GetComponent<T>())
-				entities.push_back(entity);
+			entities.push_back(owner->shared_from_this());
 		}
 
 		return entities;
 	}
 
 	template<typename T>
-	int GetComponentsCount()
+	int GetComponentsCount() const
 	{
-		int count = 0;
-		for (auto entity : m_Entities)
-		{
-			if (entity->GetComponent<T>())
-				count++;
-		}
-
-		return count;
+		return m_ComponentPools[ComponentType::Get<T>()].Components.size();
 	}
 
+	inline SceneMemory* GetMemory() const { return m_Memory.get(); }
+	inline const ComponentPool& GetComponentPool(ComponentTypeID type) const { return m_ComponentPools[type]; }
 	inline Ref<Camera> GetCamera() const { return m_Camera; }
 	inline Ref<Entity> GetRoot() const { return m_Root; }
-	inline std::vector<Ref<Entity>> GetEntities() const { return m_Entities; }
+	inline const std::vector<Ref<Entity>>& GetEntities() const { return m_Entities; }
+	inline const FrameLights& GetFrameLights() const { return m_FrameLights; }
+	inline const RenderList& GetRenderList() const { return m_RenderList; }
+	inline const BVH& GetBVH() const { return m_BVH; }
+	inline const std::vector<AABB>& GetShadowInvalidations(Mobility mobility) const { return m_ShadowInvalidations[(size_t)mobility]; }
+	inline SystemScheduler& GetSystemScheduler() { return m_SystemScheduler; }
 	inline glm::vec4* GetBackgroundColor() { return &m_BackgroundColor; }
-	inline bool IsChangedSinceLastFrame() const { return m_ChangedSinceLastFrame; }
+	inline const TransformHierarchy& GetTransformHierarchy() const { return m_TransformHierarchy; }
+	inline bool AreTransformsDirty() const { return m_TransformsDirty; }
+
+	inline void MarkTransformsDirty() { m_TransformsDirty = true; }
+	inline void MarkHierarchyDirty() { m_HierarchyDirty = true; m_TransformsDirty = true; }
+	inline void MarkBoundsDirty() { m_BoundsDirty = true; }
 
-	inline void SetChangedSinceLastFrame(bool changed) { m_ChangedSinceLastFrame = changed; }
+private:
+	void RegisterSystems();
+	void ReindexLights();
+	void RebuildTransformHierarchy();
+	void ResolveWorldTransforms();
+	void UpdateBounds(bool transformsResolved);
+	void IndexEntity(Ref<Entity> entity);
+	void UnindexEntity(Entity* entity);
+	EntityHandle AllocateEntitySlot(Entity* entity);
+	void ReleaseEntitySlot(EntityHandle handle);
 
 	friend class SceneSerializer;
 	friend class WorldSettingsPanel;
@@ -1,5 +1,7 @@
 #include "SceneSerializer.h"
 
+#include <algorithm>
+
 #include "yaml/yaml.h"
 #include "Scene/Component/StaticMeshComponent.h"
 #include "Scene/Component/InstanceRenderedMeshComponent.h"
@@ -10,7 +12,7 @@
 #include "Scene/Component/ParticleSystemComponent.h"
 #include "Scene/Component/PlayerComponent.h"
 
-void SceneSerializer::Serialize(Ref<Scene> scene)
+void SceneSerializer::Serialize(Ref<Scene> scene, std::string path)
 {
 	YAML::Emitter out;
 	out << YAML::BeginMap;
@@ -23,14 +25,14 @@ void SceneSerializer::Serialize(Ref<Scene> scene)
 	out << YAML::Key << "Movement Speed" << YAML::Value << scene->m_Camera->MovementSpeed;
 	out << YAML::EndMap;
 	out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
-	for (auto entity : scene->GetEntities())
+	for (auto& entity : scene->GetEntities())
 	{
-		SerializeEntity(out, entity);
+		SerializeEntity(out, scene.get(), entity);
 	}
 	out << YAML::EndSeq;
 	out << YAML::EndMap;
 
-	std::ofstream file("../../res/scenes/Showcase.scene");
+	std::ofstream file(path);
 	file << out.c_str();
 	file.close();
 }
@@ -69,6 +71,8 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 	if (entities)
 	{
 		auto parentsIDs = std::vector<uint64_t>();
+		// Entities get new handles on load, the scene remembers the file IDs to write them back on save
+		auto handles = std::unordered_map<uint64_t, EntityHandle>();
 
 		for (auto entity : entities)
 		{
@@ -84,10 +88,13 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 					std::cout << "Loaded scene doesn't contain root entity!" << std::endl;
 				}
 
-				e = scene->AddEntity(entity["ID"].as<uint64_t>(), entity["Entity"].as<std::string>());
+				e = scene->AddEntity(entity["Entity"].as<std::string>());
 			}
 			
-			e->SetID(entity["ID"].as<uint64_t>());
+			uint64_t id = entity["ID"].as<uint64_t>();
+			handles[id] = e->GetHandle();
+			scene->m_SerializedIDs[e->GetID()] = id;
+			scene->m_NextSerializedID = std::max(scene->m_NextSerializedID, id + 1);
 			
 			if (auto parent = entity["Parent"])
 			{
@@ -103,6 +110,9 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 			e->SetLocalRotation(transform["Rotation"].as<glm::vec3>());
 			e->SetLocalScale(transform["Scale"].as<glm::vec3>());
 
+			if (auto mobility = entity["Mobility"])
+				e->SetMobility(mobility.as<std::string>() == "Movable" ? Mobility::MOVABLE : Mobility::STATIC);
+
 			if (auto mesh = entity["Model"])
 			{
 				std::string path = mesh["Mesh"].as<std::string>();
@@ -113,7 +123,9 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 					materialsPaths.push_back(material["Path"].as<std::string>());
 
 				}
-				e->AddComponent<StaticMeshComponent>(path.c_str(), materialsPaths);
+				auto m = e->AddComponent<StaticMeshComponent>(path.c_str(), materialsPaths);
+				if (auto castShadows = mesh["Cast Shadows"])
+					m->SetCastShadows(castShadows.as<bool>());
 			}
 
 			if (auto mesh = entity["Instance Rendered Mesh"])
@@ -136,6 +148,10 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 				m->m_InstancesCount = count;
 				m->m_MinMeshScale = minScale;
 				m->m_MaxMeshScale = maxScale;
+				if (auto seed = mesh["Seed"])
+					m->m_Seed = seed.as<uint32_t>();
+				if (auto castShadows = mesh["Cast Shadows"])
+					m->SetCastShadows(castShadows.as<bool>());
 				m->Generate();
 			}
 
@@ -201,7 +217,11 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 			if (parentsIDs[i] == -1)
 				continue;
 
-			scene->GetEntities()[i]->SetParent(scene->FindEntity(parentsIDs[i]).get());
+			auto parent = handles.find(parentsIDs[i]);
+			if (parent == handles.end())
+				continue;
+
+			scene->GetEntities()[i]->SetParent(scene->GetEntity(parent->second));
 		}
 	}
 
@@ -209,21 +229,22 @@ Ref<Scene> SceneSerializer::Deserialize(std::string path)
 	return scene;
 }
 
-void SceneSerializer::SerializeEntity(YAML::Emitter& out, Ref<Entity> entity)
+void SceneSerializer::SerializeEntity(YAML::Emitter& out, Scene* scene, Ref<Entity> entity)
 {
 	out << YAML::BeginMap;
-	out << YAML::Key << "Entity" << YAML::Value << entity->GetName();
-	out << YAML::Key << "ID" << YAML::Value << entity->GetID();
+	out << YAML::Key << "Entity" << YAML::Value << std::string(entity->GetName());
+	out << YAML::Key << "ID" << YAML::Value << GetSerializedID(scene, entity.get());
 	if (entity->GetParent())
-		out << YAML::Key << "Parent" << YAML::Value << entity->GetParent()->GetID();
+		out << YAML::Key << "Parent" << YAML::Value << GetSerializedID(scene, entity->GetParent());
 
-	Transform transform = entity->GetTransform();
+	const Transform& transform = entity->GetTransform();
 	out << YAML::Key << "Transform";
 	out << YAML::BeginMap;
 	out << YAML::Key << "Position" << YAML::Value << transform.LocalPosition;
 	out << YAML::Key << "Rotation" << YAML::Value << transform.LocalRotation;
 	out << YAML::Key << "Scale" << YAML::Value << transform.LocalScale;
 	out << YAML::EndMap;
+	out << YAML::Key << "Mobility" << YAML::Value << (entity->GetMobility() == Mobility::MOVABLE ? "Movable" : "Static");
 
 	if (auto mesh = entity->GetComponent<StaticMeshComponent>())
 	{
@@ -239,6 +260,7 @@ void SceneSerializer::SerializeEntity(YAML::Emitter& out, Ref<Entity> entity)
 			out << YAML::EndMap;
 		}
 		out << YAML::EndSeq;
+		out << YAML::Key << "Cast Shadows" << YAML::Value << mesh->CastsShadows();
 		out << YAML::EndMap;
 	}
 	if (auto mesh = entity->GetComponent<InstanceRenderedMeshComponent>())
@@ -260,6 +282,8 @@ void SceneSerializer::SerializeEntity(YAML::Emitter& out, Ref<Entity> entity)
 		out << YAML::Key << "Instances Count" << YAML::Value << mesh->m_InstancesCount;
 		out << YAML::Key << "Min Mesh Scale" << YAML::Value << mesh->m_MinMeshScale;
 		out << YAML::Key << "Max Mesh Scale" << YAML::Value << mesh->m_MaxMeshScale;
+		out << YAML::Key << "Seed" << YAML::Value << mesh->m_Seed;
+		out << YAML::Key << "Cast Shadows" << YAML::Value << mesh->CastsShadows();
 
 
 		out << YAML::EndMap;
@@ -315,3 +339,20 @@ void SceneSerializer::SerializeEntity(YAML::Emitter& out, Ref<Entity> entity)
 
 	out << YAML::EndMap;
 }
+
+
+uint64_t SceneSerializer::GetSerializedID(Scene* scene, const Entity* entity)
+{
+	// Loading recognizes the root by its ID
+	if (entity == scene->GetRoot().get())
+		return 0;
+
+	auto id = scene->m_SerializedIDs.find(entity->GetID());
+	if (id != scene->m_SerializedIDs.end())
+		return id->second;
+
+	uint64_t newID = scene->m_NextSerializedID++;
+	scene->m_SerializedIDs[entity->GetID()] = newID;
+
+	return newID;
+}
\ No newline at end of file
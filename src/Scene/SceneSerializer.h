@@ -7,9 +7,11 @@
 class SceneSerializer
 {
 public:
-	static void Serialize(Ref<Scene> scene);
+	static void Serialize(Ref<Scene> scene, std::string path = "../../res/scenes/Showcase.scene");
 	static Ref<Scene> Deserialize(std::string path);
 
 private:
-	static void SerializeEntity(YAML::Emitter& out, Ref<Entity> entity);
+	static void SerializeEntity(YAML::Emitter& out, Scene* scene, Ref<Entity> entity);
+	// ID of the entity in the scene file, loaded entities keep theirs and new ones get the next free one
+	static uint64_t GetSerializedID(Scene* scene, const Entity* entity);
 };
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "SystemScheduler.h"
+
+#include "Scene.h"
+#include "Core/Jobs/JobSystem.h"
+
+SystemScheduler::SystemScheduler(Scene* scene)
+	: m_Scene(scene)
+{
+}
+
+void SystemScheduler::AddSystem(SystemPhase phase, System system)
+{
+	m_Systems[(size_t)phase].push_back(system);
+	BuildBatches(phase);
+}
+
+void SystemScheduler::Run(SystemPhase phase, float deltaTime)
+{
+	auto jobSystem = JobSystem::GetInstance();
+	auto& systems = m_Systems[(size_t)phase];
+
+	for (auto& batch : m_Batches[(size_t)phase])
+	{
+		JobCounter counter;
+		for (auto index : batch)
+		{
+			System* system = &systems[index];
+			if (!system->Access.MainThread)
+				jobSystem->Run([this, system, deltaTime]() { system->Execute(m_Scene, deltaTime); }, &counter);
+		}
+
+		for (auto index : batch)
+		{
+			if (systems[index].Access.MainThread)
+				systems[index].Execute(m_Scene, deltaTime);
+		}
+
+		jobSystem->Wait(&counter);
+	}
+}
+
+void SystemScheduler::BuildBatches(SystemPhase phase)
+{
+	auto& systems = m_Systems[(size_t)phase];
+	auto& batches = m_Batches[(size_t)phase];
+	batches.clear();
+
+	// Registration order is kept, a system only joins the current batch if it does not
+	// write anything the batch touches and does not read anything the batch writes
+	ComponentMask reads, writes;
+	for (uint32_t i = 0; i < systems.size(); i++)
+	{
+		const SystemAccess& access = systems[i].Access;
+		bool conflict = (access.Writes & (reads | writes)).any() || (access.Reads & writes).any();
+
+		if (batches.empty() || conflict)
+		{
+			batches.emplace_back();
+			reads.reset();
+			writes.reset();
+		}
+
+		batches.back().push_back(i);
+		reads |= access.Reads;
+		writes |= access.Writes;
+	}
+}
+
+const std::vector<Ref<Component>>& SystemScheduler::GetComponents(Scene* scene, ComponentTypeID type)
+{
+	return scene->GetComponentPool(type).Components;
+}
\ No newline at end of file
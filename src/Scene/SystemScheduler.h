@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "typedefs.h"
+#include "Scene/Component/Component.h"
+#include "Scene/Component/InGameComponent.h"
+#include "Scene/Component/RenderComponent.h"
+
+class Scene;
+
+enum class SystemPhase
+{
+	UPDATE, TICK, PRE_RENDER, COUNT
+};
+
+// What a system touches, systems of the same phase without conflicts run side by side
+struct SystemAccess
+{
+	ComponentMask Reads;
+	ComponentMask Writes;
+	// Systems using OpenGL (or other main thread only state) are never sent to the worker threads
+	bool MainThread = true;
+};
+
+struct System
+{
+	std::string Name;
+	SystemAccess Access;
+	std::function<void(Scene* scene, float deltaTime)> Execute;
+};
+
+class SystemScheduler
+{
+private:
+	Scene* m_Scene;
+	std::array<std::vector<System>, (size_t)SystemPhase::COUNT> m_Systems;
+	// Runs of consecutive systems without conflicting access, rebuilt whenever a system is added
+	std::array<std::vector<std::vector<uint32_t>>, (size_t)SystemPhase::COUNT> m_Batches;
+	// Component types whose work in a phase is done by a system, or which have none
+	std::array<ComponentMask, (size_t)SystemPhase::COUNT> m_Handled;
+	ComponentMask m_DefaultSystemsAdded;
+
+public:
+	SystemScheduler(Scene* scene);
+
+	void AddSystem(SystemPhase phase, System system);
+
+	// Calls function for every T component straight from the scene's contiguous component array,
+	// function takes the component and optionally the delta time
+	template<typename T, typename Function>
+	void AddComponentSystem(SystemPhase phase, std::string name, SystemAccess access, Function function)
+	{
+		ComponentTypeID type = ComponentType::Get<T>();
+		m_Handled[(size_t)phase].set(type);
+
+		System system;
+		system.Name = name;
+		system.Access = access;
+		system.Execute = [type, function](Scene* scene, float deltaTime)
+		{
+			for (auto& component : GetComponents(scene, type))
+			{
+				if constexpr (std::is_invocable_v<Function, T*, float>)
+					function(static_cast<T*>(component.get()), deltaTime);
+				else
+					function(static_cast<T*>(component.get()));
+			}
+		};
+
+		AddSystem(phase, system);
+	}
+
+	// Marks T as doing nothing in the phase, so it gets no default system
+	template<typename T>
+	void SkipComponent(SystemPhase phase)
+	{
+		m_Handled[(size_t)phase].set(ComponentType::Get<T>());
+	}
+
+	// Called when the first T is added. Every phase T takes part in which no system handles yet
+	// gets a system calling T's method, on the main thread and never batched with other systems.
+	template<typename T>
+	void AddDefaultSystems()
+	{
+		ComponentTypeID type = ComponentType::Get<T>();
+		if (m_DefaultSystemsAdded.test(type))
+			return;
+
+		m_DefaultSystemsAdded.set(type);
+
+		// Systems of the base type (e.g. Light) also cover T
+		ComponentMask handledBy = Mask<T>();
+		using Base = typename ComponentBase<T>::Type;
+		if constexpr (!std::is_void_v<Base>)
+			handledBy.set(ComponentType::Get<Base>());
+
+		SystemAccess access;
+		access.Reads.set();
+		access.Writes.set();
+
+		std::string name = "Component " + std::to_string(type);
+
+		if (!IsHandled(SystemPhase::UPDATE, handledBy))
+			AddComponentSystem<T>(SystemPhase::UPDATE, name, access, [](T* component) { component->T::Update(); });
+
+		if constexpr (std::is_base_of_v<InGameComponent, T>)
+		{
+			if (!IsHandled(SystemPhase::TICK, handledBy))
+				AddComponentSystem<T>(SystemPhase::TICK, name, access, [](T* component, float deltaTime) { component->T::Tick(deltaTime); });
+		}
+
+		if constexpr (std::is_base_of_v<RenderComponent, T>)
+		{
+			if (!IsHandled(SystemPhase::PRE_RENDER, handledBy))
+				AddComponentSystem<T>(SystemPhase::PRE_RENDER, name, access, [](T* component) { component->T::PreRender(); });
+		}
+	}
+
+	void Run(SystemPhase phase, float deltaTime = 0.0f);
+
+	inline const std::vector<System>& GetSystems(SystemPhase phase) const { return m_Systems[(size_t)phase]; }
+	// Indices into GetSystems(phase), batches run one after another
+	inline const std::vector<std::vector<uint32_t>>& GetBatches(SystemPhase phase) const { return m_Batches[(size_t)phase]; }
+
+	template<typename ... T>
+	static ComponentMask Mask()
+	{
+		ComponentMask mask;
+		(mask.set(ComponentType::Get<T>()), ...);
+
+		return mask;
+	}
+
+private:
+	void BuildBatches(SystemPhase phase);
+	inline bool IsHandled(SystemPhase phase, const ComponentMask& types) const { return (m_Handled[(size_t)phase] & types).any(); }
+
+	static const std::vector<Ref<Component>>& GetComponents(Scene* scene, ComponentTypeID type);
+};
\ No newline at end of file
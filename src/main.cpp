@@ -25,6 +25,8 @@
 #include "Scene/Component/Light/Light.h"
 #include "Renderer/Framebuffer.h"
 #include "Input/Input.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Memory/FrameMemory.h"
 
 #define FPS 60.0f
 #define MS_PER_UPDATE 1 / FPS
@@ -126,6 +128,9 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
     if (leftCtrlClicked && keyDClicked)
         Editor::GetInstance()->GetSceneHierarchyPanel()->DuplicateSelectedEntity();
 
+    if (key == GLFW_KEY_DELETE && action == GLFW_PRESS && !ImGui::GetIO().WantTextInput)
+        Editor::GetInstance()->GetSceneHierarchyPanel()->RemoveSelectedEntity();
+
     ImGui_ImplGlfw_KeyCallback(window, key, scancode, action, mods);
 }
 
@@ -200,6 +205,8 @@ int main(int, char**)
         return 1;
     }
 
+    JobSystem::GetInstance()->Initialize();
+
     Renderer::GetInstance()->Initialize();
 
     Renderer::GetInstance()->InitializeMainSceneFramebuffer();
@@ -226,6 +233,8 @@ int main(int, char**)
     // Main loop
     while (!glfwWindowShouldClose(window))
     {
+        FrameMemory::BeginFrame();
+
         float currentFrame = glfwGetTime();
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
@@ -285,6 +294,8 @@ int main(int, char**)
 
     imGuiRenderer.CleanUp();
 
+    JobSystem::GetInstance()->Shutdown();
+
     glfwDestroyWindow(window);
     glfwTerminate();
 
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "Core/Jobs/JobSystem.h"
+
+template<typename Function>
+static double MeasureMilliseconds(Function&& function)
+{
+	auto start = std::chrono::steady_clock::now();
+	function();
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Cost of scheduling alone: many jobs doing nothing
+TEST(JobSystemBenchmark, EmptyJobsThroughput)
+{
+	JobSystem jobs;
+	jobs.Initialize();
+
+	const uint32_t jobsCount = 200000;
+	double milliseconds = MeasureMilliseconds([&]()
+	{
+		JobCounter counter;
+		for (uint32_t i = 0; i < jobsCount; i++)
+			jobs.Run([]() {}, &counter);
+
+		jobs.Wait(&counter);
+	});
+
+	printf("%u threads: %u empty jobs in %.2f ms, %.0f jobs/s\n",
+		jobs.GetThreadsCount(), jobsCount, milliseconds, jobsCount / milliseconds * 1000.0);
+
+	jobs.Shutdown();
+}
+
+// Work heavy enough to scale, compared against running the same loop on one thread
+TEST(JobSystemBenchmark, ParallelForSpeedup)
+{
+	const uint32_t count = 1 << 20;
+	std::vector<float> values(count);
+
+	auto work = [&values](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+			values[i] = std::sqrt((float)i) * std::sin((float)i);
+	};
+
+	double serial = MeasureMilliseconds([&]() { work(0, count); });
+
+	JobSystem jobs;
+	jobs.Initialize();
+
+	for (uint32_t minChunkSize : { 64u, 1024u, 16384u })
+	{
+		double parallel = MeasureMilliseconds([&]() { jobs.ParallelFor(count, work, minChunkSize); });
+
+		printf("%u threads, min chunk %u: %.2f ms serial, %.2f ms parallel, %.2fx\n",
+			jobs.GetThreadsCount(), minChunkSize, serial, parallel, serial / parallel);
+	}
+
+	jobs.Shutdown();
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "Core/Jobs/JobSystem.h"
+
+TEST(JobSystemTests, RunsEveryJobBeforeTheCounterIsDone)
+{
+	JobSystem jobs;
+	jobs.Initialize(3);
+
+	std::atomic<int> runs{ 0 };
+	JobCounter counter;
+	for (int i = 0; i < 1000; i++)
+		jobs.Run([&runs]() { runs++; }, &counter);
+
+	jobs.Wait(&counter);
+	EXPECT_TRUE(counter.IsDone());
+	EXPECT_EQ(runs, 1000);
+
+	jobs.Shutdown();
+}
+
+TEST(JobSystemTests, CounterWaitsForChildJobs)
+{
+	JobSystem jobs;
+	jobs.Initialize(3);
+
+	std::atomic<int> runs{ 0 };
+	JobCounter counter;
+	for (int i = 0; i < 16; i++)
+	{
+		jobs.Run([&]()
+		{
+			for (int j = 0; j < 16; j++)
+				jobs.Run([&runs]() { runs++; }, &counter);
+		}, &counter);
+	}
+
+	jobs.Wait(&counter);
+	EXPECT_EQ(runs, 16 * 16);
+
+	jobs.Shutdown();
+}
+
+TEST(JobSystemTests, WaitRunsJobsOnTheCallingThread)
+{
+	JobSystem jobs;
+	jobs.Initialize(1);
+
+	// Keeps the only worker busy, the other job can only run inside Wait
+	std::atomic<bool> release{ false };
+	JobCounter blocker;
+	jobs.Run([&release]() { while (!release) std::this_thread::yield(); }, &blocker);
+
+	std::thread::id ranOn;
+	JobCounter counter;
+	jobs.Run([&ranOn]() { ranOn = std::this_thread::get_id(); }, &counter);
+
+	jobs.Wait(&counter);
+	EXPECT_EQ(ranOn, std::this_thread::get_id());
+
+	release = true;
+	jobs.Wait(&blocker);
+
+	jobs.Shutdown();
+}
+
+TEST(JobSystemTests, RunsInlineWithoutWorkers)
+{
+	JobSystem jobs;
+
+	int runs = 0;
+	JobCounter counter;
+	jobs.Run([&runs]() { runs++; }, &counter);
+
+	EXPECT_EQ(runs, 1);
+	EXPECT_TRUE(counter.IsDone());
+}
+
+TEST(JobSystemTests, ShutdownRunsQueuedJobs)
+{
+	JobSystem jobs;
+	jobs.Initialize(1);
+
+	std::atomic<bool> release{ false };
+	std::atomic<int> runs{ 0 };
+	JobCounter counter;
+	jobs.Run([&release]() { while (!release) std::this_thread::yield(); }, &counter);
+	for (int i = 0; i < 100; i++)
+		jobs.Run([&runs]() { runs++; }, &counter);
+
+	std::thread releaser([&release]()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		release = true;
+	});
+
+	jobs.Shutdown();
+	releaser.join();
+
+	EXPECT_TRUE(counter.IsDone());
+	EXPECT_EQ(runs, 100);
+}
+
+TEST(JobSystemTests, ParallelForCoversEveryIndexOnce)
+{
+	JobSystem jobs;
+	jobs.Initialize(3);
+
+	for (uint32_t count : { 1u, 7u, 64u, 1000u, 100003u })
+	{
+		for (uint32_t minChunkSize : { 1u, 16u, 64u, 4096u })
+		{
+			std::vector<std::atomic<int>> hits(count);
+			jobs.ParallelFor(count, [&hits](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+					hits[i]++;
+			}, minChunkSize);
+
+			for (uint32_t i = 0; i < count; i++)
+				ASSERT_EQ(hits[i], 1) << "count " << count << ", min chunk " << minChunkSize << ", index " << i;
+		}
+	}
+
+	jobs.Shutdown();
+}
+
+TEST(JobSystemTests, ParallelForChunksAreNeverEmptyNorLongerThanChunkSize)
+{
+	JobSystem jobs;
+	jobs.Initialize(3);
+
+	const uint32_t count = 10000;
+	const uint32_t minChunkSize = 100;
+	std::atomic<uint32_t> chunks{ 0 };
+	std::atomic<uint32_t> badChunks{ 0 };
+	jobs.ParallelFor(count, [&](uint32_t begin, uint32_t end)
+	{
+		chunks++;
+		if (end <= begin || end - begin > minChunkSize)
+			badChunks++;
+	}, minChunkSize);
+
+	EXPECT_EQ(badChunks, 0u);
+	// Every split leaves at most one shorter chunk behind
+	EXPECT_LT(chunks, count / minChunkSize * 2);
+
+	jobs.Shutdown();
+}
+
+TEST(JobSystemTests, NestedParallelFor)
+{
+	JobSystem jobs;
+	jobs.Initialize(3);
+
+	std::atomic<uint64_t> sum{ 0 };
+	jobs.ParallelFor(64, [&](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			jobs.ParallelFor(256, [&sum](uint32_t innerBegin, uint32_t innerEnd)
+			{
+				sum += innerEnd - innerBegin;
+			}, 8);
+		}
+	}, 1);
+
+	EXPECT_EQ(sum, 64u * 256u);
+
+	jobs.Shutdown();
+}
\ No newline at end of file
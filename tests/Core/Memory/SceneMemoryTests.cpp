@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "Core/Memory/SceneMemory.h"
+
+struct SmallObject
+{
+	int Value;
+};
+
+struct OtherSmallObject
+{
+	int Value;
+};
+
+TEST(SceneMemoryTests, ObjectsOfATypeShareAPool)
+{
+	SceneMemory memory;
+	SceneAllocator<SmallObject> allocator(&memory);
+
+	SmallObject* first = allocator.allocate(1);
+	SmallObject* second = allocator.allocate(1);
+	EXPECT_EQ(memory.GetTypePoolsCount(), SceneMemory::GetTypeID<SmallObject>() + 1);
+
+	// Consecutive blocks of the same chunk
+	EXPECT_EQ(reinterpret_cast<char*>(second) - reinterpret_cast<char*>(first), (ptrdiff_t)SceneMemory::SIZE_CLASS_GRANULARITY);
+
+	allocator.deallocate(second, 1);
+	EXPECT_EQ(allocator.allocate(1), second);
+
+	EXPECT_EQ(memory.GetHeapAllocationsCount(), 0u);
+}
+
+TEST(SceneMemoryTests, TypesOfTheSameSizeGetSeparatePools)
+{
+	SceneMemory memory;
+	SceneAllocator<SmallObject> allocator(&memory);
+	SceneAllocator<OtherSmallObject> otherAllocator(&memory);
+
+	allocator.allocate(1);
+	otherAllocator.allocate(1);
+
+	EXPECT_NE(SceneMemory::GetTypeID<SmallObject>(), SceneMemory::GetTypeID<OtherSmallObject>());
+	EXPECT_EQ(memory.GetChunksCount(), 2u);
+}
+
+TEST(SceneMemoryTests, VectorsUseTheSceneMemory)
+{
+	SceneMemory memory;
+	{
+		SceneVector<int> values{ SceneAllocator<int>(&memory) };
+		for (int i = 0; i < 100; i++)
+			values.push_back(i);
+
+		EXPECT_GT(memory.GetLiveAllocationsCount(), 0u);
+		EXPECT_EQ(memory.GetHeapAllocationsCount(), 0u);
+	}
+
+	EXPECT_EQ(memory.GetLiveAllocationsCount(), 0u);
+}
+
+TEST(SceneMemoryTests, OversizedRequestsGoToTheHeap)
+{
+	SceneMemory memory;
+	SceneAllocator<char> allocator(&memory);
+
+	char* block = allocator.allocate(SceneMemory::MAX_POOLED_SIZE + 1);
+	EXPECT_EQ(memory.GetHeapAllocationsCount(), 1u);
+
+	allocator.deallocate(block, SceneMemory::MAX_POOLED_SIZE + 1);
+	EXPECT_EQ(memory.GetLiveAllocationsCount(), 0u);
+}
+
+TEST(SceneMemoryTests, NamesAreCopiedIntoTheArena)
+{
+	SceneMemory memory;
+
+	std::string source = "Point Light";
+	std::string_view name = memory.StoreName(source);
+	source = "Changed";
+
+	EXPECT_EQ(name, "Point Light");
+	EXPECT_EQ(name.data()[name.size()], '\0');
+
+	// Fills the first chunk, earlier names stay where they are
+	std::string_view last;
+	for (int i = 0; i < 1000; i++)
+		last = memory.StoreName("Entity " + std::to_string(i));
+
+	EXPECT_EQ(name, "Point Light");
+	EXPECT_EQ(last, "Entity 999");
+	EXPECT_GT(memory.GetChunksCount(), 1u);
+
+	std::string longName(SceneMemory::NAME_CHUNK_SIZE * 2, 'x');
+	EXPECT_EQ(memory.StoreName(longName), longName);
+}
+
+TEST(SceneMemoryTests, EmptyChunksAreReleased)
+{
+	PoolAllocator pool(sizeof(SmallObject), 4);
+
+	std::vector<void*> blocks;
+	for (int i = 0; i < 12; i++)
+		blocks.push_back(pool.Allocate());
+	ASSERT_EQ(pool.GetChunksCount(), 3u);
+
+	// Empties the last two chunks and half of the first one
+	for (int i = 2; i < 12; i++)
+		pool.Deallocate(blocks[i]);
+
+	// One empty chunk is kept for the next allocations
+	EXPECT_EQ(pool.ReleaseEmptyChunks(), 1u);
+	EXPECT_EQ(pool.GetChunksCount(), 2u);
+	EXPECT_EQ(pool.GetLiveBlocksCount(), 2u);
+
+	// The free blocks left all belong to the kept chunks
+	for (int i = 0; i < 6; i++)
+		blocks.push_back(pool.Allocate());
+	EXPECT_EQ(pool.GetChunksCount(), 2u);
+
+	pool.Allocate();
+	EXPECT_EQ(pool.GetChunksCount(), 3u);
+}
\ No newline at end of file
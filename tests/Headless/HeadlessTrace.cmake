@@ -0,0 +1,39 @@
+# Runs MistHeadless twice on the same scene and checks both device traces match each other and the golden trace.
+# cmake -DHEADLESS=<MistHeadless> -DSCENE=<scene> -DSTEPS=<N> -DGOLDEN=<trace> -DOUTPUT_DIR=<dir> -P HeadlessTrace.cmake
+# With the MIST_BLESS_TRACES environment variable set the golden trace is replaced by the new one,
+# to be reviewed and committed along with the change causing it.
+
+foreach(run first second)
+	execute_process(COMMAND ${HEADLESS} ${SCENE} --steps ${STEPS} --workers 2
+							--output ${OUTPUT_DIR}/trace_${run}.json
+							--trace ${OUTPUT_DIR}/trace_${run}.trace
+							--call-counts ${OUTPUT_DIR}/trace_${run}.counts
+					RESULT_VARIABLE result)
+
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "MistHeadless failed on ${SCENE}: ${result}")
+	endif()
+endforeach()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${OUTPUT_DIR}/trace_first.trace ${OUTPUT_DIR}/trace_second.trace
+				RESULT_VARIABLE different)
+if(different)
+	message(FATAL_ERROR "Two runs of ${SCENE} produced different traces, compare ${OUTPUT_DIR}/trace_first.trace and trace_second.trace")
+endif()
+
+if("$ENV{MIST_BLESS_TRACES}")
+	execute_process(COMMAND ${CMAKE_COMMAND} -E copy ${OUTPUT_DIR}/trace_first.trace ${GOLDEN})
+	message(STATUS "Blessed ${GOLDEN}")
+	return()
+endif()
+
+if(NOT EXISTS ${GOLDEN})
+	message(FATAL_ERROR "No golden trace at ${GOLDEN}, run MIST_BLESS_TRACES=1 ctest -R MistHeadlessTrace to create it")
+endif()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${GOLDEN} ${OUTPUT_DIR}/trace_first.trace
+				RESULT_VARIABLE different)
+if(different)
+	message(FATAL_ERROR "Device trace of ${SCENE} changed, diff ${GOLDEN} against ${OUTPUT_DIR}/trace_first.trace "
+						"and bless it if the change is intended")
+endif()
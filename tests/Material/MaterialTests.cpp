@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <glad/glad.h>
+
+#include "Material/Material.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+// Reflects programs with two floats in the material parameters block, "roughness" at 0 and "metallic" at 4
+class ParametersBlockDevice : public NullRenderDevice
+{
+public:
+	virtual void GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value) override
+	{
+		if (parameter == GL_ACTIVE_UNIFORMS)
+			*value = 2;
+		else if (parameter == GL_ACTIVE_UNIFORM_MAX_LENGTH)
+			*value = 64;
+		else
+			NullRenderDevice::GetProgramiv(program, parameter, value);
+	}
+
+	virtual void GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name) override
+	{
+		const char* names[] = { MATERIAL_PARAMETERS_BLOCK ".roughness", MATERIAL_PARAMETERS_BLOCK ".metallic" };
+		*length = snprintf(name, bufferSize, "%s", names[index]);
+		*size = 1;
+		*type = GL_FLOAT;
+	}
+
+	virtual void GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values) override
+	{
+		for (int32_t i = 0; i < count; i++)
+			values[i] = parameter == GL_UNIFORM_OFFSET ? indices[i] * sizeof(float) : 0;
+	}
+
+	virtual uint32_t GetUniformBlockIndex(uint32_t program, const char* name) override
+	{
+		return strcmp(name, MATERIAL_PARAMETERS_BLOCK) == 0 ? 0 : GL_INVALID_INDEX;
+	}
+
+	virtual void GetActiveUniformBlockiv(uint32_t program, uint32_t blockIndex, uint32_t parameter, int32_t* value) override
+	{
+		*value = parameter == GL_UNIFORM_BLOCK_DATA_SIZE ? 16 : 0;
+	}
+};
+
+class MaterialTests : public testing::Test
+{
+protected:
+	Ref<ParametersBlockDevice> m_Device;
+	Ref<Material> m_Material;
+
+	void SetUp() override
+	{
+		m_Device = CreateRef<ParametersBlockDevice>();
+		RenderDevice::Set(m_Device);
+
+		Ref<Shader> shader = CreateRef<Shader>("Standard", "../../res/shaders/Material/Standard.vert", "../../res/shaders/Material/Standard.frag");
+		m_Material = CreateRef<Material>(1, "Material", shader);
+	}
+
+	void TearDown() override
+	{
+		m_Material.reset();
+		RenderDevice::Set(nullptr);
+	}
+
+	// Offset and size of every upload recorded since the last reset
+	std::vector<std::pair<double, double>> Uploads() const
+	{
+		std::vector<std::pair<double, double>> uploads;
+		for (auto& recorded : m_Device->GetTrace())
+		{
+			if (recorded.Call == DeviceCall::BUFFER_SUB_DATA)
+				uploads.push_back({ recorded.Args[1], recorded.Args[2] });
+		}
+		return uploads;
+	}
+};
+
+TEST_F(MaterialTests, SettingTheSameValueUploadsNothing)
+{
+	m_Device->Reset();
+	m_Device->SetRecording(true);
+
+	m_Material->SetFloat("u_Material.roughness", 0.5f);
+	std::vector<std::pair<double, double>> uploads = Uploads();
+	ASSERT_EQ(uploads.size(), 1u);
+	EXPECT_EQ(uploads[0].second, sizeof(float));
+
+	m_Device->Reset();
+	m_Material->SetFloat("u_Material.roughness", 0.5f);
+	// Parameters start zeroed, zero is already in the block
+	m_Material->SetFloat("u_Material.metallic", 0.0f);
+	EXPECT_TRUE(Uploads().empty());
+}
+
+TEST_F(MaterialTests, OnlyTheChangedParameterIsUploaded)
+{
+	m_Material->SetFloat("u_Material.roughness", 0.5f);
+
+	m_Device->Reset();
+	m_Device->SetRecording(true);
+
+	m_Material->SetFloat("u_Material.metallic", 1.0f);
+	m_Material->SetFloat("u_Material.roughness", 0.5f);
+
+	m_Material->SetFloat("u_Material.roughness", 0.25f);
+
+	std::vector<std::pair<double, double>> uploads = Uploads();
+	ASSERT_EQ(uploads.size(), 2u);
+	EXPECT_EQ(uploads[0].first, uploads[1].first + sizeof(float));
+	EXPECT_EQ(uploads[1].second, sizeof(float));
+}
\ No newline at end of file
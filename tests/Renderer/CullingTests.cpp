@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Renderer/Culling.h"
+
+class CullingTests : public testing::Test
+{
+protected:
+	std::mt19937 m_Random{ 7 };
+	std::vector<AABB> m_Boxes;
+
+	float Random(float min, float max)
+	{
+		return min + (m_Random() >> 8) * (1.0f / 16777216.0f) * (max - min);
+	}
+
+	void AddRandomBoxes(size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			glm::vec3 min(Random(-60.0f, 60.0f), Random(-60.0f, 60.0f), Random(-60.0f, 60.0f));
+			m_Boxes.push_back(AABB(min, min + glm::vec3(Random(0.1f, 8.0f), Random(0.1f, 8.0f), Random(0.1f, 8.0f))));
+		}
+	}
+
+	// Boxes on a half unit grid, plenty of them exactly touching the planes of a frustum on the same grid
+	void AddGridBoxes(size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			glm::vec3 min(float(m_Random() % 48) * 0.5f - 12.0f, float(m_Random() % 48) * 0.5f - 12.0f, float(m_Random() % 48) * 0.5f - 24.0f);
+			m_Boxes.push_back(AABB(min, min + glm::vec3(float(m_Random() % 4 + 1) * 0.5f)));
+		}
+	}
+
+	// Culls the boxes from first on, so every box can be moved to any vector lane or into the scalar tail
+	std::vector<uint8_t> Cull(const Frustum& frustum, size_t first, size_t count, uint32_t& visibleCount) const
+	{
+		CullingBounds bounds;
+		for (size_t i = first; i < first + count; i++)
+			bounds.Add(m_Boxes[i]);
+
+		std::vector<uint8_t> visible(count, 2);
+		visibleCount = Culling::FrustumCull(frustum, bounds, visible.data());
+		return visible;
+	}
+
+	void ExpectAllPathsAgree(const Frustum& frustum)
+	{
+		uint32_t expectedCount = 0;
+		std::vector<uint8_t> expected;
+		for (auto& box : m_Boxes)
+		{
+			expected.push_back(frustum.Intersects(box));
+			expectedCount += expected.back();
+		}
+		ASSERT_GT(expectedCount, 0u);
+		ASSERT_LT(expectedCount, m_Boxes.size());
+
+		// Every start lane, every length up to three vectors and then longer runs, so each box goes through each path
+		for (size_t first = 0; first < 8; first++)
+		{
+			for (size_t count = 0; first + count <= m_Boxes.size(); count += (count < 24 ? 1 : 37))
+			{
+				uint32_t visibleCount = 0;
+				std::vector<uint8_t> visible = Cull(frustum, first, count, visibleCount);
+
+				uint32_t expectedVisibleCount = 0;
+				for (size_t i = 0; i < count; i++)
+				{
+					ASSERT_EQ(visible[i], expected[first + i]) << "box " << first + i << " culled in a run of " << count << " from " << first;
+					expectedVisibleCount += visible[i];
+				}
+				EXPECT_EQ(visibleCount, expectedVisibleCount);
+			}
+		}
+	}
+};
+
+TEST_F(CullingTests, PerspectiveFrustumMatchesTheScalarTest)
+{
+	AddRandomBoxes(1003);
+
+	glm::mat4 viewProjection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 80.0f)
+		* glm::lookAt(glm::vec3(10.0f, 5.0f, 40.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	ExpectAllPathsAgree(Frustum::FromMatrix(viewProjection));
+}
+
+TEST_F(CullingTests, BoxesTouchingThePlanesMatchTheScalarTest)
+{
+	AddGridBoxes(1003);
+
+	Frustum frustum = Frustum::FromMatrix(glm::ortho(-8.0f, 8.0f, -8.0f, 8.0f, 0.0f, 16.0f));
+
+	ExpectAllPathsAgree(frustum);
+}
+
+TEST_F(CullingTests, EmptyBoundsWriteNothing)
+{
+	CullingBounds bounds;
+	uint8_t visible = 2;
+
+	EXPECT_EQ(Culling::FrustumCull(Frustum::FromMatrix(glm::mat4(1.0f)), bounds, &visible), 0u);
+	EXPECT_EQ(visible, 2);
+}
+
+TEST_F(CullingTests, SphereCullMatchesTheBoundingSphereTest)
+{
+	AddRandomBoxes(203);
+
+	CullingBounds bounds;
+	for (auto& box : m_Boxes)
+		bounds.Add(box);
+
+	BoundingSphere sphere{ glm::vec3(5.0f, -3.0f, 2.0f), 30.0f };
+	std::vector<uint8_t> visible(m_Boxes.size(), 2);
+	uint32_t visibleCount = Culling::SphereCull(sphere, bounds, visible.data());
+
+	uint32_t expectedCount = 0;
+	for (size_t i = 0; i < m_Boxes.size(); i++)
+	{
+		EXPECT_EQ(visible[i], sphere.Intersects(m_Boxes[i]));
+		expectedCount += visible[i];
+	}
+	EXPECT_EQ(visibleCount, expectedCount);
+	EXPECT_GT(visibleCount, 0u);
+}
\ No newline at end of file
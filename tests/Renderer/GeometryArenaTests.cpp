@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include "Renderer/GeometryArena.h"
+#include "Renderer/Mesh.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+class GeometryArenaTests : public testing::Test
+{
+protected:
+	Ref<NullRenderDevice> m_Device;
+	std::unique_ptr<GeometryArena> m_Arena;
+
+	void SetUp() override
+	{
+		m_Device = CreateRef<NullRenderDevice>();
+		RenderDevice::Set(m_Device);
+
+		m_Arena = std::make_unique<GeometryArena>();
+	}
+
+	void TearDown() override
+	{
+		EXPECT_TRUE(m_Device->GetErrors().empty());
+
+		m_Arena.reset();
+		RenderDevice::Set(nullptr);
+	}
+
+	GeometryHandle Allocate(uint32_t verticesCount, uint32_t indicesCount)
+	{
+		std::vector<Vertex> vertices(verticesCount);
+		std::vector<uint32_t> indices(indicesCount);
+		return m_Arena->Allocate(vertices.data(), verticesCount, indices.data(), indicesCount);
+	}
+};
+
+TEST_F(GeometryArenaTests, FreedRangesAreReusedFirst)
+{
+	GeometryHandle first = Allocate(100, 300);
+	GeometryHandle second = Allocate(100, 300);
+	EXPECT_EQ(m_Arena->Get(second).FirstVertex, 100u);
+	EXPECT_EQ(m_Arena->Get(second).FirstIndex, 300u);
+
+	m_Arena->Free(first);
+	GeometryHandle reused = Allocate(50, 150);
+
+	EXPECT_EQ(reused, first);
+	EXPECT_EQ(m_Arena->Get(reused).FirstVertex, 0u);
+	EXPECT_EQ(m_Arena->Get(reused).FirstIndex, 0u);
+	EXPECT_EQ(m_Arena->Get(second).FirstVertex, 100u);
+}
+
+TEST_F(GeometryArenaTests, FreedNeighboursAreMerged)
+{
+	GeometryHandle first = Allocate(100, 300);
+	GeometryHandle second = Allocate(100, 300);
+	GeometryHandle third = Allocate(100, 300);
+
+	// The third one joins the free space at the end
+	m_Arena->Free(first);
+	m_Arena->Free(third);
+	EXPECT_EQ(m_Arena->GetFreeVertexRangesCount(), 2u);
+
+	m_Arena->Free(second);
+	EXPECT_EQ(m_Arena->GetFreeVertexRangesCount(), 1u);
+	EXPECT_EQ(m_Arena->GetFreeVerticesCount(), m_Arena->GetVertexCapacity());
+
+	// Freeing twice does not give the range back again
+	m_Arena->Free(second);
+	EXPECT_EQ(m_Arena->GetFreeVerticesCount(), m_Arena->GetVertexCapacity());
+}
+
+TEST_F(GeometryArenaTests, DefragmentPacksLiveAllocationsBehindTheirHandles)
+{
+	GeometryHandle handles[4];
+	for (auto& handle : handles)
+		handle = Allocate(100, 300);
+
+	m_Arena->Free(handles[0]);
+	m_Arena->Free(handles[2]);
+	ASSERT_TRUE(m_Arena->IsFragmented());
+
+	m_Device->Reset();
+	m_Arena->Defragment();
+
+	EXPECT_FALSE(m_Arena->IsFragmented());
+	EXPECT_EQ(m_Arena->GetFreeVertexRangesCount(), 1u);
+	EXPECT_EQ(m_Arena->Get(handles[1]).FirstVertex, 0u);
+	EXPECT_EQ(m_Arena->Get(handles[1]).FirstIndex, 0u);
+	EXPECT_EQ(m_Arena->Get(handles[3]).FirstVertex, 100u);
+	EXPECT_EQ(m_Arena->Get(handles[3]).FirstIndex, 300u);
+	EXPECT_EQ(m_Arena->Get(handles[3]).VerticesCount, 100u);
+	EXPECT_EQ(m_Arena->Get(handles[3]).IndicesCount, 300u);
+
+	// One copy per live allocation and buffer
+	EXPECT_EQ(m_Device->GetCallCount(DeviceCall::COPY_BUFFER_SUB_DATA), 4u);
+}
+
+TEST_F(GeometryArenaTests, FragmentedIndicesAloneArePackedInsteadOfGrowing)
+{
+	uint32_t indexCapacity = m_Arena->GetIndexCapacity();
+	uint32_t large = indexCapacity * 2 / 5;
+
+	GeometryHandle first = Allocate(10, large);
+	GeometryHandle second = Allocate(10, large);
+	m_Arena->Free(first);
+
+	// Only fits in the hole and the free end put together, the vertices have room to spare
+	uint32_t request = indexCapacity - large - large / 2;
+	GeometryHandle packed = Allocate(10, request);
+
+	EXPECT_EQ(m_Arena->GetIndexCapacity(), indexCapacity);
+	EXPECT_EQ(m_Arena->Get(second).FirstIndex, 0u);
+	EXPECT_EQ(m_Arena->Get(packed).FirstIndex, large);
+	EXPECT_EQ(m_Arena->Get(packed).IndicesCount, request);
+}
+
+TEST_F(GeometryArenaTests, FragmentedVerticesAloneArePackedInsteadOfGrowing)
+{
+	uint32_t vertexCapacity = m_Arena->GetVertexCapacity();
+	uint32_t large = vertexCapacity * 2 / 5;
+
+	GeometryHandle first = Allocate(large, 30);
+	GeometryHandle second = Allocate(large, 30);
+	m_Arena->Free(first);
+
+	uint32_t request = vertexCapacity - large - large / 2;
+	GeometryHandle packed = Allocate(request, 30);
+
+	EXPECT_EQ(m_Arena->GetVertexCapacity(), vertexCapacity);
+	EXPECT_EQ(m_Arena->Get(second).FirstVertex, 0u);
+	EXPECT_EQ(m_Arena->Get(packed).FirstVertex, large);
+}
+
+TEST_F(GeometryArenaTests, GrowsWhenThereIsNotEnoughRoom)
+{
+	uint32_t vertexCapacity = m_Arena->GetVertexCapacity();
+	uint32_t indexCapacity = m_Arena->GetIndexCapacity();
+
+	uint32_t vao = 0;
+	m_Device->GenVertexArrays(1, &vao);
+	m_Arena->AttachVertexArray(vao);
+
+	GeometryHandle first = Allocate(vertexCapacity - 10, 30);
+	m_Device->Reset();
+	GeometryHandle second = Allocate(100, 30);
+
+	EXPECT_GE(m_Arena->GetVertexCapacity(), vertexCapacity - 10 + 100);
+	EXPECT_EQ(m_Arena->GetIndexCapacity(), indexCapacity * 2);
+	EXPECT_EQ(m_Arena->Get(first).FirstVertex, 0u);
+	EXPECT_EQ(m_Arena->Get(second).FirstVertex, vertexCapacity - 10);
+	EXPECT_EQ(m_Arena->Get(second).FirstIndex, 30u);
+
+	// The old buffers are deleted, the arena's vertex array and the attached one point at the new ones
+	EXPECT_EQ(m_Device->GetCallCount(DeviceCall::DELETE_BUFFERS), 2u);
+	EXPECT_EQ(m_Device->GetCallCount(DeviceCall::BIND_VERTEX_ARRAY), 4u);
+
+	m_Arena->DetachVertexArray(vao);
+	m_Device->DeleteVertexArrays(1, &vao);
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "Renderer/RenderCommandBuffer.h"
+#include "Renderer/Device/NullRenderDevice.h"
+#include "Material/Material.h"
+
+class RenderCommandBufferTests : public testing::Test
+{
+protected:
+	std::vector<Ref<Shader>> m_Shaders;
+	std::vector<uint32_t> m_ProgramIDs;
+	std::vector<Ref<Material>> m_Materials;
+	glm::mat4 m_Model = glm::mat4(1.0f);
+	RenderCommandBuffer m_Commands;
+
+	void SetUp() override
+	{
+		RenderDevice::Set(CreateRef<NullRenderDevice>());
+	}
+
+	void TearDown() override
+	{
+		// Shaders delete the program they were created with
+		for (size_t i = 0; i < m_Shaders.size(); i++)
+			m_Shaders[i]->id = m_ProgramIDs[i];
+
+		m_Materials.clear();
+		m_Shaders.clear();
+		RenderDevice::Set(nullptr);
+	}
+
+	// The key only reads the shader's id, it is replaced to choose the bits that end up in it
+	Ref<Shader> AddShader(uint32_t id)
+	{
+		m_Shaders.push_back(CreateRef<Shader>("Standard", "../../res/shaders/Material/Standard.vert", "../../res/shaders/Material/Standard.frag"));
+		m_ProgramIDs.push_back(m_Shaders.back()->id);
+		m_Shaders.back()->id = id;
+		return m_Shaders.back();
+	}
+
+	Material* AddMaterial(uint64_t id, const Ref<Shader>& shader)
+	{
+		m_Materials.push_back(CreateRef<Material>(id, "Material", shader));
+		return m_Materials.back().get();
+	}
+
+	void Add(Material* material, uint32_t vertexArray, float depth, uint32_t instancesCount = 0)
+	{
+		RenderCommand command;
+		command.SourceMesh = nullptr;
+		command.SourceMaterial = material;
+		command.ModelMatrix = &m_Model;
+		command.VertexArray = vertexArray;
+		command.InstancesCount = instancesCount;
+		m_Commands.Add(RenderPass::OPAQUE, command, glm::vec3(0.0f, 0.0f, depth));
+	}
+};
+
+TEST_F(RenderCommandBufferTests, KeyOrdersByShaderThenMaterialThenMeshThenDepth)
+{
+	uint64_t key = RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 2, 2, 2, 2.0f);
+
+	EXPECT_LT(RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 1, 3, 3, 3.0f), key);
+	EXPECT_LT(RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 2, 1, 3, 3.0f), key);
+	EXPECT_LT(RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 2, 2, 1, 3.0f), key);
+	EXPECT_LT(RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 2, 2, 2, 1.0f), key);
+
+	// Behind the view position counts as on it
+	EXPECT_EQ(RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 2, 2, 2, -5.0f), RenderCommandBuffer::MakeSortKey(RenderPass::OPAQUE, 2, 2, 2, 0.0f));
+}
+
+TEST_F(RenderCommandBufferTests, SortMatchesStableSort)
+{
+	std::mt19937 random(11);
+
+	// Every field varies, so every byte of the keys goes through a pass
+	for (int i = 0; i < 8; i++)
+	{
+		Ref<Shader> shader = AddShader(random() & 0xFFF);
+		for (int j = 0; j < 8; j++)
+			AddMaterial(random(), shader);
+	}
+
+	for (int i = 0; i < 5000; i++)
+		Add(m_Materials[random() % m_Materials.size()].get(), random() % 1000, (random() >> 8) * (1.0f / 16777216.0f) * 500.0f);
+
+	// Recorded ones have their index as a tie break, stable sorting keeps it
+	std::vector<RenderCommandEntry> expected(m_Commands.GetEntries().begin(), m_Commands.GetEntries().end());
+	std::stable_sort(expected.begin(), expected.end(), [](const RenderCommandEntry& a, const RenderCommandEntry& b) { return a.SortKey < b.SortKey; });
+
+	m_Commands.Sort();
+
+	ASSERT_EQ(m_Commands.Size(), expected.size());
+	for (size_t i = 0; i < expected.size(); i++)
+	{
+		EXPECT_EQ(m_Commands.GetEntries()[i].SortKey, expected[i].SortKey);
+		ASSERT_EQ(m_Commands.GetEntries()[i].Index, expected[i].Index) << "at " << i;
+	}
+}
+
+TEST_F(RenderCommandBufferTests, CollidingKeysStillSplitBatches)
+{
+	// Same low 12 bits of the program and low 16 bits of the material ids, all four get the same key
+	Ref<Shader> shader = AddShader(0x005);
+	Ref<Shader> otherShader = AddShader(0x1005);
+	Material* materials[] = { AddMaterial(0x10007, shader), AddMaterial(0x20007, shader), AddMaterial(0x10007, otherShader), AddMaterial(0x30007, otherShader) };
+
+	// Interleaved by depth, so sorting cannot bring the draws of one material together
+	for (int i = 0; i < 12; i++)
+		Add(materials[i % 4], 9, float(i));
+	m_Commands.Sort();
+
+	std::vector<DrawBatch> batches;
+	m_Commands.BuildBatches(batches);
+
+	ASSERT_EQ(batches.size(), 12u);
+	for (uint32_t i = 0; i < batches.size(); i++)
+	{
+		const RenderCommand& command = m_Commands.GetCommand(m_Commands.GetEntries()[batches[i].FirstEntry]);
+		EXPECT_TRUE(batches[i].MultiDraw);
+		EXPECT_EQ(batches[i].EntriesCount, 1u);
+		EXPECT_EQ(batches[i].FirstIndirectCommand, i);
+		EXPECT_EQ(command.SourceMaterial, materials[i % 4]);
+	}
+}
+
+TEST_F(RenderCommandBufferTests, BatchesMergeSharedStateOnly)
+{
+	Ref<Shader> shader = AddShader(1);
+	Material* material = AddMaterial(1, shader);
+	Material* other = AddMaterial(2, shader);
+
+	for (int i = 0; i < 3; i++)
+		Add(material, 1, float(i));
+	Add(material, 2, 0.0f);
+	// Instanced commands are never merged
+	Add(material, 3, 0.0f, 10);
+	Add(material, 3, 1.0f, 10);
+	Add(other, 1, 0.0f);
+	Add(other, 1, 1.0f);
+	m_Commands.Sort();
+
+	std::vector<DrawBatch> batches;
+	m_Commands.BuildBatches(batches);
+
+	ASSERT_EQ(batches.size(), 5u);
+	uint32_t counts[] = { 3, 1, 1, 1, 2 };
+	uint32_t indirectCommands[] = { 0, 3, 4, 4, 4 };
+	bool multiDraws[] = { true, true, false, false, true };
+	for (size_t i = 0; i < batches.size(); i++)
+	{
+		EXPECT_EQ(batches[i].EntriesCount, counts[i]);
+		EXPECT_EQ(batches[i].FirstIndirectCommand, indirectCommands[i]);
+		EXPECT_EQ(batches[i].MultiDraw, multiDraws[i]);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "Renderer/UniformBufferArena.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+class UniformBufferArenaTests : public testing::Test
+{
+protected:
+	Ref<NullRenderDevice> m_Device;
+	std::unique_ptr<UniformBufferArena> m_Arena;
+
+	void SetUp() override
+	{
+		m_Device = CreateRef<NullRenderDevice>();
+		RenderDevice::Set(m_Device);
+
+		m_Arena = std::make_unique<UniformBufferArena>(3, 2 * UniformBufferArena::BLOCK_ALIGNMENT);
+	}
+
+	void TearDown() override
+	{
+		EXPECT_TRUE(m_Device->GetErrors().empty());
+
+		m_Arena.reset();
+		RenderDevice::Set(nullptr);
+	}
+
+	std::vector<RecordedCall> RecordedCalls(DeviceCall call) const
+	{
+		std::vector<RecordedCall> calls;
+		for (auto& recorded : m_Device->GetTrace())
+		{
+			if (recorded.Call == call)
+				calls.push_back(recorded);
+		}
+		return calls;
+	}
+};
+
+TEST_F(UniformBufferArenaTests, BlocksAreAlignedAndZeroed)
+{
+	m_Device->SetRecording(true);
+
+	UniformBufferBlock first = m_Arena->Allocate(20);
+	UniformBufferBlock second = m_Arena->Allocate(UniformBufferArena::BLOCK_ALIGNMENT + 1);
+
+	EXPECT_EQ(first.Offset, 0u);
+	EXPECT_EQ(first.Size, UniformBufferArena::BLOCK_ALIGNMENT);
+	EXPECT_EQ(second.Offset, UniformBufferArena::BLOCK_ALIGNMENT);
+	EXPECT_EQ(second.Size, 2 * UniformBufferArena::BLOCK_ALIGNMENT);
+	EXPECT_EQ(m_Arena->GetSize(), 3 * UniformBufferArena::BLOCK_ALIGNMENT);
+
+	// Each block is cleared on the GPU as a whole
+	std::vector<RecordedCall> uploads = RecordedCalls(DeviceCall::BUFFER_SUB_DATA);
+	ASSERT_EQ(uploads.size(), 2u);
+	EXPECT_EQ(uploads[1].Args[1], second.Offset);
+	EXPECT_EQ(uploads[1].Args[2], second.Size);
+}
+
+TEST_F(UniformBufferArenaTests, FreedBlocksAreReusedBySameSizedAllocations)
+{
+	UniformBufferBlock first = m_Arena->Allocate(64);
+	UniformBufferBlock second = m_Arena->Allocate(64);
+
+	float value = 1.0f;
+	m_Arena->Update(first, 0, sizeof(value), &value);
+	m_Arena->Free(first);
+
+	// Too large for the freed block
+	UniformBufferBlock large = m_Arena->Allocate(UniformBufferArena::BLOCK_ALIGNMENT * 2);
+	EXPECT_NE(large.Offset, first.Offset);
+
+	UniformBufferBlock reused = m_Arena->Allocate(100);
+	EXPECT_EQ(reused.Offset, first.Offset);
+	EXPECT_NE(reused.Offset, second.Offset);
+
+	// Handed out zeroed again, so writing the old value has to be uploaded
+	m_Device->Reset();
+	m_Arena->Update(reused, 0, sizeof(value), &value);
+	EXPECT_EQ(m_Device->GetCallCount(DeviceCall::BUFFER_SUB_DATA), 1u);
+}
+
+TEST_F(UniformBufferArenaTests, UnchangedBytesAreNotUploaded)
+{
+	UniformBufferBlock block = m_Arena->Allocate(64);
+
+	m_Device->Reset();
+	m_Device->SetRecording(true);
+
+	float values[] = { 1.0f, 2.0f };
+	m_Arena->Update(block, 16, sizeof(values), values);
+	m_Arena->Update(block, 16, sizeof(values), values);
+	m_Arena->Update(block, 20, sizeof(float), &values[1]);
+
+	std::vector<RecordedCall> uploads = RecordedCalls(DeviceCall::BUFFER_SUB_DATA);
+	ASSERT_EQ(uploads.size(), 1u);
+	EXPECT_EQ(uploads[0].Args[1], block.Offset + 16);
+	EXPECT_EQ(uploads[0].Args[2], sizeof(values));
+}
+
+TEST_F(UniformBufferArenaTests, GrowingKeepsTheBufferAndItsContents)
+{
+	UniformBufferBlock first = m_Arena->Allocate(64);
+	UniformBufferBlock second = m_Arena->Allocate(64);
+
+	float value = 3.0f;
+	m_Arena->Update(second, 8, sizeof(value), &value);
+
+	m_Device->Reset();
+	m_Device->SetRecording(true);
+	UniformBufferBlock third = m_Arena->Allocate(64);
+
+	EXPECT_EQ(third.Offset, 2 * UniformBufferArena::BLOCK_ALIGNMENT);
+	EXPECT_EQ(m_Arena->GetCapacity(), 4 * UniformBufferArena::BLOCK_ALIGNMENT);
+	EXPECT_EQ(m_Device->GetCallCount(DeviceCall::GEN_BUFFERS), 0u);
+
+	std::vector<RecordedCall> respecified = RecordedCalls(DeviceCall::BUFFER_DATA);
+	ASSERT_EQ(respecified.size(), 1u);
+	EXPECT_EQ(respecified[0].Args[1], m_Arena->GetCapacity());
+
+	// The CPU copy came along, the value is already there
+	m_Device->Reset();
+	m_Arena->Update(second, 8, sizeof(value), &value);
+	EXPECT_EQ(m_Device->GetCallCount(DeviceCall::BUFFER_SUB_DATA), 0u);
+
+	// Blocks are bound by their range of the one buffer
+	m_Device->SetRecording(true);
+	m_Arena->Bind(third);
+	std::vector<RecordedCall> binds = RecordedCalls(DeviceCall::BIND_BUFFER_RANGE);
+	ASSERT_EQ(binds.size(), 1u);
+	EXPECT_EQ(binds[0].Args[1], 3);
+	EXPECT_EQ(binds[0].Args[3], third.Offset);
+	EXPECT_EQ(binds[0].Args[4], third.Size);
+
+	m_Arena->Free(first);
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <glad/glad.h>
+
+#include "Renderer/UniformTable.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+// Reflects one program with a scalar and a three element array, reported the way drivers do as "name[0]"
+class ArrayUniformDevice : public NullRenderDevice
+{
+public:
+	virtual void GetProgramiv(uint32_t program, uint32_t parameter, int32_t* value) override
+	{
+		if (parameter == GL_ACTIVE_UNIFORMS)
+			*value = 2;
+		else if (parameter == GL_ACTIVE_UNIFORM_MAX_LENGTH)
+			*value = 32;
+		else
+			NullRenderDevice::GetProgramiv(program, parameter, value);
+	}
+
+	virtual void GetActiveUniform(uint32_t program, uint32_t index, int32_t bufferSize, int32_t* length, int32_t* size, uint32_t* type, char* name) override
+	{
+		const char* names[] = { "u_Scale", "u_Weights[0]" };
+		*length = snprintf(name, bufferSize, "%s", names[index]);
+		*size = index == 0 ? 1 : 3;
+		*type = GL_FLOAT;
+	}
+
+	virtual void GetActiveUniformsiv(uint32_t program, int32_t count, const uint32_t* indices, uint32_t parameter, int32_t* values) override
+	{
+		for (int32_t i = 0; i < count; i++)
+			values[i] = -1;
+	}
+};
+
+class UniformTableTests : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		RenderDevice::Set(CreateRef<ArrayUniformDevice>());
+		m_Table.Load(1, m_Uniforms);
+	}
+
+	void TearDown() override
+	{
+		RenderDevice::Set(nullptr);
+	}
+
+	UniformTable m_Table;
+	std::vector<ShaderUniform> m_Uniforms;
+};
+
+TEST_F(UniformTableTests, SkipsUnchangedValues)
+{
+	float value = 1.0f;
+	UniformID scale = UniformName::Get("u_Scale");
+
+	EXPECT_GE(m_Table.Update(scale, &value, sizeof(value)), 0);
+	EXPECT_EQ(m_Table.Update(scale, &value, sizeof(value)), -1);
+
+	value = 2.0f;
+	EXPECT_GE(m_Table.Update(scale, &value, sizeof(value)), 0);
+}
+
+TEST_F(UniformTableTests, ArrayNameAndFirstElementShareTheirValue)
+{
+	UniformID bare = UniformName::Get("u_Weights");
+	UniformID first = UniformName::Get("u_Weights", 0);
+
+	float a = 1.0f, b = 2.0f;
+	int32_t location = m_Table.Update(bare, &a, sizeof(a));
+	EXPECT_GE(location, 0);
+	EXPECT_EQ(m_Table.Update(first, &b, sizeof(b)), location);
+
+	// The location now holds b, so setting a again through the bare name has to be sent
+	EXPECT_EQ(m_Table.Update(bare, &a, sizeof(a)), location);
+	EXPECT_EQ(m_Table.Update(first, &a, sizeof(a)), -1);
+}
+
+TEST_F(UniformTableTests, OtherElementsKeepTheirOwnValue)
+{
+	UniformID first = UniformName::Get("u_Weights", 0);
+	UniformID second = UniformName::Get("u_Weights", 1);
+
+	float value = 1.0f;
+	int32_t firstLocation = m_Table.Update(first, &value, sizeof(value));
+	int32_t secondLocation = m_Table.Update(second, &value, sizeof(value));
+	EXPECT_GE(secondLocation, 0);
+	EXPECT_NE(firstLocation, secondLocation);
+}
+
+TEST_F(UniformTableTests, ResolvesNamesWhichWereNotReflected)
+{
+	float value = 1.0f;
+	EXPECT_GE(m_Table.Update(UniformName::Get("u_NotReflected"), &value, sizeof(value)), 0);
+	EXPECT_EQ(m_Table.Update(UniformName::Get("u_NotReflected"), &value, sizeof(value)), -1);
+}
\ No newline at end of file
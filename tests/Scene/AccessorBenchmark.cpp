@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "Scene/Scene.h"
+#include "Scene/Component/StaticMeshComponent.h"
+#include "Scene/Component/InstanceRenderedMeshComponent.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+// The accessors the renderer and scene touch in a frame: the hierarchy walk, the main pass over
+// static meshes, then every shadow casting light going over the meshes again, instanced ones included.
+// The copy visitor takes what each accessor returns by value, like the accessors did before they returned
+// const references and spans, and counts the bytes those copies allocated.
+template<typename Visitor>
+static void VisitFrame(Scene& scene, uint32_t lightsCount, Visitor& visit)
+{
+	const auto& entities = scene.GetEntities();
+	visit(entities);
+
+	for (auto& entity : entities)
+	{
+		visit(entity->GetName());
+		visit(entity->GetTransform());
+		visit(entity->GetChildren());
+
+		if (auto smc = entity->GetComponent<StaticMeshComponent>())
+		{
+			visit(smc->GetMeshes());
+			visit(smc->GetMaterials());
+		}
+	}
+
+	for (uint32_t light = 0; light < lightsCount; light++)
+	{
+		for (auto& entity : entities)
+		{
+			if (auto smc = entity->GetComponent<StaticMeshComponent>())
+				visit(smc->GetMeshes());
+
+			if (auto irmc = entity->GetComponent<InstanceRenderedMeshComponent>())
+			{
+				visit(irmc->GetMeshes());
+				visit(irmc->GetModelMatrices());
+			}
+		}
+	}
+}
+
+struct ReferenceVisitor
+{
+	size_t Touched = 0;
+
+	template<typename T>
+	void operator()(const T& /*value*/)
+	{
+		Touched++;
+	}
+};
+
+struct CopyVisitor
+{
+	size_t Bytes = 0;
+
+	void operator()(const std::vector<Ref<Entity>>& entities)
+	{
+		std::vector<Ref<Entity>> copy = entities;
+		Bytes += copy.size() * sizeof(Ref<Entity>);
+	}
+
+	void operator()(std::string_view name)
+	{
+		std::string copy(name);
+		// Short names stay in the string's own buffer
+		Bytes += copy.capacity() > 15 ? copy.capacity() + 1 : 0;
+	}
+
+	void operator()(const Transform& transform)
+	{
+		Transform copy = transform;
+		Bytes += sizeof(copy);
+	}
+
+	void operator()(Span<Entity* const> children)
+	{
+		std::vector<Entity*> copy(children.begin(), children.end());
+		Bytes += copy.size() * sizeof(Entity*);
+	}
+
+	void operator()(const std::vector<Mesh>& meshes)
+	{
+		std::vector<Mesh> copy = meshes;
+		Bytes += copy.size() * sizeof(Mesh);
+		for (auto& mesh : copy)
+			Bytes += mesh.vertices.size() * sizeof(Vertex) + mesh.indices.size() * sizeof(unsigned int);
+	}
+
+	void operator()(const std::vector<Ref<Material>>& materials)
+	{
+		std::vector<Ref<Material>> copy = materials;
+		Bytes += copy.size() * sizeof(Ref<Material>);
+	}
+
+	void operator()(const std::vector<glm::mat4>& matrices)
+	{
+		std::vector<glm::mat4> copy = matrices;
+		Bytes += copy.size() * sizeof(glm::mat4);
+	}
+};
+
+template<typename Function>
+static double MeasureMicroseconds(uint32_t framesCount, Function&& function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < framesCount; i++)
+		function();
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::micro>(end - start).count() / framesCount;
+}
+
+TEST(AccessorBenchmark, BytesNoLongerCopiedPerFrame)
+{
+	RenderDevice::Set(CreateRef<NullRenderDevice>());
+	{
+		const uint32_t staticMeshesCount = 2000;
+		const uint32_t instancedMeshesCount = 8;
+		const uint32_t lightsCount = 4;
+		const uint32_t framesCount = 50;
+
+		Scene scene;
+		scene.AddRoot();
+		for (uint32_t i = 0; i < staticMeshesCount; i++)
+			scene.AddEntity("../../res/models/defaults/default_sphere.obj", "Static Mesh With A Longer Name " + std::to_string(i));
+
+		for (uint32_t i = 0; i < instancedMeshesCount; i++)
+		{
+			auto irmc = scene.AddEntity("Instanced " + std::to_string(i))->AddComponent<InstanceRenderedMeshComponent>();
+			irmc->SetInstancesCount(1000);
+			irmc->Generate();
+		}
+		scene.UpdateTransforms();
+
+		ReferenceVisitor references;
+		double byReference = MeasureMicroseconds(framesCount, [&]() { VisitFrame(scene, lightsCount, references); });
+
+		CopyVisitor copies;
+		double byValue = MeasureMicroseconds(framesCount, [&]() { VisitFrame(scene, lightsCount, copies); });
+
+		size_t bytesPerFrame = copies.Bytes / framesCount;
+		printf("%u static meshes, %u instanced meshes, %u lights: %.1f KB per frame no longer copied\n",
+			staticMeshesCount, instancedMeshesCount, lightsCount, bytesPerFrame / 1024.0);
+		printf("%.1f us per frame through references, %.1f us per frame through copies\n", byReference, byValue);
+
+		EXPECT_GT(references.Touched, 0u);
+		EXPECT_GT(bytesPerFrame, 0u);
+	}
+	RenderDevice::Set(nullptr);
+}
\ No newline at end of file
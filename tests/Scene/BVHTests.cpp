@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Scene/BVH.h"
+
+class BVHTests : public testing::Test
+{
+protected:
+	BVH m_BVH;
+	std::vector<int32_t> m_Proxies;
+	std::vector<AABB> m_Bounds;
+	std::mt19937 m_Random{ 42 };
+
+	float Random(float min, float max)
+	{
+		return min + (m_Random() >> 8) * (1.0f / 16777216.0f) * (max - min);
+	}
+
+	AABB RandomBounds(float worldSize, float maxSize)
+	{
+		glm::vec3 min(Random(-worldSize, worldSize), Random(-worldSize, worldSize), Random(-worldSize, worldSize));
+		glm::vec3 size(Random(0.1f, maxSize), Random(0.1f, maxSize), Random(0.1f, maxSize));
+		return AABB(min, min + size);
+	}
+
+	// Proxy i carries i + 1 as user data, so no proxy has a null one
+	static void* ToUserData(size_t i) { return reinterpret_cast<void*>(i + 1); }
+	static size_t ToIndex(void* userData) { return reinterpret_cast<size_t>(userData) - 1; }
+
+	void AddProxies(size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			m_Bounds.push_back(RandomBounds(100.0f, 10.0f));
+			m_Proxies.push_back(m_BVH.CreateProxy(m_Bounds.back(), ToUserData(m_Proxies.size())));
+		}
+	}
+
+	template<typename Shape>
+	std::vector<size_t> Query(const Shape& shape) const
+	{
+		std::vector<size_t> found;
+		m_BVH.Query(shape, [&](void* userData) { found.push_back(ToIndex(userData)); });
+		std::sort(found.begin(), found.end());
+		return found;
+	}
+
+	template<typename Shape>
+	std::vector<size_t> BruteForce(const Shape& shape) const
+	{
+		std::vector<size_t> found;
+		for (size_t i = 0; i < m_Proxies.size(); i++)
+		{
+			if (m_Proxies[i] >= 0 && shape.Intersects(m_Bounds[i]))
+				found.push_back(i);
+		}
+		return found;
+	}
+
+	void ExpectQueriesMatchBruteForce()
+	{
+		// Guards against shapes which miss everything and would match trivially
+		size_t foundCount = 0;
+
+		for (int i = 0; i < 20; i++)
+		{
+			AABB box = RandomBounds(100.0f, 40.0f);
+			EXPECT_EQ(Query(box), BruteForce(box));
+			foundCount += BruteForce(box).size();
+
+			BoundingSphere sphere{ glm::vec3(Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f)), Random(1.0f, 30.0f) };
+			EXPECT_EQ(Query(sphere), BruteForce(sphere));
+			foundCount += BruteForce(sphere).size();
+
+			glm::vec3 eye(Random(-150.0f, 150.0f), Random(-150.0f, 150.0f), Random(-150.0f, 150.0f));
+			glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 120.0f)
+				* glm::lookAt(eye, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+			Frustum frustum = Frustum::FromMatrix(viewProjection);
+			EXPECT_EQ(Query(frustum), BruteForce(frustum));
+			foundCount += BruteForce(frustum).size();
+		}
+
+		EXPECT_GT(foundCount, 0u);
+	}
+
+	// Every node encloses its children and is their parent, every live proxy is reached exactly once
+	void ExpectValidTree() const
+	{
+		const auto& nodes = m_BVH.GetNodes();
+		uint32_t leaves = 0;
+
+		std::vector<int32_t> stack;
+		if (m_BVH.GetRoot() >= 0)
+		{
+			EXPECT_EQ(nodes[m_BVH.GetRoot()].Parent, -1);
+			stack.push_back(m_BVH.GetRoot());
+		}
+
+		while (!stack.empty())
+		{
+			int32_t index = stack.back();
+			stack.pop_back();
+
+			const BVHNode& node = nodes[index];
+			if (node.IsLeaf())
+			{
+				leaves++;
+				continue;
+			}
+
+			for (int32_t child : { node.Left, node.Right })
+			{
+				EXPECT_EQ(nodes[child].Parent, index);
+				EXPECT_TRUE(node.Bounds.Contains(nodes[child].Bounds));
+				stack.push_back(child);
+			}
+		}
+
+		EXPECT_EQ(leaves, m_BVH.GetLeavesCount());
+	}
+};
+
+TEST_F(BVHTests, InsertedProxiesAreFound)
+{
+	AddProxies(300);
+
+	EXPECT_EQ(m_BVH.GetLeavesCount(), 300u);
+	ExpectValidTree();
+	ExpectQueriesMatchBruteForce();
+}
+
+TEST_F(BVHTests, RemovedProxiesAreNotFound)
+{
+	AddProxies(300);
+
+	for (size_t i = 0; i < m_Proxies.size(); i += 2)
+	{
+		m_BVH.DestroyProxy(m_Proxies[i]);
+		m_Proxies[i] = -1;
+	}
+
+	EXPECT_EQ(m_BVH.GetLeavesCount(), 150u);
+	ExpectValidTree();
+	ExpectQueriesMatchBruteForce();
+
+	// Freed nodes are reused by the next proxies
+	size_t nodesCount = m_BVH.GetNodes().size();
+	AddProxies(100);
+	EXPECT_EQ(m_BVH.GetNodes().size(), nodesCount);
+	ExpectValidTree();
+	ExpectQueriesMatchBruteForce();
+}
+
+TEST_F(BVHTests, MovedProxiesRefitTheirAncestors)
+{
+	AddProxies(300);
+
+	for (size_t i = 0; i < m_Proxies.size(); i += 3)
+	{
+		m_Bounds[i] = RandomBounds(100.0f, 10.0f);
+		m_BVH.UpdateProxy(m_Proxies[i], m_Bounds[i]);
+	}
+
+	ExpectValidTree();
+	ExpectQueriesMatchBruteForce();
+}
+
+TEST_F(BVHTests, RebuildRestoresTheTreeAfterProxiesMoved)
+{
+	AddProxies(300);
+	m_BVH.Rebuild();
+	EXPECT_FALSE(m_BVH.NeedsRebuild());
+
+	// Scattered far from where the tree put them, refitting alone leaves large overlapping nodes
+	for (size_t i = 0; i < m_Proxies.size(); i++)
+	{
+		m_Bounds[i] = RandomBounds(100.0f, 10.0f);
+		m_BVH.UpdateProxy(m_Proxies[i], m_Bounds[i]);
+	}
+	ASSERT_TRUE(m_BVH.NeedsRebuild());
+
+	m_BVH.Rebuild();
+
+	EXPECT_FALSE(m_BVH.NeedsRebuild());
+	ExpectValidTree();
+	ExpectQueriesMatchBruteForce();
+
+	// Proxies keep their index and user data
+	for (size_t i = 0; i < m_Proxies.size(); i++)
+	{
+		EXPECT_EQ(ToIndex(m_BVH.GetUserData(m_Proxies[i])), i);
+		EXPECT_EQ(m_BVH.GetBounds(m_Proxies[i]), m_Bounds[i]);
+	}
+
+	// A binned SAH build of 300 proxies stays far from degenerate
+	EXPECT_LE(m_BVH.GetHeight(), 24u);
+}
+
+TEST_F(BVHTests, RaycastFindsTheClosestProxy)
+{
+	AddProxies(300);
+
+	int hitsCount = 0;
+	for (int i = 0; i < 50; i++)
+	{
+		Ray ray;
+		ray.Origin = glm::vec3(Random(-150.0f, 150.0f), Random(-150.0f, 150.0f), Random(-150.0f, 150.0f));
+		ray.Direction = glm::normalize(glm::vec3(0.0f) - ray.Origin + glm::vec3(Random(-50.0f, 50.0f), Random(-50.0f, 50.0f), Random(-50.0f, 50.0f)));
+
+		float closest = -1.0f;
+		for (auto& bounds : m_Bounds)
+		{
+			float distance = ray.Intersect(bounds, 1000.0f);
+			if (distance >= 0.0f && (closest < 0.0f || distance < closest))
+				closest = distance;
+		}
+
+		float found = -1.0f;
+		m_BVH.Raycast(ray, 1000.0f, [&](void* userData, float distance)
+		{
+			found = distance;
+			return distance;
+		});
+
+		EXPECT_EQ(found, closest);
+		if (found >= 0.0f)
+			hitsCount++;
+	}
+
+	EXPECT_GT(hitsCount, 0);
+}
+
+TEST_F(BVHTests, BatchedQueriesMatchSingleOnes)
+{
+	AddProxies(300);
+
+	std::vector<AABB> boxes;
+	for (int i = 0; i < 16; i++)
+		boxes.push_back(RandomBounds(100.0f, 40.0f));
+
+	std::vector<std::vector<void*>> results;
+	m_BVH.QueryBatch(Span<const AABB>(boxes), results);
+
+	ASSERT_EQ(results.size(), boxes.size());
+	for (size_t i = 0; i < boxes.size(); i++)
+	{
+		std::vector<size_t> found;
+		for (void* userData : results[i])
+			found.push_back(ToIndex(userData));
+		std::sort(found.begin(), found.end());
+
+		EXPECT_EQ(found, BruteForce(boxes[i]));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+
+#include "Scene/Component/ComponentType.h"
+
+template<int N>
+struct TestComponent {};
+
+template<int... N>
+static std::vector<ComponentTypeID> RegisterOnThreads(std::integer_sequence<int, N...>)
+{
+	std::vector<ComponentTypeID> ids(sizeof...(N));
+	std::vector<std::thread> threads;
+	(threads.emplace_back([&ids]() { ids[N] = ComponentType::Get<TestComponent<N>>(); }), ...);
+
+	for (auto& thread : threads)
+		thread.join();
+	return ids;
+}
+
+TEST(ComponentTypeTests, TypesRegisteredConcurrentlyGetDistinctIDs)
+{
+	std::vector<ComponentTypeID> ids = RegisterOnThreads(std::make_integer_sequence<int, 4>());
+
+	EXPECT_EQ(std::set<ComponentTypeID>(ids.begin(), ids.end()).size(), ids.size());
+	for (ComponentTypeID id : ids)
+		EXPECT_LT(id, (ComponentTypeID)MAX_COMPONENT_TYPES);
+
+	// Registered once, later calls return the same ID
+	EXPECT_EQ(ComponentType::Get<TestComponent<0>>(), ids[0]);
+}
\ No newline at end of file
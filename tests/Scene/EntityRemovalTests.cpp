@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "Scene/Scene.h"
+#include "Scene/Component/StaticMeshComponent.h"
+#include "Scene/Component/InstanceRenderedMeshComponent.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+static const char* s_CubePath = "../../res/models/defaults/default_cube.obj";
+
+class EntityRemovalTests : public testing::Test
+{
+protected:
+	Ref<NullRenderDevice> m_Device;
+	Ref<Scene> m_Scene;
+
+	void SetUp() override
+	{
+		m_Device = CreateRef<NullRenderDevice>();
+		RenderDevice::Set(m_Device);
+
+		m_Scene = CreateRef<Scene>();
+		m_Scene->AddRoot();
+	}
+
+	void TearDown() override
+	{
+		m_Scene.reset();
+		RenderDevice::Set(nullptr);
+	}
+};
+
+TEST_F(EntityRemovalTests, RemovingHalfOfASceneReleasesItsMemory)
+{
+	// Enough entities for several pool chunks, each one with GPU objects of its own
+	const int count = 1024;
+	for (int i = 0; i < count; i++)
+	{
+		auto entity = m_Scene->AddEntity("Generated " + std::to_string(i));
+		entity->AddComponent<InstanceRenderedMeshComponent>();
+		m_Scene->AddEntity(s_CubePath, "Child " + std::to_string(i), entity);
+	}
+	m_Scene->PreRender();
+
+	size_t entitiesCount = m_Scene->GetEntities().size();
+	size_t liveAllocations = m_Scene->GetMemory()->GetLiveAllocationsCount();
+	size_t reservedBytes = m_Scene->GetMemory()->GetReservedBytes();
+	size_t liveObjects = m_Device->GetLiveObjectsCount();
+	ASSERT_EQ(entitiesCount, 1u + count * 2);
+
+	// The latest entities, their children go with them
+	for (int i = count / 2; i < count; i++)
+		m_Scene->RemoveEntity(m_Scene->FindEntity("Generated " + std::to_string(i)));
+	m_Scene->PreRender();
+
+	EXPECT_EQ(m_Scene->GetEntities().size(), 1u + count);
+	EXPECT_LT(m_Scene->GetMemory()->GetLiveAllocationsCount(), liveAllocations);
+	EXPECT_LT(m_Scene->GetMemory()->GetReservedBytes(), reservedBytes);
+	// A model matrices buffer and a vertex array per instanced mesh, the cube and its material are shared
+	EXPECT_EQ(m_Device->GetLiveObjectsCount(), liveObjects - count);
+	EXPECT_EQ(m_Scene->GetComponentsCount<StaticMeshComponent>(), count / 2);
+	EXPECT_EQ(m_Scene->GetComponentsCount<InstanceRenderedMeshComponent>(), count / 2);
+	EXPECT_TRUE(m_Device->GetErrors().empty());
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <yaml-cpp/yaml.h>
+
+#include "Scene/SceneSerializer.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+static const char* s_SceneSource = R"(Scene: Untitled
+Camera:
+  Position: [0, 0, 5]
+  Yaw: -90
+  Pitch: 0
+  Movement Speed: 10
+Entities:
+  - Entity: Root
+    ID: 0
+    Transform:
+      Position: [0, 0, 0]
+      Rotation: [0, 0, 0]
+      Scale: [1, 1, 1]
+  - Entity: Parent
+    ID: 722797560
+    Parent: 0
+    Transform:
+      Position: [1, 0, 0]
+      Rotation: [0, 0, 0]
+      Scale: [1, 1, 1]
+  - Entity: Child
+    ID: 941475294
+    Parent: 722797560
+    Transform:
+      Position: [0, 1, 0]
+      Rotation: [0, 0, 0]
+      Scale: [1, 1, 1]
+  - Entity: Other
+    ID: 643321389
+    Parent: 0
+    Transform:
+      Position: [0, 0, 1]
+      Rotation: [0, 0, 0]
+      Scale: [1, 1, 1]
+)";
+
+struct SerializedEntity
+{
+	std::string Name;
+	uint64_t ID;
+	uint64_t Parent;
+
+	bool operator==(const SerializedEntity& other) const { return Name == other.Name && ID == other.ID && Parent == other.Parent; }
+};
+
+static std::vector<SerializedEntity> ReadEntities(const std::string& path)
+{
+	std::vector<SerializedEntity> entities;
+	for (auto entity : YAML::LoadFile(path)["Entities"])
+	{
+		uint64_t parent = entity["Parent"] ? entity["Parent"].as<uint64_t>() : UINT64_MAX;
+		entities.push_back({ entity["Entity"].as<std::string>(), entity["ID"].as<uint64_t>(), parent });
+	}
+
+	return entities;
+}
+
+class SceneSerializerTests : public testing::Test
+{
+protected:
+	std::filesystem::path m_Directory;
+
+	void SetUp() override
+	{
+		RenderDevice::Set(CreateRef<NullRenderDevice>());
+
+		m_Directory = std::filesystem::temp_directory_path() / "MistSceneSerializerTests";
+		std::filesystem::create_directories(m_Directory);
+
+		std::ofstream file(Path("source.scene"));
+		file << s_SceneSource;
+	}
+
+	void TearDown() override
+	{
+		std::filesystem::remove_all(m_Directory);
+		RenderDevice::Set(nullptr);
+	}
+
+	std::string Path(const char* name) const { return (m_Directory / name).string(); }
+};
+
+TEST_F(SceneSerializerTests, SaveLoadSaveKeepsEntityIDs)
+{
+	auto scene = SceneSerializer::Deserialize(Path("source.scene"));
+	ASSERT_TRUE(scene);
+	SceneSerializer::Serialize(scene, Path("first.scene"));
+
+	// The reloaded entities get other handles, the IDs written must not follow them
+	auto reloaded = SceneSerializer::Deserialize(Path("first.scene"));
+	ASSERT_TRUE(reloaded);
+	reloaded->AddEntity("Padding");
+	reloaded->RemoveEntity(reloaded->FindEntity("Padding"));
+	reloaded->DestroyPendingEntities();
+	SceneSerializer::Serialize(reloaded, Path("second.scene"));
+
+	auto source = ReadEntities(Path("source.scene"));
+	EXPECT_EQ(ReadEntities(Path("first.scene")), source);
+	EXPECT_EQ(ReadEntities(Path("second.scene")), source);
+}
+
+TEST_F(SceneSerializerTests, NewEntitiesGetUnusedIDs)
+{
+	auto scene = SceneSerializer::Deserialize(Path("source.scene"));
+	ASSERT_TRUE(scene);
+
+	auto parent = scene->FindEntity("Parent");
+	auto added = scene->AddEntity("Added");
+	added->SetParent(parent.get());
+	scene->RemoveEntity(scene->FindEntity("Other"));
+	scene->DestroyPendingEntities();
+
+	SceneSerializer::Serialize(scene, Path("edited.scene"));
+	SceneSerializer::Serialize(SceneSerializer::Deserialize(Path("edited.scene")), Path("resaved.scene"));
+
+	auto edited = ReadEntities(Path("edited.scene"));
+	ASSERT_EQ(edited.size(), 4u);
+
+	std::unordered_map<std::string, SerializedEntity> byName;
+	for (auto& entity : edited)
+		byName[entity.Name] = entity;
+
+	EXPECT_EQ(byName["Parent"].ID, 722797560u);
+	EXPECT_EQ(byName["Child"].ID, 941475294u);
+	EXPECT_EQ(byName["Added"].Parent, 722797560u);
+	for (uint64_t id : { 0ull, 722797560ull, 941475294ull, 643321389ull })
+		EXPECT_NE(byName["Added"].ID, id);
+
+	EXPECT_EQ(ReadEntities(Path("resaved.scene")), edited);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include "Scene/Scene.h"
+#include "Scene/Component/StaticMeshComponent.h"
+#include "Renderer/Device/NullRenderDevice.h"
+
+static const char* s_CubePath = "../../res/models/defaults/default_cube.obj";
+
+class ShadowInvalidationTests : public testing::Test
+{
+protected:
+	Ref<Scene> m_Scene;
+
+	void SetUp() override
+	{
+		RenderDevice::Set(CreateRef<NullRenderDevice>());
+
+		m_Scene = CreateRef<Scene>();
+		m_Scene->AddRoot();
+	}
+
+	void TearDown() override
+	{
+		m_Scene.reset();
+		RenderDevice::Set(nullptr);
+	}
+
+	// Resolves the casters' bounds, the invalidations queued until then are consumed by the frame
+	void Frame() { m_Scene->PreRender(); }
+
+	size_t Invalidations(Mobility mobility) const { return m_Scene->GetShadowInvalidations(mobility).size(); }
+};
+
+TEST_F(ShadowInvalidationTests, MobilityChangeInvalidatesBothLayers)
+{
+	auto caster = m_Scene->AddEntity(s_CubePath, "Caster");
+	Frame();
+	ASSERT_EQ(Invalidations(Mobility::STATIC), 0u);
+
+	caster->SetMobility(Mobility::MOVABLE);
+
+	const AABB& bounds = caster->GetComponent<StaticMeshComponent>()->GetWorldBounds();
+	ASSERT_EQ(Invalidations(Mobility::STATIC), 1u);
+	ASSERT_EQ(Invalidations(Mobility::MOVABLE), 1u);
+	EXPECT_EQ(m_Scene->GetShadowInvalidations(Mobility::STATIC)[0].Min, bounds.Min);
+	EXPECT_EQ(m_Scene->GetShadowInvalidations(Mobility::MOVABLE)[0].Max, bounds.Max);
+
+	Frame();
+	caster->SetMobility(Mobility::MOVABLE);
+	EXPECT_EQ(Invalidations(Mobility::STATIC) + Invalidations(Mobility::MOVABLE), 0u);
+}
+
+TEST_F(ShadowInvalidationTests, EnableInvalidatesTheSubtreeInItsOwnLayer)
+{
+	auto parent = m_Scene->AddEntity(s_CubePath, "Parent");
+	auto child = m_Scene->AddEntity(s_CubePath, "Child", parent);
+	child->SetMobility(Mobility::MOVABLE);
+	Frame();
+
+	parent->SetEnable(false);
+	EXPECT_EQ(Invalidations(Mobility::STATIC), 1u);
+	EXPECT_EQ(Invalidations(Mobility::MOVABLE), 1u);
+
+	Frame();
+	parent->SetEnable(false);
+	EXPECT_EQ(Invalidations(Mobility::STATIC) + Invalidations(Mobility::MOVABLE), 0u);
+}
+
+TEST_F(ShadowInvalidationTests, DisabledSubtreesAreLeftAlone)
+{
+	auto parent = m_Scene->AddEntity(s_CubePath, "Parent");
+	auto child = m_Scene->AddEntity(s_CubePath, "Child", parent);
+	child->SetEnable(false);
+	Frame();
+
+	// The child stays hidden whatever its parent does
+	parent->SetEnable(false);
+	EXPECT_EQ(Invalidations(Mobility::STATIC), 1u);
+}
\ No newline at end of file
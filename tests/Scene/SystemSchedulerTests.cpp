@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "Scene/SystemScheduler.h"
+#include "Core/Jobs/JobSystem.h"
+
+namespace
+{
+	struct Position {};
+	struct Velocity {};
+	struct Health {};
+}
+
+class SystemSchedulerTests : public testing::Test
+{
+protected:
+	SystemScheduler m_Scheduler{ nullptr };
+
+	void SetUp() override
+	{
+		JobSystem::GetInstance()->Initialize(3);
+	}
+
+	void TearDown() override
+	{
+		JobSystem::GetInstance()->Shutdown();
+	}
+
+	void Add(std::string name, ComponentMask reads, ComponentMask writes, bool mainThread, std::function<void()> function)
+	{
+		System system;
+		system.Name = name;
+		system.Access.Reads = reads;
+		system.Access.Writes = writes;
+		system.Access.MainThread = mainThread;
+		system.Execute = [function](Scene*, float) { function(); };
+		m_Scheduler.AddSystem(SystemPhase::UPDATE, system);
+	}
+
+	// Waits until count systems have arrived, false if they did not run side by side in time
+	static bool Meet(std::atomic<int>& arrived, int count)
+	{
+		arrived++;
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (arrived < count)
+		{
+			if (std::chrono::steady_clock::now() > deadline)
+				return false;
+			std::this_thread::yield();
+		}
+		return true;
+	}
+};
+
+TEST_F(SystemSchedulerTests, ConflictingSystemsStartANewBatch)
+{
+	auto none = ComponentMask();
+	Add("Move", SystemScheduler::Mask<Velocity>(), SystemScheduler::Mask<Position>(), false, []() {});
+	Add("Regenerate", none, SystemScheduler::Mask<Health>(), false, []() {});
+	// Reads what Move writes
+	Add("Collide", SystemScheduler::Mask<Position>(), none, false, []() {});
+	Add("Report", SystemScheduler::Mask<Health>(), none, true, []() {});
+	// Writes what Collide and Report read
+	Add("Teleport", none, SystemScheduler::Mask<Position, Health>(), false, []() {});
+
+	const auto& batches = m_Scheduler.GetBatches(SystemPhase::UPDATE);
+	ASSERT_EQ(batches.size(), 3u);
+	EXPECT_EQ(batches[0], (std::vector<uint32_t>{ 0, 1 }));
+	EXPECT_EQ(batches[1], (std::vector<uint32_t>{ 2, 3 }));
+	EXPECT_EQ(batches[2], (std::vector<uint32_t>{ 4 }));
+}
+
+TEST_F(SystemSchedulerTests, WorkerSystemsOfABatchRunSideBySide)
+{
+	std::thread::id mainThread = std::this_thread::get_id();
+
+	std::atomic<int> arrived{ 0 };
+	std::atomic<bool> met[2] = { false, false };
+	std::atomic<bool> movedOffMainThread{ false };
+	std::thread::id reportThread;
+
+	// Each of the two waits for the other, they only both finish if they ran at the same time
+	Add("Move", SystemScheduler::Mask<Velocity>(), SystemScheduler::Mask<Position>(), false, [&]()
+	{
+		met[0] = Meet(arrived, 2);
+		movedOffMainThread = movedOffMainThread || std::this_thread::get_id() != mainThread;
+	});
+	Add("Regenerate", ComponentMask(), SystemScheduler::Mask<Health>(), false, [&]()
+	{
+		met[1] = Meet(arrived, 2);
+		movedOffMainThread = movedOffMainThread || std::this_thread::get_id() != mainThread;
+	});
+
+	// Next batch, only starts once both are done
+	std::atomic<int> arrivedBefore{ -1 };
+	Add("Collide", SystemScheduler::Mask<Position>(), ComponentMask(), false, [&]() { arrivedBefore = arrived.load(); });
+	Add("Report", SystemScheduler::Mask<Health>(), ComponentMask(), true, [&]() { reportThread = std::this_thread::get_id(); });
+
+	ASSERT_EQ(m_Scheduler.GetBatches(SystemPhase::UPDATE).size(), 2u);
+
+	m_Scheduler.Run(SystemPhase::UPDATE);
+
+	EXPECT_TRUE(met[0]);
+	EXPECT_TRUE(met[1]);
+	EXPECT_TRUE(movedOffMainThread);
+	EXPECT_EQ(arrivedBefore, 2);
+	EXPECT_EQ(reportThread, mainThread);
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#include <gtest/gtest.h>
+
+#include "Renderer/Device/NullRenderDevice.h"
+
+// Materials and meshes cached by the importers outlive the tests and free their GPU objects at exit,
+// by then a null device has to be installed instead of the OpenGL one RenderDevice::Get falls back to
+class NullDeviceEnvironment : public testing::Environment
+{
+public:
+	void TearDown() override
+	{
+		RenderDevice::Set(CreateRef<NullRenderDevice>());
+	}
+};
+
+static testing::Environment* const s_NullDeviceEnvironment = testing::AddGlobalTestEnvironment(new NullDeviceEnvironment());
\ No newline at end of file
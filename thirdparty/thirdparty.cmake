@@ -116,4 +116,22 @@ add_library("ImGuizmo" STATIC "${IMGUIZMO_DIR}/ImGuizmo.cpp")
 target_include_directories("ImGuizmo" PRIVATE "${IMGUIZMO_DIR}" "${IMGUI_DIR}")
 
 set(IMGUIZMO_LIBRARY "ImGuizmo")
-set(IMGUIZMO_INCLUDE_DIR "${IMGUIZMO_DIR}")
\ No newline at end of file
+set(IMGUIZMO_INCLUDE_DIR "${IMGUIZMO_DIR}")
+
+# googletest
+find_package(GTest QUIET)
+
+if(NOT GTest_FOUND)
+	set(GOOGLETEST_DIR "${THIRDPARTY_DIR}/googletest")
+
+	message("Unable to find googletest, cloning...")
+    execute_process(COMMAND git submodule update --init ${GOOGLETEST_DIR}
+                    WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR})
+
+	set(INSTALL_GTEST OFF CACHE INTERNAL "Enable installation of googletest")
+	set(BUILD_GMOCK   OFF CACHE INTERNAL "Builds the googlemock subproject")
+
+    add_subdirectory("${GOOGLETEST_DIR}")
+endif()
+
+set(GTEST_LIBRARY GTest::gtest GTest::gtest_main)
\ No newline at end of file